@@ -1400,6 +1400,7 @@ our %Modules = (
                 ext/PerlIO-encoding/
                 ext/PerlIO-mmap/
                 ext/PerlIO-scalar/
+                ext/PerlIO-uring/
                 ext/PerlIO-via/
                 ext/Pod-Functions/
                 ext/Pod-Html/
@@ -1846,11 +1846,14 @@ const struct flag_to_name regexp_core_intflags_names[] = {
     {PREGf_CUTGROUP_SEEN,   "CUTGROUP_SEEN,"},
     {PREGf_USE_RE_EVAL,     "USE_RE_EVAL,"},
     {PREGf_NOSCAN,          "NOSCAN,"},
+    {PREGf_LOOKAHEAD_SEEN,  "LOOKAHEAD_SEEN,"},
     {PREGf_GPOS_SEEN,       "GPOS_SEEN,"},
     {PREGf_GPOS_FLOAT,      "GPOS_FLOAT,"},
     {PREGf_ANCH_MBOL,       "ANCH_MBOL,"},
     {PREGf_ANCH_SBOL,       "ANCH_SBOL,"},
     {PREGf_ANCH_GPOS,       "ANCH_GPOS,"},
+    {PREGf_LINEAR_OK,       "LINEAR_OK,"},
+    {PREGf_LINEAR,          "LINEAR,"},
 };
 
 /* Minimum number of decimal digits to preserve the significand of NV.  */
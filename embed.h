@@ -287,6 +287,7 @@
 # define gv_stashpvn(a,b,c)                     Perl_gv_stashpvn(aTHX_ a,b,c)
 # define gv_stashsv(a,b)                        Perl_gv_stashsv(aTHX_ a,b)
 # define hv_bucket_ratio(a)                     Perl_hv_bucket_ratio(aTHX_ a)
+# define hv_build_from_pairs(a,b,c)             Perl_hv_build_from_pairs(aTHX_ a,b,c)
 # define hv_clear(a)                            Perl_hv_clear(aTHX_ a)
 # define hv_clear_placeholders(a)               Perl_hv_clear_placeholders(aTHX_ a)
 # define hv_common(a,b,c,d,e,f,g,h)             Perl_hv_common(aTHX_ a,b,c,d,e,f,g,h)
@@ -466,6 +467,8 @@
 # define op_null(a)                             Perl_op_null(aTHX_ a)
 # define op_parent                              Perl_op_parent
 # define op_prepend_elem(a,b,c)                 Perl_op_prepend_elem(aTHX_ a,b,c)
+# define op_profile_start(a,b)                  Perl_op_profile_start(aTHX_ a,b)
+# define op_profile_stop()                      Perl_op_profile_stop(aTHX)
 # define op_refcnt_lock()                       Perl_op_refcnt_lock(aTHX)
 # define op_refcnt_unlock()                     Perl_op_refcnt_unlock(aTHX)
 # define op_scope(a)                            Perl_op_scope(aTHX_ a)
@@ -573,6 +576,7 @@
 # define rsignal(a,b)                           Perl_rsignal(aTHX_ a,b)
 # define rsignal_state(a)                       Perl_rsignal_state(aTHX_ a)
 # define runops_debug()                         Perl_runops_debug(aTHX)
+# define runops_profile()                       Perl_runops_profile(aTHX)
 # define runops_standard()                      Perl_runops_standard(aTHX)
 # define rv2cv_op_cv(a,b)                       Perl_rv2cv_op_cv(aTHX_ a,b)
 # define safesyscalloc                          Perl_safesyscalloc
@@ -652,6 +656,7 @@
 # define sv_2pvbyte_flags(a,b,c)                Perl_sv_2pvbyte_flags(aTHX_ a,b,c)
 # define sv_2pvutf8_flags(a,b,c)                Perl_sv_2pvutf8_flags(aTHX_ a,b,c)
 # define sv_2uv_flags(a,b)                      Perl_sv_2uv_flags(aTHX_ a,b)
+# define sv_arena_stats(a)                      Perl_sv_arena_stats(aTHX_ a)
 # define sv_backoff                             Perl_sv_backoff
 # define sv_bless(a,b)                          Perl_sv_bless(aTHX_ a,b)
 # define sv_cat_decode(a,b,c,d,e,f)             Perl_sv_cat_decode(aTHX_ a,b,c,d,e,f)
@@ -664,6 +669,7 @@
 # define sv_clear(a)                            Perl_sv_clear(aTHX_ a)
 # define sv_cmp_flags(a,b,c)                    Perl_sv_cmp_flags(aTHX_ a,b,c)
 # define sv_cmp_locale_flags(a,b,c)             Perl_sv_cmp_locale_flags(aTHX_ a,b,c)
+# define sv_compact_arenas()                    Perl_sv_compact_arenas(aTHX)
 # define sv_copypv_flags(a,b,c)                 Perl_sv_copypv_flags(aTHX_ a,b,c)
 # define sv_dec(a)                              Perl_sv_dec(aTHX_ a)
 # define sv_dec_nomg(a)                         Perl_sv_dec_nomg(aTHX_ a)
@@ -686,6 +692,7 @@
 # define sv_gets(a,b,c)                         Perl_sv_gets(aTHX_ a,b,c)
 # define sv_grow(a,b)                           Perl_sv_grow(aTHX_ a,b)
 # define sv_grow_fresh(a,b)                     Perl_sv_grow_fresh(aTHX_ a,b)
+# define sv_heap_usage(a,b,c)                   Perl_sv_heap_usage(aTHX_ a,b,c)
 # define sv_inc(a)                              Perl_sv_inc(aTHX_ a)
 # define sv_inc_nomg(a)                         Perl_sv_inc_nomg(aTHX_ a)
 # define sv_insert_flags(a,b,c,d,e,f)           Perl_sv_insert_flags(aTHX_ a,b,c,d,e,f)
@@ -1124,6 +1131,7 @@
 #   define sv_pvutf8n_force_wrapper(a,b,c)      Perl_sv_pvutf8n_force_wrapper(aTHX_ a,b,c)
 #   define sv_resetpvn(a,b,c)                   Perl_sv_resetpvn(aTHX_ a,b,c)
 #   define sv_sethek(a,b)                       Perl_sv_sethek(aTHX_ a,b)
+#   define sv_setpv_view(a,b,c)                 Perl_sv_setpv_view(aTHX_ a,b,c)
 #   define tmps_grow_p(a)                       Perl_tmps_grow_p(aTHX_ a)
 #   define utilize(a,b,c,d,e)                   Perl_utilize(aTHX_ a,b,c,d,e)
 #   define vivify_ref(a,b)                      Perl_vivify_ref(aTHX_ a,b)
@@ -1300,6 +1308,7 @@
 #   if defined(PERL_IN_HV_C)
 #     define clear_placeholders(a,b)            S_clear_placeholders(aTHX_ a,b)
 #     define hsplit(a,b,c)                      S_hsplit(aTHX_ a,b,c)
+#     define hsplit_bucket(a,b,c)               S_hsplit_bucket(aTHX_ a,b,c)
 #     define hv_auxinit(a)                      S_hv_auxinit(aTHX_ a)
 #     define hv_delete_common(a,b,c,d,e,f,g)    S_hv_delete_common(aTHX_ a,b,c,d,e,f,g)
 #     define hv_free_ent_ret(a)                 S_hv_free_ent_ret(aTHX_ a)
@@ -1310,6 +1319,10 @@
 #     define save_hek_flags                     S_save_hek_flags
 #     define share_hek_flags(a,b,c,d)           S_share_hek_flags(aTHX_ a,b,c,d)
 #     define unshare_hek_or_pvn(a,b,c,d)        S_unshare_hek_or_pvn(aTHX_ a,b,c,d)
+#     if defined(PERL_HV_INCREMENTAL_SPLIT)
+#       define hsplit_step(a,b)                 S_hsplit_step(aTHX_ a,b)
+#       define hv_bucket_index                  S_hv_bucket_index
+#     endif
 #     if !defined(PURIFY)
 #       define new_he()                         S_new_he(aTHX)
 #     endif
@@ -1515,7 +1528,13 @@
 #     define do_chomp(a,b,c)                    S_do_chomp(aTHX_ a,b,c)
 #     define do_delete_local()                  S_do_delete_local(aTHX)
 #     define refto(a)                           S_refto(aTHX_ a)
-#   endif
+#     define split_estimate                     S_split_estimate
+#     if defined(I_PTHREAD) && defined(USE_ITHREADS)
+#       define psplit_run_jobs                  S_psplit_run_jobs
+#       define psplit_worker                    S_psplit_worker
+#       define split_parallel(a,b,c,d)          S_split_parallel(aTHX_ a,b,c,d)
+#     endif
+#   endif /* defined(PERL_IN_PP_C) */
 #   if defined(PERL_IN_PP_C) || defined(PERL_IN_PP_HOT_C)
 #     define lossless_NV_to_IV                  S_lossless_NV_to_IV
 #   endif
@@ -1579,14 +1598,32 @@
 #     define amagic_ncmp(a,b)                   S_amagic_ncmp(aTHX_ a,b)
 #     define amagic_ncmp_desc(a,b)              S_amagic_ncmp_desc(aTHX_ a,b)
 #     define cmp_desc(a,b)                      S_cmp_desc(aTHX_ a,b)
+#     define simple_iv_cmp(a,b)                 S_simple_iv_cmp(aTHX_ a,b)
+#     define simple_iv_cmp_desc(a,b)            S_simple_iv_cmp_desc(aTHX_ a,b)
+#     define simple_nv_cmp(a,b)                 S_simple_nv_cmp(aTHX_ a,b)
+#     define simple_nv_cmp_desc(a,b)            S_simple_nv_cmp_desc(aTHX_ a,b)
+#     define simple_pv_cmp(a,b)                 S_simple_pv_cmp(aTHX_ a,b)
+#     define simple_pv_cmp_desc(a,b)            S_simple_pv_cmp_desc(aTHX_ a,b)
+#     define sort_simple_kind(a,b,c,d,e)        S_sort_simple_kind(aTHX_ a,b,c,d,e)
 #     define sortcv(a,b)                        S_sortcv(aTHX_ a,b)
 #     define sortcv_stacked(a,b)                S_sortcv_stacked(aTHX_ a,b)
 #     define sortcv_xsub(a,b)                   S_sortcv_xsub(aTHX_ a,b)
 #     define sortsv_flags_impl(a,b,c,d)         S_sortsv_flags_impl(aTHX_ a,b,c,d)
+#     define sortsv_merge_impl(a,b,c,d)         S_sortsv_merge_impl(aTHX_ a,b,c,d)
+#     define sortsv_radix(a,b,c)                S_sortsv_radix(aTHX_ a,b,c)
+#     define sortsv_simple(a,b,c,d,e)           S_sortsv_simple(aTHX_ a,b,c,d,e)
 #     define sv_i_ncmp(a,b)                     S_sv_i_ncmp(aTHX_ a,b)
 #     define sv_i_ncmp_desc(a,b)                S_sv_i_ncmp_desc(aTHX_ a,b)
 #     define sv_ncmp(a,b)                       S_sv_ncmp(aTHX_ a,b)
 #     define sv_ncmp_desc(a,b)                  S_sv_ncmp_desc(aTHX_ a,b)
+#     if defined(I_PTHREAD) && defined(USE_ITHREADS)
+#       define psort_lower_bound(a,b,c,d)       S_psort_lower_bound(aTHX_ a,b,c,d)
+#       define psort_run(a,b,c,d,e,f)           S_psort_run(aTHX_ a,b,c,d,e,f)
+#       define psort_run_jobs                   S_psort_run_jobs
+#       define psort_worker                     S_psort_worker
+#       define sort_parallel_threads(a)         S_sort_parallel_threads(aTHX_ a)
+#       define sortsv_parallel(a,b,c,d)         S_sortsv_parallel(aTHX_ a,b,c,d)
+#     endif
 #     if defined(USE_LOCALE_COLLATE)
 #       define amagic_cmp_locale(a,b)           S_amagic_cmp_locale(aTHX_ a,b)
 #       define amagic_cmp_locale_desc(a,b)      S_amagic_cmp_locale_desc(aTHX_ a,b)
@@ -1658,6 +1695,10 @@
 #     endif
 #   endif /* defined(PERL_IN_TOKE_C) */
 #   if defined(PERL_IN_UNIVERSAL_C)
+#     define copy_direct(a)                     S_copy_direct(aTHX_ a)
+#     define copy_io(a,b)                       S_copy_io(aTHX_ a,b)
+#     define copy_kernel(a,b,c,d)               S_copy_kernel(aTHX_ a,b,c,d)
+#     define copy_loop(a,b,c,d)                 S_copy_loop(aTHX_ a,b,c,d)
 #     define isa_lookup(a,b,c,d,e)              S_isa_lookup(aTHX_ a,b,c,d,e)
 #     define sv_derived_from_svpvn(a,b,c,d,e)   S_sv_derived_from_svpvn(aTHX_ a,b,c,d,e)
 #   endif
@@ -1690,6 +1731,9 @@
 #     if defined(PERL_USES_PL_PIDSTATUS)
 #       define pidgone(a,b)                     S_pidgone(aTHX_ a,b)
 #     endif
+#     if defined(PERL_USE_SSE2)
+#       define first_last_instr                 S_first_last_instr
+#     endif
 #   endif /* defined(PERL_IN_UTIL_C) */
 #   if defined(PERL_USE_3ARG_SIGHANDLER)
 #     define sighandler                         Perl_sighandler
@@ -1750,6 +1794,9 @@
 #   define multideref_stringify(a,b)            Perl_multideref_stringify(aTHX_ a,b)
 #   define op_clear(a)                          Perl_op_clear(aTHX_ a)
 #   define qerror(a)                            Perl_qerror(aTHX_ a)
+#   define re_cache_fetch(a,b,c,d,e)            Perl_re_cache_fetch(aTHX_ a,b,c,d,e)
+#   define re_cache_resize(a)                   Perl_re_cache_resize(aTHX_ a)
+#   define re_cache_store(a,b,c)                Perl_re_cache_store(aTHX_ a,b,c)
 #   define reg_named_buff(a,b,c,d)              Perl_reg_named_buff(aTHX_ a,b,c,d)
 #   define reg_named_buff_iter(a,b,c)           Perl_reg_named_buff_iter(aTHX_ a,b,c)
 #   define reg_numbered_buff_fetch(a,b,c)       Perl_reg_numbered_buff_fetch(aTHX_ a,b,c)
@@ -1882,6 +1929,8 @@
 #     define handle_regex_sets(a,b,c,d)         S_handle_regex_sets(aTHX_ a,b,c,d)
 #     define handle_user_defined_property(a,b,c,d,e,f,g,h,i,j) S_handle_user_defined_property(aTHX_ a,b,c,d,e,f,g,h,i,j)
 #     define is_ssc_worth_it                    S_is_ssc_worth_it
+#     define linear_compile(a,b)                S_linear_compile(aTHX_ a,b)
+#     define linear_hint()                      S_linear_hint(aTHX)
 #     define nextchar(a)                        S_nextchar(aTHX_ a)
 #     define optimize_regclass(a,b,c,d,e,f,g,h,i,j) S_optimize_regclass(aTHX_ a,b,c,d,e,f,g,h,i,j)
 #     define output_posix_warnings(a,b)         S_output_posix_warnings(aTHX_ a,b)
@@ -1905,8 +1954,10 @@
 #     define regpnode(a,b,c)                    S_regpnode(aTHX_ a,b,c)
 #     define regtail(a,b,c,d)                   S_regtail(aTHX_ a,b,c,d)
 #     define set_regex_pv(a,b)                  S_set_regex_pv(aTHX_ a,b)
+#     define set_stclass_ranges(a)              S_set_stclass_ranges(aTHX_ a)
 #     define skip_to_be_ignored_text(a,b,c)     S_skip_to_be_ignored_text(aTHX_ a,b,c)
 #     define ssc_finalize(a,b)                  S_ssc_finalize(aTHX_ a,b)
+#     define straight_compile(a)                S_straight_compile(aTHX_ a)
 #     if defined(DEBUGGING)
 #       define regnode_guts_debug(a,b,c)        S_regnode_guts_debug(aTHX_ a,b,c)
 #       define regtail_study(a,b,c,d)           S_regtail_study(aTHX_ a,b,c,d)
@@ -1977,6 +2028,7 @@
 #     define backup_one_WB(a,b,c,d)             S_backup_one_WB(aTHX_ a,b,c,d)
 #     define capture_clear(a,b,c,d)             S_capture_clear(aTHX_ a,b,c,d comma_aDEPTH)
 #     define find_byclass(a,b,c,d,e)            S_find_byclass(aTHX_ a,b,c,d,e)
+#     define find_next_in_ranges                S_find_next_in_ranges
 #     define find_next_masked                   S_find_next_masked
 #     define find_span_end                      S_find_span_end
 #     define find_span_end_mask                 S_find_span_end_mask
@@ -1987,6 +2039,8 @@
 #     define isLB(a,b,c,d,e,f)                  S_isLB(aTHX_ a,b,c,d,e,f)
 #     define isSB(a,b,c,d,e,f)                  S_isSB(aTHX_ a,b,c,d,e,f)
 #     define isWB(a,b,c,d,e,f,g)                S_isWB(aTHX_ a,b,c,d,e,f,g)
+#     define linear_assert(a,b,c)               S_linear_assert(aTHX_ a,b,c)
+#     define linear_exec(a,b)                   S_linear_exec(aTHX_ a,b)
 #     define reg_check_named_buff_matched       S_reg_check_named_buff_matched
 #     define regcp_restore(a,b,c)               S_regcp_restore(aTHX_ a,b,c comma_aDEPTH)
 #     define regcppop(a,b)                      S_regcppop(aTHX_ a,b comma_aDEPTH)
@@ -1998,6 +2052,7 @@
 #     define regmatch(a,b,c)                    S_regmatch(aTHX_ a,b,c)
 #     define regrepeat(a,b,c,d,e,f)             S_regrepeat(aTHX_ a,b,c,d,e,f comma_aDEPTH)
 #     define regtry(a,b)                        S_regtry(aTHX_ a,b)
+#     define straight_exec(a,b)                 S_straight_exec(aTHX_ a,b)
 #     define to_byte_substr(a)                  S_to_byte_substr(aTHX_ a)
 #     define to_utf8_substr(a)                  S_to_utf8_substr(aTHX_ a)
 #     define unwind_paren(a,b,c)                S_unwind_paren(aTHX_ a,b,c comma_aDEPTH)
@@ -2067,6 +2122,8 @@
 #     define F0convert                          S_F0convert
 #     define anonymise_cv_maybe(a,b)            S_anonymise_cv_maybe(aTHX_ a,b)
 #     define assert_uft8_cache_coherent(a,b,c,d) S_assert_uft8_cache_coherent(aTHX_ a,b,c,d)
+#     define compact_body_arenas()              S_compact_body_arenas(aTHX)
+#     define compact_head_arenas()              S_compact_head_arenas(aTHX)
 #     define curse(a,b)                         S_curse(aTHX_ a,b)
 #     define expect_number(a)                   S_expect_number(aTHX_ a)
 #     define find_array_subscript(a,b)          S_find_array_subscript(aTHX_ a,b)
@@ -2074,12 +2131,14 @@
 #     define find_uninit_var(a,b,c,d)           S_find_uninit_var(aTHX_ a,b,c,d)
 #     define glob_2number(a)                    S_glob_2number(aTHX_ a)
 #     define glob_assign_glob(a,b,c)            S_glob_assign_glob(aTHX_ a,b,c)
+#     define heap_usage_store(a,b,c,d,e,f)      S_heap_usage_store(aTHX_ a,b,c,d,e,f)
 #     define not_a_number(a)                    S_not_a_number(aTHX_ a)
 #     define not_incrementable(a)               S_not_incrementable(aTHX_ a)
 #     define ptr_table_find                     S_ptr_table_find
 #     define sv_2iuv_common(a)                  S_sv_2iuv_common(aTHX_ a)
 #     define sv_add_arena(a,b,c)                S_sv_add_arena(aTHX_ a,b,c)
 #     define sv_display(a,b,c)                  S_sv_display(aTHX_ a,b,c)
+#     define sv_heap_size(a)                    S_sv_heap_size(aTHX_ a)
 #     define sv_pos_b2u_midway(a,b,c,d)         S_sv_pos_b2u_midway(aTHX_ a,b,c,d)
 #     define sv_pos_u2b_cached(a,b,c,d,e,f,g)   S_sv_pos_u2b_cached(aTHX_ a,b,c,d,e,f,g)
 #     define sv_pos_u2b_forwards                S_sv_pos_u2b_forwards
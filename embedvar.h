@@ -134,6 +134,8 @@
 # define PL_hook__require__after                (vTHX->Ihook__require__after)
 # define PL_hook__require__before               (vTHX->Ihook__require__before)
 # define PL_hv_fetch_ent_mh                     (vTHX->Ihv_fetch_ent_mh)
+# define PL_hv_split_count                      (vTHX->Ihv_split_count)
+# define PL_hv_split_worst                      (vTHX->Ihv_split_worst)
 # define PL_in_clean_all                        (vTHX->Iin_clean_all)
 # define PL_in_clean_objs                       (vTHX->Iin_clean_objs)
 # define PL_in_eval                             (vTHX->Iin_eval)
@@ -207,6 +209,9 @@
 # define PL_op                                  (vTHX->Iop)
 # define PL_op_exec_cnt                         (vTHX->Iop_exec_cnt)
 # define PL_op_mask                             (vTHX->Iop_mask)
+# define PL_op_profile_counts                   (vTHX->Iop_profile_counts)
+# define PL_op_profile_file                     (vTHX->Iop_profile_file)
+# define PL_op_profile_samples                  (vTHX->Iop_profile_samples)
 # define PL_opfreehook                          (vTHX->Iopfreehook)
 # define PL_origalen                            (vTHX->Iorigalen)
 # define PL_origargc                            (vTHX->Iorigargc)
@@ -239,6 +244,7 @@
 # define PL_psig_ptr                            (vTHX->Ipsig_ptr)
 # define PL_ptr_table                           (vTHX->Iptr_table)
 # define PL_random_state                        (vTHX->Irandom_state)
+# define PL_re_cache                            (vTHX->Ire_cache)
 # define PL_reentrant_buffer                    (vTHX->Ireentrant_buffer)
 # define PL_reentrant_retint                    (vTHX->Ireentrant_retint)
 # define PL_reg_curpm                           (vTHX->Ireg_curpm)
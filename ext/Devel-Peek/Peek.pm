@@ -3,7 +3,7 @@
 
 package Devel::Peek;
 
-$VERSION = '1.34';
+$VERSION = '1.35';
 $XS_VERSION = $VERSION;
 $VERSION = eval $VERSION;
 
@@ -12,7 +12,8 @@ require XSLoader;
 
 @EXPORT = qw(Dump mstat DeadCode DumpArray DumpWithOP DumpProg
 	     fill_mstats mstats_fillhash mstats2hash runops_debug debug_flags);
-@EXPORT_OK = qw(SvREFCNT CvGV);
+@EXPORT_OK = qw(SvREFCNT CvGV arena_stats compact_arenas heap_usage
+		heap_snapshot);
 %EXPORT_TAGS = ('ALL' => [@EXPORT, @EXPORT_OK]);
 
 XSLoader::load();
@@ -37,6 +38,21 @@ sub import {
   goto &Exporter::import;
 }
 
+sub heap_snapshot (;$) {
+   my $fh = @_ ? shift : \*STDOUT;
+   my %usage;
+   &heap_usage(\%usage);
+   for my $kind (qw(type package pad)) {
+      my $totals = $usage{$kind};
+      for my $name (sort keys %$totals) {
+         print $fh join("\t", $kind, $name, @{$totals->{$name}}{qw(count bytes)}),
+                   "\n"
+            or return;
+      }
+   }
+   return 1;
+}
+
 sub DumpWithOP ($;$) {
    local($Devel::Peek::dump_ops)=1;
    my $depth = @_ > 1 ? $_[1] : 4 ;
@@ -216,6 +232,68 @@ So, if you want to collect memory info in a cycle, you may call
     # Do something with %report
   }
 
+Independently of the malloc() in use, perl allocates SV heads, SV
+bodies and hash entries from arenas of about 4K, which it only returns
+to the system at interpreter destruction.  C<arena_stats(%hash)> fills
+%hash with one entry per kind of arena in use: C<SV> for SV heads, C<HE>
+for hash entries, C<HVAUX> for hashes with iterator state, and C<PV>,
+C<PVHV>, C<PVCV> and so on for the bodies of each type of SV.  Each
+value is a reference to a hash with the fields
+
+  arenas bytes free slots used
+
+C<compact_arenas()> frees the arenas in which every slot is free, and
+returns the number of bytes released.  A long-running process whose
+number of live SVs spiked can call it to give the memory back:
+
+  use Devel::Peek qw(arena_stats compact_arenas);
+  arena_stats(%before);
+  my $released = compact_arenas();
+  printf "%d bytes released, %d SV heads in use\n",
+      $released, $before{SV}{used};
+
+Arenas that still hold a single live SV cannot be freed, so the memory
+recovered depends on how the surviving SVs are scattered.
+
+C<heap_usage(%hash)> accounts for the memory held by every live SV in a
+single pass over the arenas, which is much cheaper than following
+references from a set of roots.  It sets three fields of %hash, each a
+reference to a hash of totals keyed by name, whose values are hashes with
+the fields C<count> and C<bytes>:
+
+=over 4
+
+=item C<type>
+
+All SVs, by SV type, such as C<PV>, C<PVAV> or C<PVHV>.
+
+=item C<package>
+
+Objects, by the package they are blessed into.
+
+=item C<pad>
+
+The pads of each named subroutine, including its lexical variables at
+every recursion depth.  Anonymous subroutines are totalled by package as
+C<Package::__ANON__>, the main program as C<(main)> and string evals as
+C<(eval)>.  Here C<count> is the number of pad entries.
+
+=back
+
+The bytes of an SV are those of its head and body, and of the string
+buffer, array or hash buckets it owns, but not of the SVs it refers to.
+See L<perlapi/sv_heap_usage> for the details.
+
+C<heap_snapshot($fh)> writes the same information to $fh (C<STDOUT> by
+default), one line per total, each line holding the kind (C<type>,
+C<package> or C<pad>), the name, the count and the bytes, separated by
+tabs.  The lines are sorted, so that snapshots taken at different times
+can be compared with C<diff>:
+
+  use Devel::Peek qw(heap_snapshot);
+  open my $fh, '>', "heap.$$." . time or die $!;
+  heap_snapshot($fh);
+
 =head1 EXAMPLES
 
 The following examples don't attempt to show everything as that would be a
@@ -556,8 +634,9 @@ it has no prototype (C<PROTOTYPE> field is missing).
 
 C<Dump>, C<mstat>, C<DeadCode>, C<DumpArray>, C<DumpWithOP> and
 C<DumpProg>, C<fill_mstats>, C<mstats_fillhash>, C<mstats2hash> by
-default. Additionally available C<SvREFCNT>, C<SvREFCNT_inc> and
-C<SvREFCNT_dec>.
+default. Additionally available C<SvREFCNT>, C<SvREFCNT_inc>,
+C<SvREFCNT_dec>, C<arena_stats>, C<compact_arenas>, C<heap_usage> and
+C<heap_snapshot>.
 
 =head1 BUGS
 
@@ -431,6 +431,38 @@ void
 mstats2hash(SV *sv, SV *rv, int level = 0)
     PROTOTYPE: $\%;$
 
+void
+arena_stats(SV *rv)
+    PROTOTYPE: \%
+CODE:
+    if (!(SvROK(rv) && SvTYPE(SvRV(rv)) == SVt_PVHV))
+	croak("Not a hash reference");
+    sv_arena_stats(MUTABLE_HV(SvRV(rv)));
+
+UV
+compact_arenas()
+CODE:
+    RETVAL = sv_compact_arenas();
+OUTPUT:
+    RETVAL
+
+void
+heap_usage(SV *rv)
+    PROTOTYPE: \%
+CODE:
+    if (!(SvROK(rv) && SvTYPE(SvRV(rv)) == SVt_PVHV))
+	croak("Not a hash reference");
+    {
+	HV * const hv = MUTABLE_HV(SvRV(rv));
+	HV * const by_type = newHV();
+	HV * const by_package = newHV();
+	HV * const by_pad = newHV();
+	(void)hv_stores(hv, "type", newRV_noinc(MUTABLE_SV(by_type)));
+	(void)hv_stores(hv, "package", newRV_noinc(MUTABLE_SV(by_package)));
+	(void)hv_stores(hv, "pad", newRV_noinc(MUTABLE_SV(by_pad)));
+	sv_heap_usage(by_type, by_package, by_pad);
+    }
+
 void
 Dump(sv,lim=4)
 SV *	sv
@@ -1072,6 +1072,7 @@ unless ($Config{useithreads}) {
 
     eval 'index "", perl';
 
+    # Builds with SSE2 search for short strings without a Boyer-Moore table
     do_test('string constant now an FBM', perl,
 'SV = PVMG\\($ADDR\\) at $ADDR
   REFCNT = \d+
@@ -1083,11 +1084,11 @@ unless ($Config{useithreads}) {
   MAGIC = $ADDR
     MG_VIRTUAL = &PL_vtbl_regexp
     MG_TYPE = PERL_MAGIC_bm\\(B\\)
-    MG_LEN = 256
+(?:    MG_LEN = 256
     MG_PTR = $ADDR "(?:\\\\\d){256}"
   RARE = \d+					# $] < 5.019002
   PREVIOUS = 1					# $] < 5.019002
-  USEFUL = 100
+)?  USEFUL = 100
 ');
 
     is(study perl, '', "Not allowed to study an FBM");
@@ -1103,11 +1104,11 @@ unless ($Config{useithreads}) {
   MAGIC = $ADDR
     MG_VIRTUAL = &PL_vtbl_regexp
     MG_TYPE = PERL_MAGIC_bm\\(B\\)
-    MG_LEN = 256
+(?:    MG_LEN = 256
     MG_PTR = $ADDR "(?:\\\\\d){256}"
   RARE = \d+					# $] < 5.019002
   PREVIOUS = 1					# $] < 5.019002
-  USEFUL = 100
+)?  USEFUL = 100
 ');
 
     do_test('regular string constant', beer,
@@ -1143,11 +1144,11 @@ unless ($Config{useithreads}) {
   MAGIC = $ADDR
     MG_VIRTUAL = &PL_vtbl_regexp
     MG_TYPE = PERL_MAGIC_bm\\(B\\)
-    MG_LEN = 256
+(?:    MG_LEN = 256
     MG_PTR = $ADDR "(?:\\\\\d){256}"
   RARE = \d+					# $] < 5.019002
   PREVIOUS = \d+				# $] < 5.019002
-  USEFUL = 100
+)?  USEFUL = 100
 ';
 
     is (eval 'index "not too foamy", beer', 8, 'correct index');
@@ -1272,7 +1273,7 @@ do_test('Branch Reset regexp',
     COMPFLAGS = 0x0 \\(\\)
     EXTFLAGS = 0x0 \\(\\)
     ENGINE = $ADDR \\(STANDARD\\)
-    INTFLAGS = 0x0 \\(\\)
+    INTFLAGS = 0x8000 \\(LINEAR_OK\\)
     NPARENS = 4
     LOGICAL_NPARENS = 2
     LOGICAL_TO_PARNO = $ADDR
@@ -1308,7 +1309,7 @@ do_test('Branch Reset regexp',
       COMPFLAGS = 0x0 \\(\\)
       EXTFLAGS = 0x0 \\(\\)
       ENGINE = $ADDR \\(STANDARD\\)
-      INTFLAGS = 0x0 \\(\\)
+      INTFLAGS = 0x8000 \\(LINEAR_OK\\)
       NPARENS = 4
       LOGICAL_NPARENS = 2
       LOGICAL_TO_PARNO = $ADDR
@@ -1345,6 +1346,72 @@ do_test('Branch Reset regexp',
   is(Devel::Peek::SvREFCNT(%hash), $base_count + 1, "SvREFCNT on non-scalar");
   ok(!eval { &Devel::Peek::SvREFCNT(1) }, "requires prototype");
 }
+
+{ # arena statistics and compaction
+  my %before;
+  Devel::Peek::arena_stats(%before);
+  ok($before{SV}{arenas}, "arena_stats reports SV head arenas");
+  cmp_ok($before{SV}{bytes}, '>', $before{SV}{slots},
+         "arena_stats reports the memory used");
+
+  # Fill a few hundred fresh arenas, then free everything in them
+  my @spike = map { { key => "value $_" } } 1 .. 50_000;
+  my %during;
+  Devel::Peek::arena_stats(%during);
+  cmp_ok($during{SV}{arenas}, '>', $before{SV}{arenas},
+         "SV head arenas grow with the number of SVs");
+  cmp_ok($during{HE}{used}, '>=', 50_000, "hash entries counted");
+  undef @spike;
+
+  my $released = Devel::Peek::compact_arenas();
+  my %after;
+  Devel::Peek::arena_stats(%after);
+  cmp_ok($released, '>', 0, "compact_arenas released memory");
+  cmp_ok($after{SV}{arenas}, '<', $during{SV}{arenas},
+         "SV head arenas released");
+  cmp_ok($after{HE}{arenas}, '<', $during{HE}{arenas},
+         "hash entry arenas released");
+  cmp_ok($after{SV}{used}, '<', $during{SV}{used} - 100_000,
+         "SV heads in use fall back");
+
+  # The rebuilt free lists must still be usable
+  my @again = map { { key => "value $_" } } 1 .. 10_000;
+  is($again[-1]{key}, "value 10000", "allocation after compaction");
+  ok(!eval { &Devel::Peek::arena_stats(1); 1 }, "requires a hash");
+}
+
+{ # heap accounting
+  package Peek::Heap::Obj;
+  sub new { bless { data => "x" x 10_000 }, shift }
+  sub held { my @lexical = (1) x 5_000; Devel::Peek::heap_usage(%{$_[0]}) }
+  package main;
+
+  my @objs = map { Peek::Heap::Obj->new } 1 .. 10;
+  my %usage;
+  Peek::Heap::Obj::held(\%usage);
+  is($usage{package}{"Peek::Heap::Obj"}{count}, 10, "objects counted by package");
+  cmp_ok($usage{package}{"Peek::Heap::Obj"}{bytes}, '>', 0,
+         "object bodies counted");
+  cmp_ok($usage{type}{PV}{bytes} + ($usage{type}{PVIV}{bytes} // 0), '>', 100_000,
+         "string buffers counted by type");
+  cmp_ok($usage{type}{PVHV}{count}, '>=', 10, "hashes counted by type");
+  cmp_ok($usage{pad}{"Peek::Heap::Obj::held"}{bytes}, '>', 5_000 * 8,
+         "lexical array counted in its sub's pad");
+  ok($usage{pad}{"(main)"}, "main program pad counted");
+
+  my $snapshot = "";
+  open my $fh, '>', \$snapshot or die;
+  ok(Devel::Peek::heap_snapshot($fh), "heap_snapshot");
+  close $fh;
+  like($snapshot, qr/^package\tPeek::Heap::Obj\t10\t\d+$/m,
+       "heap_snapshot line format");
+  my @lines = split /\n/, $snapshot;
+  my @kinds = map { (split /\t/)[0] } @lines;
+  is_deeply([ grep { $_ ne 'type' && $_ ne 'package' && $_ ne 'pad' } @kinds ],
+            [], "only known kinds written");
+  my @type_names = map { (split /\t/)[1] } grep { /^type\t/ } @lines;
+  is_deeply(\@type_names, [ sort @type_names ], "heap_snapshot is sorted");
+}
 {
 # utf8 tests
 use utf8;
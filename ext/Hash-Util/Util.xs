@@ -311,6 +311,21 @@ num_buckets(rhv)
     XSRETURN_UNDEF;
 }
 
+void
+hash_split_stats(reset = FALSE)
+        bool reset
+    PPCODE:
+{
+    EXTEND(SP, 2);
+    mPUSHu(PL_hv_split_count);
+    mPUSHu(PL_hv_split_worst);
+    if (reset) {
+        PL_hv_split_count = 0;
+        PL_hv_split_worst = 0;
+    }
+    XSRETURN(2);
+}
+
 void
 used_buckets(rhv)
         SV* rhv
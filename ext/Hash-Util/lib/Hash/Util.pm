@@ -38,11 +38,12 @@ our @EXPORT_OK  = qw(
                      bucket_ratio
                      used_buckets
                      num_buckets
+                     hash_split_stats
                     );
 BEGIN {
     # make sure all our XS routines are available early so their prototypes
     # are correctly applied in the following code.
-    our $VERSION = '0.32';
+    our $VERSION = '0.33';
     require XSLoader;
     XSLoader::load();
 }
@@ -780,6 +781,20 @@ This function returns the total number of buckets the hash holds, or would
 hold if the array were created. (When a hash is freshly created the array
 may not be allocated even though this value will be non-zero.)
 
+=item B<hash_split_stats>
+
+  my ($splits, $worst) = hash_split_stats();
+  my ($splits, $worst) = hash_split_stats(1);   # and reset them
+
+Returns two numbers describing how the hashes in this interpreter have
+grown so far: how many times the bucket array of a hash has been split,
+and the largest number of entries a single split had to rehash.  The
+latter is a measure of the longest pause a store into a growing hash
+has caused.  If perl was built with C<-DPERL_HV_INCREMENTAL_SPLIT> (see
+F<INSTALL>), large hashes are split a few buckets at a time, and each of
+those steps counts as a split.  With a true argument both numbers are
+reset to zero after being returned.
+
 =back
 
 =head2 Operating on references to hashes
@@ -45,8 +45,9 @@ BEGIN {
                      hv_store
                      lock_hash_recurse unlock_hash_recurse
                      lock_hashref_recurse unlock_hashref_recurse
+                     hash_split_stats
                     );
-    plan tests => 250 + @Exported_Funcs;
+    plan tests => 258 + @Exported_Funcs;
     use_ok 'Hash::Util', @Exported_Funcs;
 }
 foreach my $func (@Exported_Funcs) {
@@ -634,3 +635,36 @@ ok(defined($hash_seed) && $hash_seed ne '', "hash_seed $hash_seed");
     is("@keys1","");
     is("@keys2","1 3 5 7 9");
 }
+
+{
+    my ($splits, undef, @after) = (hash_split_stats(1), hash_split_stats());
+    cmp_ok($splits, '>', 0, 'hash_split_stats counts splits');
+    is("@after", "0 0", 'hash_split_stats(1) resets the statistics');
+
+    hash_split_stats(1);
+    my %h;
+    $h{$_} = $_ for 1..50_000;
+    my ($count, $worst) = hash_split_stats();
+    cmp_ok($count, '>=', 13, 'growing a hash to 64K buckets splits it');
+    # a split from 32K to 64K buckets rehashes 21845 entries at once,
+    # unless hashes that large are split incrementally
+    if ((Internals::V())[0] =~ /\bPERL_HV_INCREMENTAL_SPLIT\b/) {
+        cmp_ok($worst, '<', 21845, 'incremental split bounds the worst split');
+    }
+    else {
+        cmp_ok($worst, '>=', 21845, 'worst split rehashed the whole hash');
+    }
+
+    is(scalar(grep { $h{$_} == $_ } 1..50_000), 50_000,
+       'all keys found after splitting');
+    delete $h{$_} for grep { $_ % 3 } 1..50_000;
+    $h{"x$_"} = 1 for 1..30_000;
+    is(scalar(keys %h), 16_666 + 30_000, 'key count after deletes and stores');
+    my ($seen, $ok) = (0, 0);
+    while (my ($k, $v) = each %h) {
+        $seen++;
+        $ok++ if exists $h{$k} && exists $h{"x1"} && !exists $h{"1"};
+    }
+    is($seen, 16_666 + 30_000, 'each sees every key once while looking up');
+    is($ok, $seen, '... and lookups inside the loop work');
+}
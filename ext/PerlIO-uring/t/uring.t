@@ -0,0 +1,135 @@
+#!./perl
+
+BEGIN {
+    unless (find PerlIO::Layer 'perlio') {
+	print "1..0 # No perlio\n";
+	exit 0;
+    }
+}
+
+use strict;
+use warnings;
+use Config;
+use Fcntl qw(SEEK_SET SEEK_CUR SEEK_END);
+use Test::More tests => 28;
+
+my $file = "uring$$.txt";
+my $copy = "uring$$.out";
+END { 1 while unlink $file, $copy }
+
+# Bigger than all the read-ahead put together, and not a multiple of it
+my $data = join "", map "line $_ " . ("x" x ($_ % 71)) . "\n", 1 .. 20000;
+{
+    open my $fh, ">:raw", $file or die "$file: $!";
+    print $fh $data;
+    close $fh or die "$file: $!";
+}
+
+sub slurp {
+    my ($fh) = @_;
+    local $/;
+    return scalar readline $fh;
+}
+
+{
+    ok(open(my $fh, "<:uring:perlio", $file), "open with :uring:perlio");
+    is(join(" ", PerlIO::get_layers($fh)), "unix uring perlio",
+       ":uring sits on :unix");
+    my $lines = 0;
+    my $got = "";
+    while (my $line = <$fh>) {
+        $got .= $line;
+        $lines++;
+    }
+    is($lines, 20000, "read line by line");
+    ok($got eq $data, "the contents");
+    ok(eof($fh), "at end of file");
+    ok(close($fh), "close");
+}
+
+{
+    open my $fh, "<:uring", $file or die "$file: $!";
+    is(join(" ", PerlIO::get_layers($fh)), "unix uring", "unbuffered");
+    my ($got, $buf) = ("");
+    while (read($fh, $buf, 3000)) {
+        $got .= $buf;
+    }
+    ok($got eq $data, "read in odd sized pieces");
+}
+
+{
+    open my $fh, "<:uring:perlio", $file or die "$file: $!";
+    scalar <$fh>;
+    is(tell($fh), length("line 1 x\n"), "tell after a line");
+    ok(seek($fh, 200_000, SEEK_SET), "seek forward");
+    is(tell($fh), 200_000, "tell after seek");
+    read($fh, my $buf, 50);
+    is($buf, substr($data, 200_000, 50), "read after seek");
+    ok(seek($fh, -100, SEEK_CUR), "relative seek back");
+    read($fh, $buf, 50);
+    is($buf, substr($data, 199_950, 50), "read after relative seek");
+    ok(seek($fh, -10, SEEK_END), "seek from end");
+    is(slurp($fh), substr($data, -10), "read to end");
+    ok(seek($fh, 0, SEEK_SET), "back to the start");
+    ok(slurp($fh) eq $data, "whole file again");
+}
+
+SKIP: {
+    skip "no Encode", 2 unless eval { require Encode };
+    open my $fh, "<:uring:perlio:encoding(UTF-8)", $file
+        or die "$file: $!";
+    is(join(" ", PerlIO::get_layers($fh)),
+       "unix uring perlio encoding(utf-8-strict) utf8", "under :encoding");
+    ok(slurp($fh) eq $data, "read through :encoding");
+}
+
+{
+    open my $out, ">:uring:perlio", $copy or die "$copy: $!";
+    print $out $data for 1 .. 3;
+    ok(close($out), "close after writing");
+    open my $in, "<:raw", $copy or die "$copy: $!";
+    ok(slurp($in) eq $data x 3, "what was written");
+}
+
+{
+    open my $fh, "+<:uring:perlio", $copy or die "$copy: $!";
+    seek($fh, 10, SEEK_SET);
+    print $fh "OVERWRITE";
+    seek($fh, 0, SEEK_SET);
+    read($fh, my $buf, 30);
+    is($buf, substr($data, 0, 10) . "OVERWRITE" . substr($data, 19, 11),
+       "read back a write in read/write mode");
+    close $fh;
+}
+
+{
+    open my $out, ">>:uring:perlio", $copy or die "$copy: $!";
+    print $out "appended\n";
+    close $out;
+    ok(-s $copy == 3 * length($data) + 9, "append mode");
+}
+
+SKIP: {
+    skip "no fork", 2 unless $Config{d_fork};
+    open my $fh, "<:uring:perlio", $file or die "$file: $!";
+    scalar <$fh>;
+    my $pid = open my $kid, "-|";
+    die "fork: $!" unless defined $pid;
+    unless ($pid) {
+        print length slurp($fh);
+        exit 0;
+    }
+    my $n = <$kid>;
+    close $kid;
+    is($n, length($data) - length("line 1 x\n"), "a child reads on");
+    is(length(slurp($fh)), length($data) - length("line 1 x\n"),
+       "and so does the parent");
+}
+
+{
+    pipe my $r, my $w or die "pipe: $!";
+    ok(binmode($r, ":pop:uring:perlio"), "a pipe is read through :unix");
+    print $w "one\ntwo\n";
+    close $w;
+    is(join("", <$r>), "one\ntwo\n", "read from the pipe");
+}
@@ -0,0 +1,62 @@
+package PerlIO::uring;
+use strict;
+use warnings;
+our $VERSION = '0.001';
+
+use XSLoader;
+XSLoader::load(__PACKAGE__, __PACKAGE__->VERSION);
+
+1;
+
+__END__
+
+=head1 NAME
+
+PerlIO::uring - io_uring backed IO for regular files
+
+=head1 SYNOPSIS
+
+ open my $in, '<:uring:perlio', $filename;
+ open my $out, '>:uring:perlio:bufsize(65536)', $copy;
+ open my $text, '<:uring:perlio:encoding(UTF-8)', $document;
+
+=head1 DESCRIPTION
+
+The C<:uring> layer takes the place of the system calls made by the
+C<:unix> layer beneath it.  On Linux, for a regular file, it uses an
+io_uring to keep several reads ahead of the position the handle has
+reached, and hands writes to the kernel without waiting for them to
+complete, so that the disk works while Perl processes the data.  Other
+layers, such as C<:perlio> and C<:encoding>, go on top of it as they would
+on C<:unix>.
+
+Like C<:unix>, C<:uring> opens the file itself and ignores any layers
+named before it, so put it first.  It can only be pushed with C<binmode>
+directly on a C<:unix> layer.
+
+On a pipe, socket or terminal, for a file opened for appending, on a
+kernel without io_uring (or which does not allow it), and on other
+systems, the layer passes everything straight to C<:unix>.
+
+=head1 CAVEATS
+
+A flush hands the data written so far to the kernel but does not wait
+for it to reach the file; C<close>, C<seek> and reading from the handle
+do.  An error from a write is reported by the next operation on the
+handle, at the latest by C<close>.
+
+The position of the file descriptor can lag behind that of the handle
+until the handle is seeked, duplicated or closed, so a child process
+sharing the descriptor should not expect to carry on from where the
+parent got to.  Using C<sysread>, C<sysseek> or C<syswrite> on the same
+handle mixes badly with it, as it does with any buffering layer.
+
+Each handle which has read or written uses an io_uring instance and
+four 64KB buffers, which are released when it is closed.
+
+=head1 IMPLEMENTATION NOTE
+
+C<PerlIO::uring> only exists to use XSLoader to load C code that provides
+the layer.  One does not need to explicitly C<use PerlIO::uring;>.
+
+=cut
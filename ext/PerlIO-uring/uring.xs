@@ -0,0 +1,690 @@
+/*
+ * ex: set ts=8 sts=4 sw=4 et:
+ */
+
+#define PERL_NO_GET_CONTEXT
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#ifdef PERLIO_LAYERS
+
+#include "perliol.h"
+
+/*
+ * The ring is driven with the raw system calls rather than liburing, so
+ * all we need are the kernel headers.  IORING_FEAT_RW_CUR_POS arrived
+ * with IORING_OP_READ and IORING_OP_WRITE in Linux 5.6.
+ */
+#if defined(__linux__) && defined(__GNUC__) && defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#    include <linux/io_uring.h>
+#    include <sys/syscall.h>
+#    include <sys/mman.h>
+#    include <pthread.h>
+#    if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) \
+     && defined(IORING_FEAT_RW_CUR_POS)
+#      define HAS_IO_URING
+#    endif
+#  endif
+#endif
+
+/* Number of reads or writes kept in flight, and the size of each */
+#ifndef PERLIO_URING_DEPTH
+#  define PERLIO_URING_DEPTH 4
+#endif
+#ifndef PERLIO_URING_SLOTSIZE
+#  define PERLIO_URING_SLOTSIZE (64 * 1024)
+#endif
+
+/*
+ * io_uring as a layer on top of :unix
+ *
+ * On a regular file, reads are issued ahead of the position the handle
+ * has reached, and writes are handed to the kernel without waiting for
+ * them, both at explicit offsets.  The layer keeps the logical position
+ * itself; the descriptor's own offset is only brought into line when the
+ * handle is seeked, duplicated or closed.  Anything else (pipes, sockets,
+ * terminals, append mode, or a kernel which refuses us a ring) is passed
+ * straight down to :unix.
+ */
+
+typedef struct {
+    STDCHAR *buf;
+    Off_t off;                  /* File offset of buf[0] */
+    Size_t len;                 /* Bytes asked for, 0 if the slot is free */
+    Size_t done;                /* Bytes read, or written so far */
+    int err;                    /* errno of a failed read */
+    bool busy;                  /* Submitted and not yet completed */
+} PerlIOUring_slot;
+
+typedef struct {
+    struct _PerlIO base;        /* Base "class" info */
+    int fd;                     /* Descriptor of the :unix layer below */
+    bool async;                 /* Regular file, use the ring */
+#ifdef HAS_IO_URING
+    bool writing;               /* Slots hold writes, not read-ahead */
+    Off_t posn;                 /* Logical position */
+    Off_t ahead;                /* Where the next read-ahead starts */
+    int head;                   /* Slot holding posn when reading */
+    int inflight;
+    int tosubmit;
+    int werr;                   /* errno of a write not yet reported */
+    unsigned forks;             /* uring_forks when the ring was made */
+    int ringfd;                 /* -1 until first used */
+    void *sq_map;
+    size_t sq_len;
+    void *cq_map;
+    size_t cq_len;
+    struct io_uring_sqe *sqes;
+    size_t sqes_len;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+    PerlIOUring_slot slot[PERLIO_URING_DEPTH];
+#endif
+} PerlIOUring;
+
+#ifdef HAS_IO_URING
+
+/* A child process shares the ring's memory with its parent, whose
+ * completions it must not take.  Rings made before the latest fork()
+ * are dropped rather than used. */
+static unsigned uring_forks;
+
+static void
+S_uring_atfork_child(void)
+{
+    uring_forks++;
+}
+
+#define RING_MINE(u) ((u)->ringfd >= 0 && (u)->forks == uring_forks)
+
+static void
+S_ring_free(PerlIOUring *u)
+{
+    int i;
+    if (u->sqes)
+        munmap(u->sqes, u->sqes_len);
+    if (u->cq_map && u->cq_map != u->sq_map)
+        munmap(u->cq_map, u->cq_len);
+    if (u->sq_map)
+        munmap(u->sq_map, u->sq_len);
+    u->sqes = NULL;
+    u->sq_map = u->cq_map = NULL;
+    if (u->ringfd >= 0)
+        PerlLIO_close(u->ringfd);
+    u->ringfd = -1;
+    for (i = 0; i < PERLIO_URING_DEPTH; i++) {
+        Safefree(u->slot[i].buf);
+        u->slot[i].buf = NULL;
+        u->slot[i].len = 0;
+        u->slot[i].busy = FALSE;
+    }
+    u->inflight = u->tosubmit = 0;
+    u->head = 0;
+    u->ahead = u->posn;
+}
+
+/* Set up the ring on first use.  Returns false if we can't have one. */
+
+static bool
+S_ring_ready(pTHX_ PerlIOUring *u)
+{
+    struct io_uring_params p;
+    int fd;
+    int i;
+
+    if (RING_MINE(u))
+        return TRUE;
+    if (u->ringfd >= 0)
+        S_ring_free(u);         /* inherited over a fork() */
+
+    Zero(&p, 1, struct io_uring_params);
+    fd = (int)syscall(__NR_io_uring_setup, PERLIO_URING_DEPTH, &p);
+    if (fd < 0)
+        return FALSE;
+    u->ringfd = fd;
+    u->forks = uring_forks;
+    u->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    u->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (u->cq_len > u->sq_len)
+            u->sq_len = u->cq_len;
+        u->cq_len = u->sq_len;
+    }
+    u->sq_map = mmap(NULL, u->sq_len, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (u->sq_map == MAP_FAILED) {
+        u->sq_map = NULL;
+        goto fail;
+    }
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        u->cq_map = u->sq_map;
+    else {
+        u->cq_map = mmap(NULL, u->cq_len, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (u->cq_map == MAP_FAILED) {
+            u->cq_map = NULL;
+            goto fail;
+        }
+    }
+    u->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+    u->sqes = (struct io_uring_sqe *)mmap(NULL, u->sqes_len,
+                                          PROT_READ | PROT_WRITE,
+                                          MAP_SHARED | MAP_POPULATE, fd,
+                                          IORING_OFF_SQES);
+    if ((void *)u->sqes == MAP_FAILED) {
+        u->sqes = NULL;
+        goto fail;
+    }
+    u->sq_tail  = (unsigned *)((char *)u->sq_map + p.sq_off.tail);
+    u->sq_mask  = (unsigned *)((char *)u->sq_map + p.sq_off.ring_mask);
+    u->sq_array = (unsigned *)((char *)u->sq_map + p.sq_off.array);
+    u->cq_head  = (unsigned *)((char *)u->cq_map + p.cq_off.head);
+    u->cq_tail  = (unsigned *)((char *)u->cq_map + p.cq_off.tail);
+    u->cq_mask  = (unsigned *)((char *)u->cq_map + p.cq_off.ring_mask);
+    u->cqes = (struct io_uring_cqe *)((char *)u->cq_map + p.cq_off.cqes);
+    for (i = 0; i < PERLIO_URING_DEPTH; i++)
+        Newx(u->slot[i].buf, PERLIO_URING_SLOTSIZE, STDCHAR);
+    return TRUE;
+
+  fail:
+    S_ring_free(u);
+    return FALSE;
+}
+
+/* Queue the rest of the transfer for a slot */
+
+static void
+S_queue(PerlIOUring *u, int i)
+{
+    PerlIOUring_slot * const s = &u->slot[i];
+    const unsigned tail = *u->sq_tail;  /* only we move the tail */
+    const unsigned idx = tail & *u->sq_mask;
+    struct io_uring_sqe * const sqe = &u->sqes[idx];
+
+    Zero(sqe, 1, struct io_uring_sqe);
+    sqe->opcode = u->writing ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe->fd = u->fd;
+    sqe->off = (__u64)(s->off + s->done);
+    sqe->addr = (__u64)PTR2nat(s->buf + s->done);
+    sqe->len = (__u32)(s->len - s->done);
+    sqe->user_data = (__u64)i;
+    u->sq_array[idx] = idx;
+    __atomic_store_n(u->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    s->busy = TRUE;
+    u->inflight++;
+    u->tosubmit++;
+}
+
+/* Submit what has been queued and, if wait, block until something
+ * completes */
+
+static int
+S_enter(PerlIOUring *u, bool wait)
+{
+    do {
+        const int got = (int)syscall(__NR_io_uring_enter, u->ringfd,
+                                     u->tosubmit, wait ? 1 : 0,
+                                     wait ? IORING_ENTER_GETEVENTS : 0,
+                                     NULL, (size_t)0);
+        if (got >= 0) {
+            u->tosubmit -= got;
+            wait = FALSE;
+        }
+        /* Only regular files get here, so a wait is short: retry and
+           leave any signal to be dispatched between ops as usual */
+        else if (errno != EINTR)
+            return -1;
+    } while (u->tosubmit || wait);
+    return 0;
+}
+
+/* Take the completions the kernel has posted */
+
+static int
+S_reap(PerlIOUring *u)
+{
+    unsigned head = *u->cq_head;
+    const unsigned tail = __atomic_load_n(u->cq_tail, __ATOMIC_ACQUIRE);
+
+    while (head != tail) {
+        const struct io_uring_cqe * const cqe = &u->cqes[head & *u->cq_mask];
+        const int i = (int)cqe->user_data;
+        PerlIOUring_slot * const s = &u->slot[i];
+        const int res = cqe->res;
+        head++;
+        s->busy = FALSE;
+        u->inflight--;
+        if (!u->writing) {
+            if (res < 0)
+                s->err = -res;
+            else
+                s->done = res;
+        }
+        else if (res <= 0) {
+            if (!u->werr)
+                u->werr = res ? -res : ENOSPC;
+            s->len = 0;
+        }
+        else if ((s->done += res) < s->len)
+            S_queue(u, i);              /* short write, carry on */
+        else
+            s->len = 0;
+    }
+    __atomic_store_n(u->cq_head, head, __ATOMIC_RELEASE);
+    return u->tosubmit ? S_enter(u, FALSE) : 0;
+}
+
+/* Wait for everything in flight and forget any read-ahead */
+
+static int
+S_drain(PerlIOUring *u)
+{
+    int i;
+    while (u->inflight) {
+        if (S_enter(u, TRUE) != 0 || S_reap(u) != 0)
+            return -1;
+    }
+    for (i = 0; i < PERLIO_URING_DEPTH; i++)
+        u->slot[i].len = 0;
+    u->head = 0;
+    u->ahead = u->posn;
+    return 0;
+}
+
+/* Report a failed write, once */
+
+static IV
+S_werr(pTHX_ PerlIO *f)
+{
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    if (!u->werr)
+        return 0;
+    SETERRNO(u->werr, LIB_INVARG);
+    u->werr = 0;
+    PerlIOBase(f)->flags |= PERLIO_F_ERROR;
+    Perl_PerlIO_save_errno(aTHX_ f);
+    return -1;
+}
+
+/* Give up on the ring: carry on as plain :unix from where we are */
+
+static void
+S_sync(pTHX_ PerlIO *f)
+{
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    if (RING_MINE(u))
+        S_drain(u);
+    if (u->ringfd >= 0)
+        S_ring_free(u);
+    u->async = FALSE;
+    PerlLIO_lseek(u->fd, u->posn, SEEK_SET);
+}
+
+static int
+S_io_error(pTHX_ PerlIO *f)
+{
+    PerlIOBase(f)->flags |= PERLIO_F_ERROR;
+    Perl_PerlIO_save_errno(aTHX_ f);
+    return -1;
+}
+
+#endif /* HAS_IO_URING */
+
+static IV
+PerlIOUring_pushed(pTHX_ PerlIO *f, const char *mode, SV *arg, PerlIO_funcs *tab)
+{
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    PerlIO * const n = PerlIONext(f);
+    IV code;
+
+    /* We replace the system calls of the layer below, so it has to
+       be an unbuffered one with a descriptor, i.e. :unix */
+    if (!PerlIOValid(n) || PerlIOBase(n)->tab->kind & PERLIO_K_BUFFERED
+        || PerlIO_fileno(n) < 0) {
+        SETERRNO(EINVAL, LIB_INVARG);
+        return -1;
+    }
+    code = PerlIOBase_pushed(aTHX_ f, mode, arg, tab);
+    u->fd = PerlIO_fileno(n);
+    u->async = FALSE;
+#ifdef HAS_IO_URING
+    u->ringfd = -1;
+    {
+        Stat_t st;
+        const int fl = fcntl(u->fd, F_GETFL);
+        if (fl != -1 && !(fl & O_APPEND)
+            && PerlLIO_fstat(u->fd, &st) == 0 && S_ISREG(st.st_mode)) {
+            const Off_t posn = PerlLIO_lseek(u->fd, 0, SEEK_CUR);
+            if (posn != (Off_t)-1) {
+                u->posn = u->ahead = posn;
+                u->async = TRUE;
+            }
+        }
+    }
+#endif
+    return code;
+}
+
+static IV
+PerlIOUring_popped(pTHX_ PerlIO *f)
+{
+#ifdef HAS_IO_URING
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    if (u->async)
+        S_sync(aTHX_ f);
+#endif
+    return PerlIOBase_popped(aTHX_ f);
+}
+
+static PerlIO *
+PerlIOUring_open(pTHX_ PerlIO_funcs *self, PerlIO_list_t *layers,
+                 IV n, const char *mode, int fd, int imode, int perm,
+                 PerlIO *f, int narg, SV **args)
+{
+    /* Like :unix we ignore whatever is below us in the list: the file is
+       always opened by :unix, with us directly on top */
+    PerlIO_funcs * const tab = PerlIO_find_layer(aTHX_ STR_WITH_LEN("unix"), 0);
+    if (!tab || !tab->Open) {
+        SETERRNO(EINVAL, LIB_INVARG);
+        return NULL;
+    }
+    f = (*tab->Open)(aTHX_ tab, layers, n, mode, fd, imode, perm, f, narg, args);
+    if (f && !PerlIO_push(aTHX_ f, self, mode, PerlIOArg)) {
+        PerlIO_close(f);
+        return NULL;
+    }
+    return f;
+}
+
+static PerlIO *
+PerlIOUring_dup(pTHX_ PerlIO *f, PerlIO *o, CLONE_PARAMS *param, int flags)
+{
+#ifdef HAS_IO_URING
+    PerlIOUring * const ou = PerlIOSelf(o, PerlIOUring);
+    /* Let the copy pick up the position from the descriptor */
+    if (ou->async && RING_MINE(ou))
+        S_drain(ou);
+    if (ou->async)
+        PerlLIO_lseek(ou->fd, ou->posn, SEEK_SET);
+#endif
+    return PerlIOBase_dup(aTHX_ f, o, param, flags);
+}
+
+static SSize_t
+PerlIOUring_read(pTHX_ PerlIO *f, void *vbuf, Size_t count)
+{
+#ifdef HAS_IO_URING
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+#endif
+    if (!(PerlIOBase(f)->flags & PERLIO_F_CANREAD) ||
+         PerlIOBase(f)->flags & (PERLIO_F_EOF|PERLIO_F_ERROR)) {
+        return 0;
+    }
+#ifdef HAS_IO_URING
+    if (u->async && !S_ring_ready(aTHX_ u))
+        S_sync(aTHX_ f);
+    if (u->async) {
+        PerlIOUring_slot *s;
+        Size_t avail;
+        if (u->writing) {
+            if (S_drain(u) != 0)
+                return S_io_error(aTHX_ f);
+            u->writing = FALSE;
+            if (S_werr(aTHX_ f) != 0)
+                return -1;
+        }
+        s = &u->slot[u->head];
+        if (!s->len) {
+            /* Start the read-ahead from where we are */
+            int i;
+            for (i = 0; i < PERLIO_URING_DEPTH; i++) {
+                PerlIOUring_slot * const r = &u->slot[i];
+                r->off = u->ahead;
+                r->len = PERLIO_URING_SLOTSIZE;
+                r->done = 0;
+                r->err = 0;
+                u->ahead += PERLIO_URING_SLOTSIZE;
+                S_queue(u, i);
+            }
+        }
+        while (s->busy) {
+            if (S_enter(u, TRUE) != 0 || S_reap(u) != 0)
+                return S_io_error(aTHX_ f);
+        }
+        if (s->err) {
+            const int err = s->err;
+            S_drain(u);
+            SETERRNO(err, LIB_INVARG);
+            return S_io_error(aTHX_ f);
+        }
+        avail = s->off + s->done - u->posn;
+        if (!avail) {
+            /* End of file, for now: the next read looks again */
+            S_drain(u);
+            if (count) {
+                PerlIOBase(f)->flags |= PERLIO_F_EOF;
+                SETERRNO(0,0);
+            }
+            return 0;
+        }
+        if (count > avail)
+            count = avail;
+        Copy(s->buf + (u->posn - s->off), vbuf, count, STDCHAR);
+        u->posn += count;
+        if (u->posn == s->off + (Off_t)s->done) {
+            if (s->done < s->len) {
+                /* A short read is the end of the file; anything read
+                   beyond it is not to be trusted if the file grows */
+                S_drain(u);
+            }
+            else {
+                /* Reuse the slot at the far end of the read-ahead */
+                s->off = u->ahead;
+                s->done = 0;
+                u->ahead += PERLIO_URING_SLOTSIZE;
+                S_queue(u, u->head);
+                u->head = (u->head + 1) % PERLIO_URING_DEPTH;
+                if (S_enter(u, FALSE) != 0)
+                    return S_io_error(aTHX_ f);
+            }
+        }
+        return count;
+    }
+#endif
+    {
+        PerlIO * const n = PerlIONext(f);
+        const SSize_t got = PerlIO_read(n, vbuf, count);
+        if (got == 0 && count)
+            PerlIOBase(f)->flags |= PERLIO_F_EOF;
+        else if (got < 0 && PerlIO_error(n))
+            PerlIOBase(f)->flags |= PERLIO_F_ERROR;
+        return got;
+    }
+}
+
+static SSize_t
+PerlIOUring_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
+{
+#ifdef HAS_IO_URING
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    if (u->async && !S_ring_ready(aTHX_ u))
+        S_sync(aTHX_ f);
+    if (u->async && count) {
+        PerlIOUring_slot *s = NULL;
+        int i;
+        if (!u->writing) {
+            if (S_drain(u) != 0)
+                return S_io_error(aTHX_ f);
+            u->writing = TRUE;
+        }
+        for (;;) {
+            if (S_werr(aTHX_ f) != 0)
+                return -1;
+            for (i = 0; i < PERLIO_URING_DEPTH; i++) {
+                if (!u->slot[i].len) {
+                    s = &u->slot[i];
+                    break;
+                }
+            }
+            if (s)
+                break;
+            /* All in flight, wait for one to finish */
+            if (S_enter(u, TRUE) != 0 || S_reap(u) != 0)
+                return S_io_error(aTHX_ f);
+        }
+        if (count > PERLIO_URING_SLOTSIZE)
+            count = PERLIO_URING_SLOTSIZE;
+        Copy(vbuf, s->buf, count, STDCHAR);
+        s->off = u->posn;
+        s->len = count;
+        s->done = 0;
+        S_queue(u, i);
+        if (S_enter(u, FALSE) != 0)
+            return S_io_error(aTHX_ f);
+        u->posn += count;
+        return count;
+    }
+#endif
+    {
+        PerlIO * const n = PerlIONext(f);
+        const SSize_t done = PerlIO_write(n, vbuf, count);
+        if (done < 0 && PerlIO_error(n))
+            PerlIOBase(f)->flags |= PERLIO_F_ERROR;
+        return done;
+    }
+}
+
+static IV
+PerlIOUring_seek(pTHX_ PerlIO *f, Off_t offset, int whence)
+{
+#ifdef HAS_IO_URING
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    if (u->async) {
+        Off_t posn;
+        if (RING_MINE(u) && S_drain(u) != 0)
+            return S_io_error(aTHX_ f);
+        if (S_werr(aTHX_ f) != 0)
+            return -1;
+        if (whence == SEEK_CUR) {
+            offset += u->posn;
+            whence = SEEK_SET;
+        }
+        posn = PerlLIO_lseek(u->fd, offset, whence);
+        if (posn == (Off_t)-1)
+            return -1;
+        u->posn = u->ahead = posn;
+        PerlIOBase(f)->flags &= ~PERLIO_F_EOF;
+        return 0;
+    }
+#endif
+    {
+        const IV code = PerlIO_seek(PerlIONext(f), offset, whence);
+        if (code == 0)
+            PerlIOBase(f)->flags &= ~PERLIO_F_EOF;
+        return code;
+    }
+}
+
+static Off_t
+PerlIOUring_tell(pTHX_ PerlIO *f)
+{
+#ifdef HAS_IO_URING
+    const PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    if (u->async)
+        return u->posn;
+#endif
+    return PerlIO_tell(PerlIONext(f));
+}
+
+static IV
+PerlIOUring_flush(pTHX_ PerlIO *f)
+{
+#ifdef HAS_IO_URING
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    /* Writes have all been submitted; don't wait for them here, as the
+       layer above flushes us every time it empties its buffer */
+    if (u->async && u->writing && RING_MINE(u) && S_reap(u) != 0)
+        return S_io_error(aTHX_ f);
+    return S_werr(aTHX_ f);
+#else
+    PERL_UNUSED_ARG(f);
+    return 0;
+#endif
+}
+
+static IV
+PerlIOUring_close(pTHX_ PerlIO *f)
+{
+    IV code = 0;
+#ifdef HAS_IO_URING
+    PerlIOUring * const u = PerlIOSelf(f, PerlIOUring);
+    if (u->async) {
+        if (RING_MINE(u) && S_drain(u) != 0)
+            code = S_io_error(aTHX_ f);
+        if (S_werr(aTHX_ f) != 0)
+            code = -1;
+        S_sync(aTHX_ f);
+    }
+#endif
+    if (PerlIOBase_close(aTHX_ f) != 0)
+        code = -1;
+    return code;
+}
+
+static PERLIO_FUNCS_DECL(PerlIO_uring) = {
+    sizeof(PerlIO_funcs),
+    "uring",
+    sizeof(PerlIOUring),
+    PERLIO_K_RAW,
+    PerlIOUring_pushed,
+    PerlIOUring_popped,
+    PerlIOUring_open,
+    PerlIOBase_binmode,         /* binmode */
+    NULL,
+    PerlIOBase_fileno,
+    PerlIOUring_dup,
+    PerlIOUring_read,
+    PerlIOBase_unread,
+    PerlIOUring_write,
+    PerlIOUring_seek,
+    PerlIOUring_tell,
+    PerlIOUring_close,
+    PerlIOUring_flush,
+    PerlIOBase_noop_fail,       /* fill */
+    PerlIOBase_eof,
+    PerlIOBase_error,
+    PerlIOBase_clearerr,
+    PerlIOBase_setlinebuf,
+    NULL,                       /* get_base */
+    NULL,                       /* get_bufsiz */
+    NULL,                       /* get_ptr */
+    NULL,                       /* get_cnt */
+    NULL,                       /* set_ptrcnt */
+};
+
+#endif /* Layers available */
+
+MODULE = PerlIO::uring	PACKAGE = PerlIO::uring
+
+PROTOTYPES: DISABLE
+
+BOOT:
+{
+#ifdef PERLIO_LAYERS
+#  ifdef HAS_IO_URING
+    static bool atfork_done;
+    if (!atfork_done) {
+        pthread_atfork(NULL, NULL, S_uring_atfork_child);
+        atfork_done = TRUE;
+    }
+#  endif
+    PerlIO_define_layer(aTHX_ PERLIO_FUNCS_CAST(&PerlIO_uring));
+#endif
+}
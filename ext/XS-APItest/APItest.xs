@@ -2042,6 +2042,23 @@ store_ent(hash, key, value)
         OUTPUT:
         RETVAL
 
+void
+build_from_pairs(hash, ...)
+        PREINIT:
+        SV **pairs;
+        SSize_t i, npairs;
+        INPUT:
+        HV *hash
+        CODE:
+        npairs = (items - 1) / 2;
+        Newx(pairs, npairs * 2, SV *);
+        for (i = 0; i < npairs; i++) {
+            pairs[2 * i] = ST(2 * i + 1);
+            pairs[2 * i + 1] = SvOK(ST(2 * i + 2)) ? newSVsv(ST(2 * i + 2)) : NULL;
+        }
+        hv_build_from_pairs(hash, pairs, npairs);
+        Safefree(pairs);
+
 SV *
 store(hash, key_sv, value)
         PREINIT:
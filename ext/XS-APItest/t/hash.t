@@ -345,6 +345,36 @@ pass("hv_store works on the hint hash");
        "hv_delete_ent never triggered a use-after free, but test it anyway");
 }
 
+{
+    my @pairs = map { ("k$_" => $_) } 1..1000;
+    my %h;
+    XS::APItest::Hash::build_from_pairs(\%h, @pairs);
+    is_deeply(\%h, { @pairs }, "hv_build_from_pairs into an empty hash");
+
+    my %more = (k1 => "old", other => "kept");
+    XS::APItest::Hash::build_from_pairs(\%more, k1 => "a", k2 => "b",
+                                        k1 => "c", k3 => undef);
+    is_deeply(\%more, { k1 => "c", k2 => "b", k3 => undef, other => "kept" },
+              "existing keys are kept, and the last duplicate wins");
+
+    # keys from another hash are shared, and hv_common() has to rehash
+    # UTF-8 and numeric keys itself
+    my %src = ("sh\x{e9}" => 1, "wide\x{100}" => 2);
+    my $down = "\x{e9}";
+    utf8::upgrade($down);
+    my %h2;
+    XS::APItest::Hash::build_from_pairs(\%h2, (map { ($_ => $src{$_}) } keys %src),
+                                        $down => 3, 42 => 4);
+    is_deeply(\%h2, { "sh\x{e9}" => 1, "wide\x{100}" => 2, "\x{e9}" => 3,
+                      42 => 4 }, "shared, UTF-8 and numeric keys");
+    ok(exists $h2{"\x{e9}"}, "downgradable UTF-8 key found as bytes");
+
+    my %tied;
+    my $obj = tie %tied, 'Tie::StdHash';
+    XS::APItest::Hash::build_from_pairs(\%tied, a => 1, b => 2);
+    is_deeply({ %$obj }, { a => 1, b => 2 }, "stores into a tied hash");
+}
+
 done_testing;
 exit;
 
@@ -123,6 +123,37 @@ for my $bit_pattern (1 .. (1 << $word_length) - 1) {
                         "$display_string contains $expected_count variants");
 }
 
+# Longer strings, to go through the vectorized code where the platform has
+# it, which handles 16 bytes at a time, in runs of up to 255 of them.
+for my $repeat (2, 40, 500) {
+    for my $lead (0 .. 3) {
+        my $string = "x" x $lead
+                   . ("a" . chr(0xE9) . chr(0x20AC) . chr(0x1F600) . "bc")
+                   x $repeat;
+        my $bytes = $string;
+        utf8::encode($bytes);
+        my $desc = "$repeat repeats after $lead invariants";
+
+        is(test_utf8_length($bytes, 0, length $bytes), length $string,
+           "utf8_length, $desc");
+        next unless isASCII;
+        my $variants = grep { ord $_ > 127 } split //, $bytes;
+        is(test_variant_under_utf8_count($bytes, 0, length $bytes), $variants,
+           "variant_under_utf8_count, $desc");
+    }
+
+    my $invariants = "x" x (20 * $repeat);
+    for my $pos (0, 1, 15, 16, 17, length($invariants) - 1) {
+        my $test_string = $invariants;
+        substr($test_string, $pos, 1) = $variant;
+        my $ret_ref = test_is_utf8_invariant_string_loc($test_string, 0,
+                                                        length $test_string);
+        is($ret_ref->[1], $pos,
+           "is_utf8_invariant_string_loc finds variant at $pos of "
+         . length $test_string);
+    }
+}
+
 
 my $pound_sign = chr utf8::unicode_to_native(163);
 
@@ -4,12 +4,13 @@ package re;
 use strict;
 use warnings;
 
-our $VERSION     = "0.47";
+our $VERSION     = "0.52";
 our @ISA         = qw(Exporter);
 our @EXPORT_OK   = qw{
 	is_regexp regexp_pattern
 	regname regnames regnames_count
 	regmust optimization
+	regcache_stats regcache_size
 };
 our %EXPORT_OK = map { $_ => 1 } @EXPORT_OK;
 
@@ -115,9 +116,13 @@ sub _load_unload {
     }
 }
 
+# the default for "use re 'split_parallel'", in bytes
+my $split_parallel_threshold = 1_000_000;
+
 sub bits {
     my $on = shift;
     my $bits = 0;
+    my $taken = 0;      # arguments already used by the last subpragma
     my $turning_all_off = ! @_ && ! $on;
     my $seen_Debug = 0;
     my $seen_debug = 0;
@@ -126,12 +131,16 @@ sub bits {
         # Pretend were called with certain parameters, which are best dealt
         # with that way.
         push @_, keys %bitmask; # taint and eval
-        push @_, 'strict';
+        push @_, 'strict', 'linear', 'split_parallel';
     }
 
     # Process each subpragma parameter
    ARG:
     foreach my $idx (0..$#_){
+        if ($taken) {
+            $taken--;
+            next;
+        }
         my $s=$_[$idx];
         if ($s eq 'Debug' or $s eq 'Debugcolor') {
             if (! $seen_Debug) {
@@ -196,6 +205,34 @@ sub bits {
             else {
                 $^H &= ~$flags_hint;
             }
+        } elsif ($s eq 'linear') {
+            if ($on) {
+                $^H{re_linear} = 1;
+            }
+            else {
+                delete $^H{re_linear};
+            }
+        } elsif ($s eq 'split_parallel') {
+            if ($on) {
+                my $min = $split_parallel_threshold;
+                if ($idx < $#_ && $_[$idx+1] =~ /\A[0-9]+\z/) {
+                    $min = $_[$idx+1];
+                    $taken = 1;
+                }
+                $^H{re_split_parallel} = $min;
+            }
+            else {
+                delete $^H{re_split_parallel};
+                delete $^H{re_split_threads};
+            }
+        } elsif ($s eq 'split_threads') {
+            my $threads = $_[$idx+1];
+            if (!defined $threads || $threads !~ /\A[0-9]+\z/) {
+                require Carp;
+                Carp::croak("re: 'split_threads' needs a number of threads");
+            }
+            $^H{re_split_threads} = $threads if $on;
+            $taken = 1;
 	} elsif ($s =~ s/^\///) {
 	    my $reflags = $^H{reflags} || 0;
 	    my $seen_charset;
@@ -335,6 +372,12 @@ re - Perl pragma to alter regular expression behaviour
 
     use re 'strict';               # Raise warnings for more conditions
 
+    use re 'linear';               # Patterns must be matchable in
+                                   # linear time
+
+    use re 'split_parallel';       # split long strings on a fixed
+                                   # separator using threads
+
     use re '/ix';
     "FOO" =~ / foo /; # /ix implied
     no re '/x';
@@ -363,6 +406,12 @@ re - Perl pragma to alter regular expression behaviour
     }                                    # it but no hassle with blessed
                                          # re's.
 
+    my $set = re::Set->new(qr/error/, qr/^\d+ ms$/, 'warn(ing)?');
+    my @matched = $set->match($line); # indices of those that match
+
+    my $stream = re::Stream->new($fh, qr/BEGIN.{0,100}?END/s);
+    while (defined(my $match = $stream->next)) { ... }
+
 (We use $^X in these examples because it's tainted by default.)
 
 =head1 DESCRIPTION
@@ -444,6 +493,58 @@ interpolating into another pattern, outside of C<'strict'>, it is not checked
 again for strictness.  This is because if it works under strict it must work
 under non-strict.
 
+=head2 'linear' mode
+
+Most patterns are matched by trying each way they could match in turn,
+backtracking to the last choice made when one fails.  For some patterns,
+such as C</^(\d+)+$/>, a target string which doesn't match can take a time
+exponential in its length to fail.
+
+Patterns which use nothing that needs backtracking to decide whether they
+match (no backreferences, lookaround assertions, atomic subpatterns,
+conditionals, code blocks, recursion, C<\G>, C<\K>, backtracking control
+verbs or locale rules, and no quantified subpattern that can match the
+empty string) are also given a program for a matcher which runs all the
+possible ways at once, in time linear in the length of the target.  It
+finds the same match, with the same captures, as backtracking would.
+Usually it is only used once backtracking has taken longer than it would.
+
+When C<use re 'linear'> is in effect, patterns compiled in its scope are
+always matched that way, and it is an error for one not to be matchable
+in linear time:
+
+    use re 'linear';
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa!" =~ /^(a|aa)+$/;  # fails quickly
+    /(\w+)\1/;    # dies: "Pattern cannot be matched in linear time
+                  #        (backreferences) ..."
+
+Case-insensitive parts of such a pattern must be ASCII, and are only
+matched by the linear-time matcher against targets which are ASCII too
+(or, under C</d> rules, which aren't in UTF-8); other targets are matched by
+backtracking.  A pattern whose program would have too many states, mostly
+because of large finite quantifiers, can't be matched in linear time
+either.
+
+=head2 'split_parallel' mode
+
+    use re 'split_parallel';              # strings of 1_000_000 bytes
+                                          # or more
+    use re split_parallel => 50_000_000;  # ... of at least 50_000_000
+    use re split_threads => 4;            # ... using 4 threads
+    no re 'split_parallel';               # back to splitting serially
+
+On perls built with threads, C<use re 'split_parallel'> lets C<split> look
+for the separators in a long string with several threads at once.  This
+only applies when the separator pattern is a plain fixed string, such as
+C</\t/>, C</\n/> or C</, />, which can't overlap itself (C</aa/> could),
+there is no limit (or a negative one), and the string being split has no
+get magic.  The threads only find where the separators are; the fields
+are then made, in order, as usual, so the result is the same as
+splitting serially.
+
+The number of threads defaults to the number of online CPUs, capped at 8
+(or C<PERL_SPLIT_MAX_THREADS> if perl was built with that defined).
+
 =head2 '/flags' mode
 
 When C<use re '/I<flags>'> is specified, the given I<flags> are automatically
@@ -826,6 +927,11 @@ An integer, the least number of characters in any string that can match.
 An integer, the least number of characters that can be in C<$&> after a
 match. (Consider eg C< /ns(?=\d)/ >.)
 
+=item maxlen
+
+An integer, the most characters a match can consume, or C<undef> if there
+is no limit.  Lookahead assertions may examine characters beyond these.
+
 =item gofs
 
 An integer, the number of characters before C<pos()> to start match at.
@@ -912,8 +1018,114 @@ TODO: explain the representations.
 
 =back
 
+=item regcache_stats()
+
+Patterns interpolated at run time, such as C</$rules[$i]/>, are compiled
+each time the pattern string differs from the last one used by the same
+match operator.  To avoid recompiling patterns that a program keeps
+switching between, perl keeps a cache of the most recently compiled of
+them, shared by all the match operators in the interpreter.  Patterns
+containing code blocks, using C</l>, containing C<\p{}>, C<\P{}> or
+C<\N{}>, or raising warnings when compiled are not cached.
+
+This function returns a hashref describing the cache:
+
+=over 4
+
+=item size
+
+The largest number of patterns the cache will hold.
+
+=item count
+
+The number of patterns in the cache.
+
+=item hits
+
+The number of run-time compilations that found the pattern in the cache.
+
+=item misses
+
+The number of run-time compilations of cacheable patterns that did not.
+
 =back
 
+=item regcache_size()
+
+=item regcache_size($size)
+
+Returns the largest number of compiled patterns the cache will hold, 64 by
+default.  If C<$size> is given, the cache is emptied and will hold up to
+C<$size> patterns from then on; a size of 0 disables it.  Since the cache
+is searched linearly, it is not meant to be made very large.
+
+=back
+
+=head2 Pattern sets
+
+    my $set = re::Set->new(@patterns);
+    my @matched = $set->match($string);
+    my $count = $set->match($string);
+
+Matching one string against many patterns, one at a time, costs a call
+into the regex engine for every pattern, even though most of them can
+be seen not to match from the fixed substrings they require.  A
+C<re::Set> holds a list of patterns, each either a C<qr//> object or a
+string that is compiled as if by C<qr/$string/>, and matches a string
+against all of them at once.  In list context C<match> returns the
+indices, in ascending order, of the patterns that match the string; in
+scalar context it returns how many of them do.
+
+The longest fixed substring each pattern requires (see L</regmust($ref)>)
+is looked for in the string in a single pass, using an Aho-Corasick
+automaton built over all of them when the set is created, and only the
+patterns whose substring was found are then run against the string.
+Patterns with no fixed substring, such as most case-insensitive ones, are
+always run, so a set works best when most of its patterns have one.
+
+Each pattern is matched as C<$string =~ $pattern> would, but the
+captures of those matches are not available, and the set does not
+change C<$1>, C<$&> and the like.
+
+=head2 Streaming matches
+
+    my $stream = re::Stream->new($fh, $pattern);
+    my $stream = re::Stream->new($fh, $pattern, $max_length);
+    my @groups = $stream->next;
+    my $match = $stream->next;
+    my $offset = $stream->offset;
+
+Finding every match of a pattern in a large file otherwise means either
+reading the whole file into memory, or reading it a line (or record) at
+a time and missing any matches that span lines.  A C<re::Stream> reads
+the file a buffer at a time instead, and finds the matches that
+C<< $contents =~ /$pattern/g >> would find in the rest of the file
+after the handle's current position.  C<$pattern> is a C<qr//> object or
+a string that is compiled as if by C<qr/$string/>.
+
+Each call to C<next> returns the next match, in list context as a match
+in list context would (the capture groups, or the whole match if the
+pattern has none), and in scalar context as the text of the whole match.
+At the end of the file it returns the empty list or C<undef>.  C<offset>
+then gives the position of the start of that match, counted in
+characters from where the stream started reading.
+
+Only as much of the file is kept as the current match needs: this is
+bounded by C<$max_length>, which must be at least the number of
+characters any match can span, including any characters that lookahead
+assertions examine beyond it.  If it is left out, it is taken from the
+pattern, which must then have a maximum length (see L</optimization($ref)>)
+and contain no lookahead assertions, Unicode C<\b{...}> assertions,
+recursion or code blocks.  If a match turns out longer than
+C<$max_length> it may be cut short or not found.  Lookbehind assertions,
+C<\b> and C</^/m> can see up to 255 characters before the position
+the previous match ended.
+
+The handle's C<:utf8> layer, if any, decides whether the file is
+matched as characters or as bytes.  The stream reads ahead of the matches
+it has returned, so the handle is best left to it until C<next> returns
+nothing.  Patterns using C<\G> can't be streamed.
+
 =head1 SEE ALSO
 
 L<perlmodlib/Pragmatic Modules>.
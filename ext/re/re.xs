@@ -106,6 +106,510 @@ const struct regexp_engine wild_reg_engine = {
 
 #define newSVbool_(x) newSViv((x) ? 1 : 0)
 
+/* re::Set
+ *
+ * A set is a blessed array holding the compiled patterns and, for each of
+ * byte and utf8 targets, an Aho-Corasick automaton over the longest fixed
+ * substring each pattern requires (see regmust()).  Matching a string runs
+ * the automaton over it once, and then only calls the regex engine for
+ * those patterns whose substring was seen, or which have none.
+ *
+ * The automaton is kept in the buffer of a plain PV, so that it is freed
+ * and cloned along with the set without needing any magic: a header, then
+ * U32 arrays, then U8 arrays, as laid out by S_set_view().  Node 0 is the
+ * root, which has a full transition table; the other nodes have their
+ * edges sorted by byte. */
+
+#define SET_PATTERNS    0       /* AV of qr// objects */
+#define SET_BYTES       1       /* automaton for non-utf8 targets */
+#define SET_UTF8        2       /* automaton for utf8 targets */
+
+#define SET_ALWAYS      0       /* no fixed substring, always try it */
+#define SET_LITERAL     1       /* try it if its substring is seen */
+#define SET_NEVER       2       /* its substring can't be in the target */
+
+#define SET_NONE        ((U32) -1)
+
+typedef struct {
+    U32 nodes;
+    U32 edges;
+    U32 pats;
+    U32 literals;               /* patterns with kind SET_LITERAL */
+    U32 root[256];              /* transitions out of node 0 */
+} re_set_head;
+
+typedef struct {
+    re_set_head *head;
+    U32 *first_edge;            /* [nodes+1] index into the edge arrays */
+    U32 *edge_to;               /* [edges] */
+    U32 *fail;                  /* [nodes] longest proper suffix node */
+    U32 *dict;                  /* [nodes] nearest suffix with an output,
+                                   or 0 */
+    U32 *out;                   /* [nodes] first pattern ending here */
+    U32 *next;                  /* [pats] next pattern ending at the same
+                                   node */
+    U8  *edge_byte;             /* [edges] */
+    U8  *kind;                  /* [pats] SET_ALWAYS etc */
+} re_set_view;
+
+STATIC STRLEN
+S_set_size(U32 nodes, U32 edges, U32 pats)
+{
+    return sizeof(re_set_head)
+         + sizeof(U32) * ((STRLEN)nodes * 4 + 1 + edges + pats)
+         + (STRLEN)edges + pats;
+}
+
+STATIC void
+S_set_view(char *pv, re_set_view *v)
+{
+    re_set_head *head = (re_set_head *)pv;
+    U32 *u = (U32 *)(pv + sizeof(re_set_head));
+
+    v->head = head;
+    v->first_edge = u;          u += head->nodes + 1;
+    v->edge_to = u;             u += head->edges;
+    v->fail = u;                u += head->nodes;
+    v->dict = u;                u += head->nodes;
+    v->out = u;                 u += head->nodes;
+    v->next = u;                u += head->pats;
+    v->edge_byte = (U8 *)u;
+    v->kind = v->edge_byte + head->edges;
+}
+
+/* Set lit to the bytes of the longest fixed substring that the pattern
+ * needs to match a target in the given encoding, returning SET_LITERAL,
+ * or return one of the other kinds if there isn't one to use. */
+
+STATIC U8
+S_set_literal(pTHX_ REGEXP *rx, const bool utf8, SV *lit)
+{
+    SV * const tmp = sv_newmortal();
+    regexp *r;
+    int i;
+
+    if (   RX_ENGINE(rx) != &my_reg_engine
+        && RX_ENGINE(rx) != &wild_reg_engine
+        && RX_ENGINE(rx) != &PL_core_reg_engine)
+    {
+        return SET_ALWAYS;
+    }
+
+    r = ReANY(rx);
+    if (!r->substrs)
+        return SET_ALWAYS;
+
+    SvPVCLEAR(lit);
+    for (i = 0; i < 2; i++) {
+        const struct reg_substr_datum * const data = &r->substrs->data[i];
+        SV * const sub = (utf8 && data->utf8_substr) || !data->substr
+                       ? data->utf8_substr
+                       : data->substr;
+        STRLEN len;
+
+        if (!sub)
+            continue;
+
+        /* A trailing "\n" which is only there to say the substring may
+         * also be at the very end of the string isn't required */
+        len = SvCUR(sub);
+        if (len && SvVALID(sub) && SvTAIL(sub))
+            len--;
+        sv_setpvn(tmp, SvPVX_const(sub), len);
+        if (SvUTF8(sub))
+            SvUTF8_on(tmp);
+        else
+            SvUTF8_off(tmp);
+
+        if (utf8)
+            sv_utf8_upgrade(tmp);
+        else if (SvUTF8(tmp) && !sv_utf8_downgrade(tmp, TRUE))
+            return SET_NEVER;
+
+        if (SvCUR(tmp) > SvCUR(lit))
+            sv_setpvn(lit, SvPVX_const(tmp), SvCUR(tmp));
+    }
+
+    return SvCUR(lit) ? SET_LITERAL : SET_ALWAYS;
+}
+
+/* Build the automaton over the substrings of the patterns for targets in
+ * the given encoding */
+
+STATIC SV *
+S_set_build(pTHX_ AV *pats, const bool utf8)
+{
+    const U32 npats = (U32)(av_count(pats));
+    SV **lits;
+    U8 *kinds;
+    U32 *child, *sibling, *fail, *queue, *out, *next;
+    U8 *label;
+    U32 nodes = 1, edges = 0, literals = 0, maxnodes = 1;
+    U32 i, head, tail;
+    SV *sv;
+    re_set_view v;
+
+    Newx(lits, npats + 1, SV *);
+    Newx(kinds, npats + 1, U8);
+    for (i = 0; i < npats; i++) {
+        REGEXP * const rx = SvRX(*av_fetch(pats, i, FALSE));
+
+        lits[i] = sv_newmortal();
+        kinds[i] = S_set_literal(aTHX_ rx, utf8, lits[i]);
+        if (kinds[i] == SET_LITERAL) {
+            maxnodes += SvCUR(lits[i]);
+            literals++;
+        }
+    }
+
+    /* Build the trie, with each node's children in a linked list */
+    Newxz(child, maxnodes, U32);
+    Newxz(sibling, maxnodes, U32);
+    Newxz(label, maxnodes, U8);
+    Newx(out, maxnodes, U32);
+    Newx(next, npats + 1, U32);
+    for (i = 0; i < maxnodes; i++)
+        out[i] = SET_NONE;
+
+    for (i = 0; i < npats; i++) {
+        const U8 *s, *e;
+        U32 n = 0;
+
+        next[i] = SET_NONE;
+        if (kinds[i] != SET_LITERAL)
+            continue;
+
+        s = (const U8 *)SvPVX_const(lits[i]);
+        e = s + SvCUR(lits[i]);
+        for (; s < e; s++) {
+            U32 c = child[n];
+
+            while (c && label[c] != *s)
+                c = sibling[c];
+            if (!c) {
+                c = nodes++;
+                label[c] = *s;
+                sibling[c] = child[n];
+                child[n] = c;
+                if (n)
+                    edges++;
+            }
+            n = c;
+        }
+
+        /* keep the patterns sharing a substring in order */
+        if (out[n] == SET_NONE)
+            out[n] = i;
+        else {
+            U32 p = out[n];
+
+            while (next[p] != SET_NONE)
+                p = next[p];
+            next[p] = i;
+        }
+    }
+
+    sv = newSV(S_set_size(nodes, edges, npats));
+    SvPOK_on(sv);
+    SvCUR_set(sv, S_set_size(nodes, edges, npats));
+    Zero(SvPVX(sv), SvCUR(sv), char);
+    ((re_set_head *)SvPVX(sv))->nodes = nodes;
+    ((re_set_head *)SvPVX(sv))->edges = edges;
+    ((re_set_head *)SvPVX(sv))->pats = npats;
+    ((re_set_head *)SvPVX(sv))->literals = literals;
+    S_set_view(SvPVX(sv), &v);
+
+    Copy(out, v.out, nodes, U32);
+    Copy(next, v.next, npats, U32);
+    Copy(kinds, v.kind, npats, U8);
+
+    /* Work out the failure links breadth first, so that every node's link
+     * points to a node that already has its own */
+    fail = v.fail;
+    Newx(queue, nodes, U32);
+    head = tail = 0;
+    for (i = 0; i < 256; i++)
+        v.head->root[i] = 0;
+    for (i = child[0]; i; i = sibling[i]) {
+        v.head->root[label[i]] = i;
+        fail[i] = 0;
+        queue[tail++] = i;
+    }
+    while (head < tail) {
+        const U32 n = queue[head++];
+
+        v.dict[n] = v.out[fail[n]] != SET_NONE ? fail[n] : v.dict[fail[n]];
+        for (i = child[n]; i; i = sibling[i]) {
+            U32 f = fail[n];
+            U32 c;
+
+            for (;;) {
+                if (f == 0) {
+                    c = v.head->root[label[i]];
+                    break;
+                }
+                for (c = child[f]; c && label[c] != label[i]; c = sibling[c])
+                    ;
+                if (c)
+                    break;
+                f = fail[f];
+            }
+            fail[i] = c;
+            queue[tail++] = i;
+        }
+    }
+
+    /* Lay the edges out, each node's in order of their bytes */
+    edges = 0;
+    for (i = 0; i < nodes; i++) {
+        U32 c;
+
+        v.first_edge[i] = edges;
+        if (i == 0)
+            continue;
+        for (c = child[i]; c; c = sibling[c]) {
+            U32 j = edges++;
+
+            while (j > v.first_edge[i] && v.edge_byte[j-1] > label[c]) {
+                v.edge_byte[j] = v.edge_byte[j-1];
+                v.edge_to[j] = v.edge_to[j-1];
+                j--;
+            }
+            v.edge_byte[j] = label[c];
+            v.edge_to[j] = c;
+        }
+    }
+    v.first_edge[nodes] = edges;
+    assert(edges == v.head->edges);
+
+    Safefree(queue);
+    Safefree(child);
+    Safefree(sibling);
+    Safefree(label);
+    Safefree(out);
+    Safefree(next);
+    Safefree(kinds);
+    Safefree(lits);
+
+    return sv;
+}
+
+/* Run the automaton over the target, setting found[i] for each pattern i
+ * whose substring occurs in it.  seen[] has a byte per node. */
+
+STATIC void
+S_set_scan(const re_set_view *v, const U8 *s, const U8 * const e,
+           U8 *found, U8 *seen)
+{
+    U32 left = v->head->literals;
+    U32 n = 0;
+
+    for (; s < e && left; s++) {
+        U32 t;
+
+        for (;;) {
+            U32 lo, hi;
+
+            if (n == 0) {
+                n = v->head->root[*s];
+                break;
+            }
+
+            lo = v->first_edge[n];
+            hi = v->first_edge[n+1];
+            while (lo < hi) {
+                const U32 mid = (lo + hi) / 2;
+
+                if (v->edge_byte[mid] < *s)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            if (lo < v->first_edge[n+1] && v->edge_byte[lo] == *s) {
+                n = v->edge_to[lo];
+                break;
+            }
+            n = v->fail[n];
+        }
+
+        /* Once a node has been reported, so have all its suffixes */
+        for (t = v->out[n] != SET_NONE ? n : v->dict[n];
+             t && !seen[t];
+             t = v->dict[t])
+        {
+            U32 p;
+
+            seen[t] = 1;
+            for (p = v->out[t]; p != SET_NONE; p = v->next[p]) {
+                found[p] = 1;
+                left--;
+            }
+        }
+    }
+}
+
+/* re::Stream
+ *
+ * A stream is a blessed array holding the handle, a copy of the pattern,
+ * the window of data read from the handle that is still needed, and the
+ * re_stream_state below, kept in the buffer of a plain PV as re::Set
+ * does.
+ *
+ * A match attempt starting at some position can't look more than 'reach'
+ * bytes past it, so a match found starting at least that far from the end
+ * of the window is the one that would be found in the whole file, and
+ * positions further back than that which failed to match can be dropped.
+ * A few characters before the search position are kept for lookbehind,
+ * \b and the like. */
+
+#define STREAM_HANDLE   0       /* the handle, as passed in */
+#define STREAM_PATTERN  1       /* ref to a copy of the pattern */
+#define STREAM_WINDOW   2       /* PV of the data still needed */
+#define STREAM_STATE    3       /* PV holding a re_stream_state */
+
+/* characters kept before the search position: the longest lookbehind */
+#define STREAM_BEHIND   (U8_MAX + 1)
+
+typedef struct {
+    STRLEN reach;               /* bytes a match attempt can look ahead */
+    STRLEN pos;                 /* where in the window to search from */
+    STRLEN base;                /* characters dropped before the window */
+    STRLEN start;               /* character offset of the last match */
+    bool utf8;                  /* reading characters, not bytes */
+    bool eof;
+    bool zerolen;               /* the last match was empty and ended
+                                   at pos */
+    bool matched;
+} re_stream_state;
+
+/* The length of the window that can be matched against: any trailing
+ * partial UTF-8 character is left until the rest of it has been read. */
+
+STATIC STRLEN
+S_stream_end(const U8 * const buf, const STRLEN len)
+{
+    const U8 * const e = buf + len;
+    const U8 *s = e;
+
+    while (s > buf && e - s < UTF8_MAXBYTES && UTF8_IS_CONTINUATION(s[-1]))
+        s--;
+    if (s > buf && UTF8_IS_START(s[-1]) && s - 1 + UTF8SKIP(s - 1) > e)
+        return s - 1 - buf;
+    return len;
+}
+
+/* Append the next buffer's worth of data from the handle to the window,
+ * returning false at the end of the file. */
+
+STATIC bool
+S_stream_read(pTHX_ PerlIO *fp, SV *window)
+{
+    SSize_t cnt;
+
+    if (PerlIO_fast_gets(fp)) {
+        /* take the layer's buffer as it is, refilling it if need be */
+        cnt = PerlIO_get_cnt(fp);
+        if (cnt <= 0) {
+            if (PerlIO_fill(fp) != 0)
+                return FALSE;
+            cnt = PerlIO_get_cnt(fp);
+        }
+        if (cnt <= 0)
+            return FALSE;
+        sv_catpvn_nomg(window, (char *)PerlIO_get_ptr(fp), cnt);
+        PerlIO_set_ptrcnt(fp, PerlIO_get_ptr(fp) + cnt, 0);
+        return TRUE;
+    }
+
+    cnt = PerlIO_get_bufsiz(fp);
+    if (cnt <= 0)
+        cnt = 8192;
+    SvGROW(window, SvCUR(window) + cnt + 1);
+    cnt = PerlIO_read(fp, SvPVX(window) + SvCUR(window), cnt);
+    if (cnt <= 0)
+        return FALSE;
+    SvCUR_set(window, SvCUR(window) + cnt);
+    *SvEND(window) = '\0';
+    return TRUE;
+}
+
+/* Find the next match in the stream, reading as much as is needed to be
+ * sure of it.  Returns false once there are no more. */
+
+STATIC bool
+S_stream_next(pTHX_ AV *stream)
+{
+    SV * const handle = *av_fetch(stream, STREAM_HANDLE, FALSE);
+    REGEXP * const rx =
+        (REGEXP *)SvRV(*av_fetch(stream, STREAM_PATTERN, FALSE));
+    SV * const window = *av_fetch(stream, STREAM_WINDOW, FALSE);
+    re_stream_state * const st =
+        (re_stream_state *)SvPVX(*av_fetch(stream, STREAM_STATE, FALSE));
+    IO * const io = sv_2io(handle);
+    PerlIO * const fp = io ? IoIFP(io) : NULL;
+
+    st->matched = FALSE;
+    if (!fp)
+        st->eof = TRUE;
+
+    for (;;) {
+        U8 *buf = (U8 *)SvPVX(window);
+        STRLEN len = SvCUR(window);
+        const STRLEN end = st->utf8 && !st->eof ? S_stream_end(buf, len)
+                                                : len;
+        STRLEN keep;
+
+        if (end > st->pos || st->eof) {
+            if (CALLREGEXEC(rx, (char *)buf + st->pos, (char *)buf + end,
+                            (char *)buf, st->zerolen, window, NULL, 0))
+            {
+                const STRLEN s = RX_OFFS_START(rx, 0);
+
+                if (st->eof || s + st->reach <= end) {
+                    const STRLEN e = RX_OFFS_END(rx, 0);
+
+                    st->start = st->base + (st->utf8 ? utf8_length(buf,
+                                                                   buf + s)
+                                                     : s);
+                    st->zerolen = s == e;
+                    st->pos = e;
+                    st->matched = TRUE;
+                    return TRUE;
+                }
+            }
+            else if (st->eof)
+                return FALSE;
+
+            /* Nothing before here can start a match */
+            if (end > st->reach && end - st->reach > st->pos) {
+                STRLEN p = end - st->reach;
+
+                if (st->utf8)
+                    while (p > st->pos && UTF8_IS_CONTINUATION(buf[p]))
+                        p--;
+                if (p > st->pos) {
+                    st->pos = p;
+                    st->zerolen = FALSE;
+                }
+            }
+        }
+
+        keep = st->utf8
+             ? (STRLEN)(utf8_hop_back(buf + st->pos, -STREAM_BEHIND, buf)
+                        - buf)
+             : st->pos > STREAM_BEHIND ? st->pos - STREAM_BEHIND : 0;
+        if (keep) {
+            st->base += st->utf8 ? utf8_length(buf, buf + keep) : keep;
+            Move(buf + keep, buf, len - keep + 1, U8);
+            SvCUR_set(window, len - keep);
+            st->pos -= keep;
+        }
+
+        if (!S_stream_read(aTHX_ fp, window))
+            st->eof = TRUE;
+    }
+}
+
 MODULE = re	PACKAGE = re
 
 void
@@ -182,6 +686,8 @@ CODE:
 
     hv_stores(hv, "minlen", newSViv(r->minlen));
     hv_stores(hv, "minlenret", newSViv(r->minlenret));
+    hv_stores(hv, "maxlen", r->maxlen >= REG_INFTY
+                            ? &PL_sv_undef : newSViv(r->maxlen));
     hv_stores(hv, "gofs", newSViv(r->gofs));
 
     data = &r->substrs->data[0];
@@ -237,6 +743,286 @@ CODE:
 OUTPUT:
     RETVAL
 
+SV *
+regcache_stats()
+PROTOTYPE:
+PREINIT:
+    const re_cache *cache;
+    HV *hv;
+CODE:
+{
+    cache = PL_re_cache;
+    hv = newHV();
+
+    hv_stores(hv, "size", newSVuv(cache ? cache->size : PERL_RE_CACHE_SIZE));
+    hv_stores(hv, "count", newSVuv(cache ? cache->count : 0));
+    hv_stores(hv, "hits", newSVuv(cache ? cache->hits : 0));
+    hv_stores(hv, "misses", newSVuv(cache ? cache->misses : 0));
+
+    RETVAL = newRV_noinc((SV *)hv);
+}
+OUTPUT:
+    RETVAL
+
+SV *
+regcache_size(...)
+PROTOTYPE: ;$
+CODE:
+{
+    /* not a UV return, as using the TARG would call pad_sv(), which the
+     * DEBUGGING build of this module can't use from a non-DEBUGGING perl */
+    if (items > 1)
+        croak_xs_usage(cv, "[size]");
+    RETVAL = newSVuv(PL_re_cache ? PL_re_cache->size : PERL_RE_CACHE_SIZE);
+    if (items == 1)
+        re_cache_resize(SvUV(ST(0)));
+}
+OUTPUT:
+    RETVAL
+
+MODULE = re	PACKAGE = re::Set
+
+SV *
+new(klass, ...)
+    SV * klass
+PREINIT:
+    AV *set;
+    AV *pats;
+    I32 i;
+CODE:
+{
+    pats = newAV();
+    av_extend(pats, items - 2);
+    for (i = 1; i < items; i++) {
+        REGEXP *rx = SvRX(ST(i));
+
+        /* Each match leaves its captures in the regexp, so work on
+         * copies of those passed in, as a match operator would */
+        if (rx)
+            rx = reg_temp_copy(NULL, rx);
+        else
+            rx = CALLREGCOMP(ST(i), 0);
+        av_push(pats, newRV_noinc((SV *)rx));
+    }
+
+    set = newAV();
+    av_push(set, (SV *)pats);
+    av_push(set, S_set_build(aTHX_ pats, FALSE));
+    av_push(set, S_set_build(aTHX_ pats, TRUE));
+
+    RETVAL = sv_bless(newRV_noinc((SV *)set),
+                      gv_stashsv(klass, GV_ADD));
+}
+OUTPUT:
+    RETVAL
+
+void
+match(self, target)
+    SV * self
+    SV * target
+PREINIT:
+    AV *set;
+    AV *pats;
+    re_set_view v;
+    const char *s;
+    STRLEN len;
+    U8 *found;
+    U32 i;
+    I32 matched;
+    IV count = 0;
+PPCODE:
+{
+    if (!SvROK(self) || SvTYPE(SvRV(self)) != SVt_PVAV
+        || !sv_derived_from(self, "re::Set"))
+    {
+        croak_xs_usage(cv, "set, target");
+    }
+    set = (AV *)SvRV(self);
+    pats = (AV *)*av_fetch(set, SET_PATTERNS, FALSE);
+
+    s = SvPV_const(target, len);
+    S_set_view(SvPVX(*av_fetch(set, DO_UTF8(target) ? SET_UTF8 : SET_BYTES,
+                               FALSE)),
+               &v);
+
+    ENTER;
+    Newxz(found, v.head->pats + v.head->nodes, U8);
+    SAVEFREEPV(found);
+    S_set_scan(&v, (const U8 *)s, (const U8 *)s + len,
+               found, found + v.head->pats);
+
+    for (i = 0; i < v.head->pats; i++) {
+        REGEXP *rx;
+
+        if (v.kind[i] == SET_NEVER
+            || (v.kind[i] == SET_LITERAL && !found[i]))
+        {
+            continue;
+        }
+
+        rx = (REGEXP *)SvRV(*av_fetch(pats, i, FALSE));
+        PUTBACK;    /* code blocks in the pattern may use the stack */
+        matched = CALLREGEXEC(rx, (char *)s, (char *)s + len, (char *)s, 0,
+                              target, NULL, 0);
+        SPAGAIN;
+        if (matched) {
+            if (GIMME_V == G_LIST)
+                mXPUSHu(i);
+            count++;
+        }
+    }
+    LEAVE;
+
+    if (GIMME_V != G_LIST)
+        mXPUSHi(count);
+}
+
+MODULE = re	PACKAGE = re::Stream
+
+SV *
+new(klass, handle, pattern, ...)
+    SV * klass
+    SV * handle
+    SV * pattern
+PREINIT:
+    AV *stream;
+    REGEXP *rx;
+    IO *io;
+    SV *state;
+    re_stream_state *st;
+    SSize_t reach;
+CODE:
+{
+    io = sv_2io(handle);
+    if (items > 4 || !IoIFP(io))
+        croak_xs_usage(cv, "class, handle, pattern, [max_length]");
+
+    rx = SvRX(pattern);
+    rx = rx ? reg_temp_copy(NULL, rx) : CALLREGCOMP(pattern, 0);
+    /* mortal until it's in the stream, in case we croak */
+    sv_2mortal((SV *)rx);
+
+    if (RX_INTFLAGS(rx) & PREGf_GPOS_SEEN)
+        croak("re::Stream can't match a pattern using \\G");
+
+    if (items > 3) {
+        reach = SvIV(ST(3));
+        if (reach < 1)
+            croak_xs_usage(cv, "class, handle, pattern, [max_length]");
+    }
+    else {
+        const regexp * const r = ReANY(rx);
+
+        /* maxlen only covers what the pattern can consume, and not how
+         * far code or lookahead might look beyond that */
+        if (   (   RX_ENGINE(rx) != &my_reg_engine
+                && RX_ENGINE(rx) != &wild_reg_engine
+                && RX_ENGINE(rx) != &PL_core_reg_engine)
+            || r->maxlen >= REG_INFTY
+            || (r->intflags & (PREGf_LOOKAHEAD_SEEN|PREGf_RECURSE_SEEN))
+            || (r->extflags & RXf_EVAL_SEEN))
+        {
+            croak("re::Stream needs a maximum match length for this pattern");
+        }
+        reach = r->maxlen;
+    }
+
+    state = newSV(sizeof(re_stream_state));
+    SvPOK_on(state);
+    SvCUR_set(state, sizeof(re_stream_state));
+    st = (re_stream_state *)SvPVX(state);
+    Zero(st, 1, re_stream_state);
+    st->utf8 = cBOOL(PerlIO_isutf8(IoIFP(io)));
+
+    /* Past the last character it can match, $ can look at one more and
+     * the one after that to see if that was a newline at the end */
+    if (reach > (SSize_t)((SSize_t_MAX - 2) / (st->utf8 ? UTF8_MAXBYTES : 1)))
+        croak_xs_usage(cv, "class, handle, pattern, [max_length]");
+    st->reach = (STRLEN)reach * (st->utf8 ? UTF8_MAXBYTES : 1) + 2;
+
+    stream = newAV();
+    av_push(stream, newSVsv(handle));
+    av_push(stream, newRV_inc((SV *)rx));
+    av_push(stream, newSVpvs(""));
+    av_push(stream, state);
+    if (st->utf8)
+        SvUTF8_on(*av_fetch(stream, STREAM_WINDOW, FALSE));
+
+    RETVAL = sv_bless(newRV_noinc((SV *)stream),
+                      gv_stashsv(klass, GV_ADD));
+}
+OUTPUT:
+    RETVAL
+
+void
+next(self)
+    SV * self
+PREINIT:
+    AV *stream;
+    REGEXP *rx;
+    const char *buf;
+    bool utf8;
+    I32 i, n;
+PPCODE:
+{
+    if (!SvROK(self) || SvTYPE(SvRV(self)) != SVt_PVAV
+        || !sv_derived_from(self, "re::Stream"))
+    {
+        croak_xs_usage(cv, "stream");
+    }
+    stream = (AV *)SvRV(self);
+
+    PUTBACK;    /* code blocks in the pattern, or PerlIO::via, may use
+                   the stack */
+    if (!S_stream_next(aTHX_ stream)) {
+        SPAGAIN;
+        if (GIMME_V == G_LIST)
+            XSRETURN_EMPTY;
+        XSRETURN_UNDEF;
+    }
+    SPAGAIN;
+
+    rx = (REGEXP *)SvRV(*av_fetch(stream, STREAM_PATTERN, FALSE));
+    buf = SvPVX_const(*av_fetch(stream, STREAM_WINDOW, FALSE));
+    utf8 = cBOOL(SvUTF8(*av_fetch(stream, STREAM_WINDOW, FALSE)));
+
+    /* like m// in list context, the groups, or else the whole match */
+    n = GIMME_V == G_LIST ? (I32)RX_NPARENS(rx) : 0;
+    EXTEND(SP, n ? n : 1);
+    for (i = n ? 1 : 0; i <= n; i++) {
+        SV *sv;
+
+        if (i <= (I32)RX_LASTPAREN(rx) && RX_OFFS_VALID(rx, i)) {
+            sv = newSVpvn(buf + RX_OFFS_START(rx, i),
+                          RX_OFFS_END(rx, i) - RX_OFFS_START(rx, i));
+            if (utf8)
+                SvUTF8_on(sv);
+        }
+        else
+            sv = newSV(0);
+        mPUSHs(sv);
+    }
+}
+
+SV *
+offset(self)
+    SV * self
+PREINIT:
+    const re_stream_state *st;
+CODE:
+{
+    if (!SvROK(self) || SvTYPE(SvRV(self)) != SVt_PVAV
+        || !sv_derived_from(self, "re::Stream"))
+    {
+        croak_xs_usage(cv, "stream");
+    }
+    st = (const re_stream_state *)
+            SvPVX(*av_fetch((AV *)SvRV(self), STREAM_STATE, FALSE));
+    RETVAL = st->matched ? newSVuv(st->start) : &PL_sv_undef;
+}
+OUTPUT:
+    RETVAL
+
 #
 # ex: set ts=8 sts=4 sw=4 et:
 #
@@ -92,8 +92,67 @@ use Test::More; # test count at bottom of file
 
     # TODO: test anchored/floating end shift
 }
+
+{
+    package ReFuncsTie;
+    our $fetches = 0;
+    sub TIESCALAR { my ($class, $v) = @_; bless \$v, $class }
+    sub FETCH { $fetches++; ${$_[0]} }
+}
+
+{
+    use re qw{regcache_stats regcache_size};
+
+    my $default = regcache_stats()->{size};
+    is(regcache_size(8), $default, "regcache_size returns the old size");
+    my $s = regcache_stats();
+    is($s->{size}, 8, "regcache_size sets the size");
+    is($s->{count}, 0, "regcache_size empties the cache");
+
+    my ($hits, $misses) = @$s{qw(hits misses)};
+    my @pats = ('(a)(b)', '(c)(d)', '(e)(f)');
+    my @got;
+    for my $i (0 .. 8) {
+        push @got, "$1$2" if "abcdef" =~ /$pats[$i % 3]/;
+    }
+    is("@got", "ab cd ef ab cd ef ab cd ef",
+       "alternating run-time patterns match correctly");
+    $s = regcache_stats();
+    is($s->{count}, 3, "each pattern is cached once");
+    is($s->{misses} - $misses, 3, "one miss per pattern");
+    is($s->{hits} - $hits, 6, "later compilations are found in the cache");
+
+    my $p = '(\d+)';
+    "a12" =~ /$p/;
+    {
+        "b345" =~ /$p/;
+        is($1, "345", "match using a cached pattern sets captures");
+    }
+    is($1, "12", "ops sharing a cached pattern have their own captures");
+
+    tie my $t, 'ReFuncsTie', "ab";
+    my $n = 0;
+    for my $p (qw(a b a b b)) {
+        $n++ if $t =~ /$p/;
+    }
+    is($n, 5, "tied LHS matches cached patterns");
+    is($ReFuncsTie::fetches, 5, "tied LHS is fetched once per match");
+
+    regcache_size(0);
+    ($hits, $misses) = @{regcache_stats()}{qw(hits misses)};
+    @got = ();
+    for my $i (0 .. 5) {
+        push @got, "$1$2" if "abcdef" =~ /$pats[$i % 3]/;
+    }
+    is("@got", "ab cd ef ab cd ef", "patterns match with the cache disabled");
+    $s = regcache_stats();
+    is($s->{count} + $s->{hits} - $hits + $s->{misses} - $misses, 0,
+       "a disabled cache isn't used");
+
+    regcache_size($default);
+}
 # New tests above this line, don't forget to update the test count below!
-use Test::More tests => 40;
+use Test::More tests => 53;
 # No tests here!
 
 #
@@ -0,0 +1,97 @@
+#!./perl
+
+BEGIN {
+    require Config;
+    if (($Config::Config{'extensions'} !~ /\bre\b/) ){
+        print "1..0 # Skip -- Perl configured without re module\n";
+        exit 0;
+    }
+}
+
+use strict;
+use warnings;
+
+use Test::More;
+use re;
+
+# what matching each pattern in turn would find
+sub each_pattern {
+    my ($pats, $str) = @_;
+    return join " ", grep { $str =~ /$pats->[$_]/ } 0 .. $#$pats;
+}
+
+{
+    my @pats = (qr/foo\d+/, 'bar$', qr/x/i, qr/^\w+ing\b/, qr/ab(c|d)ef/,
+                'b', qr/\d{3}-\d{4}/, "\x{100}z", qr/(?<=a)bc/);
+    my $set = re::Set->new(@pats);
+    isa_ok($set, 're::Set');
+
+    for my $str ("foo12 bar", "xing is bar\n", "abdef b", "nothing",
+                 "\x{100}z", "call 555-1234 foo1", "bar", "", "abc")
+    {
+        my $want = each_pattern(\@pats, $str);
+        (my $name = $str) =~ s/([^ -~])/sprintf "\\x{%x}", ord $1/eg;
+        is(join(" ", $set->match($str)), $want, "match '$name'");
+        is(scalar $set->match($str), scalar(my @n = split " ", $want),
+           "match '$name' in scalar context");
+    }
+}
+
+{
+    # the optional "\n" that a trailing $ adds to a fixed substring
+    my $set = re::Set->new('foo$', 'foo\n', 'o\nb');
+    is(join(" ", $set->match("a foo")), "0", "foo\$ at the end");
+    is(join(" ", $set->match("a foo\n")), "0 1", "foo\$ before a newline");
+    is(join(" ", $set->match("a foo\nbar")), "1 2", "foo\\n in the middle");
+}
+
+{
+    # substrings in either encoding, against targets in either encoding
+    my @pats = ("caf\x{e9}", "\x{e9}t\x{e9}", "\x{263a}!", qr/\x{e9}+s/,
+                qr/na\x{ef}ve|r\x{e9}sum\x{e9}/);
+    my $set = re::Set->new(@pats);
+    for my $str ("un caf\x{e9} l'\x{e9}t\x{e9}", "\x{263a}!\x{e9}\x{e9}s",
+                 "na\x{ef}ve", "cafe")
+    {
+        for my $upgrade (0, 1) {
+            my $copy = $str;
+            utf8::upgrade($copy) if $upgrade;
+            (my $name = $str) =~ s/([^ -~])/sprintf "\\x{%x}", ord $1/eg;
+            is(join(" ", $set->match($copy)), each_pattern(\@pats, $copy),
+               "match '$name'" . ($upgrade ? " upgraded" : ""));
+        }
+    }
+}
+
+{
+    # many patterns sharing substrings and suffixes of each other
+    my @words = qw(he she his hers her sheer shears ear ears rush hush us);
+    my @pats = ((map { qr/\b$_\b/ } @words), qr/s\w*s/, qr/[aeiou]{2}/);
+    my $set = re::Set->new(@pats);
+    for my $str ("ushers", "she hears his hush", "her ears", "rush us",
+                 "sheer shears", "h e r s")
+    {
+        is(join(" ", $set->match($str)), each_pattern(\@pats, $str),
+           "match '$str' against overlapping words");
+    }
+}
+
+{
+    my $set = re::Set->new();
+    is(join(" ", $set->match("anything")), "", "an empty set matches nothing");
+
+    my $qr = qr/(\w)(\d)/;
+    "z9" =~ $qr;
+    $set = re::Set->new($qr, qr/(\d)/);
+    is(join(" ", $set->match("a1")), "0 1", "matching with captures");
+    is("$1$2", "z9", "the set doesn't change the last match's captures");
+
+    ok(!eval { re::Set::match("re::Set", "a"); 1 }, "match needs a set");
+    like($@, qr/^Usage: re::Set::match\(set, target\)/, "usage message");
+}
+
+done_testing();
+
+#
+# ex: set ts=8 sts=4 sw=4 et:
+#
@@ -0,0 +1,130 @@
+#!./perl
+
+BEGIN {
+    require Config;
+    if (($Config::Config{'extensions'} !~ /\bre\b/) ){
+        print "1..0 # Skip -- Perl configured without re module\n";
+        exit 0;
+    }
+}
+
+use strict;
+use warnings;
+
+use Test::More;
+use re;
+
+my $file = "stream$$.tmp";
+END { 1 while unlink $file }
+
+sub write_file {
+    my ($contents, $layer) = @_;
+    open my $fh, ">$layer", $file or die "Can't write $file: $!";
+    print $fh $contents;
+    close $fh or die "Can't close $file: $!";
+}
+
+# what m//g finds in the whole string, as "offset:match" pairs
+sub each_match {
+    my ($str, $pat) = @_;
+    my @found;
+    push @found, "$-[0]:$&" while $str =~ /$pat/g;
+    return "@found";
+}
+
+sub each_streamed {
+    my ($stream) = @_;
+    my @found;
+    while (defined(my $match = $stream->next)) {
+        push @found, $stream->offset . ":$match";
+    }
+    return "@found";
+}
+
+{
+    open my $fh, '<', \"foo bar\nbaz foo\nqux" or die;
+    my $stream = re::Stream->new($fh, qr/(\w+) (\w+)/, 20);
+    isa_ok($stream, 're::Stream');
+    is(join("|", $stream->next), "foo|bar", "list context gives the groups");
+    is($stream->offset, 0, "offset of the first match");
+    is(join("|", $stream->next), "baz|foo", "then the next match");
+    is($stream->offset, 8, "offset of the second match");
+    is_deeply([$stream->next], [], "empty list at the end");
+    is($stream->offset, undef, "no offset after the end");
+    is_deeply([$stream->next], [], "and it stays at the end");
+
+    open $fh, '<', \"a1 b c2" or die;
+    $stream = re::Stream->new($fh, '(\w)(\d)?');
+    is(join("|", map { $_ // "undef" } $stream->next), "a|1",
+       "pattern given as a string");
+    is(join("|", map { $_ // "undef" } $stream->next), "b|undef",
+       "unmatched groups are undef");
+    is(scalar $stream->next, "c2", "scalar context gives the whole match");
+}
+
+{
+    # several buffers' worth, with matches across the buffer boundaries
+    my $str = join "", map { "line $_ " . ("x" x ($_ % 50)) . "\n" } 1..5000;
+    write_file($str, "");
+    for my $pat (qr/\d x{5,9}\n\w/, qr/^line 4\d{0,3}/m, qr/(?<=x\n)line/,
+                 qr/\bline 123\b/, qr/x$/m, qr/x\z/, qr/\n\z/, qr/[lx]{0,3}/,
+                 qr/^l/)
+    {
+        open my $fh, '<', $file or die;
+        is(each_streamed(re::Stream->new($fh, $pat)), each_match($str, $pat),
+           "matches of $pat");
+    }
+
+    for my $pat (qr/x+\n/, qr/(?=l)\w+ 4/) {
+        open my $fh, '<', $file or die;
+        is(each_streamed(re::Stream->new($fh, $pat, 100)),
+           each_match($str, $pat), "matches of $pat with a maximum length");
+    }
+
+    open my $fh, '<', $file or die;
+    my $line = <$fh>;
+    is(each_streamed(re::Stream->new($fh, qr/^line \d{1,4}/m)),
+       each_match(substr($str, length $line), qr/^line \d{1,4}/m),
+       "the stream starts from where the handle is");
+}
+
+{
+    my $str = join "", map { "caf\x{e9} \x{263a}$_ " } 1..3000;
+    write_file($str, ":utf8");
+    for my $pat (qr/\x{e9} \x{263a}\d/, qr/\x{263a}12/, qr/.\x{e9}/) {
+        open my $fh, '<:utf8', $file or die;
+        is(each_streamed(re::Stream->new($fh, $pat)), each_match($str, $pat),
+           "matches of $pat in characters");
+    }
+
+    my $bytes = $str;
+    utf8::encode($bytes);
+    open my $fh, '<', $file or die;
+    is(each_streamed(re::Stream->new($fh, qr/\xa9 /)),
+       each_match($bytes, qr/\xa9 /), "without :utf8 the stream is bytes");
+}
+
+{
+    open my $fh, '<', \"abc" or die;
+    ok(!eval { re::Stream->new($fh, qr/a+/); 1 }, "a+ has no maximum length");
+    like($@, qr/^re::Stream needs a maximum match length for this pattern/,
+         "error message");
+    ok(!eval { re::Stream->new($fh, qr/a(?=b)/); 1 },
+       "lookahead needs a maximum length");
+    ok(!eval { re::Stream->new($fh, qr/\Ga/); 1 }, "\\G can't be streamed");
+    like($@, qr/^re::Stream can't match a pattern using \\G/, "error message");
+    ok(!eval { re::Stream->new($fh, qr/a/, 0); 1 },
+       "the maximum length must be positive");
+    like($@, qr/^Usage: re::Stream::new\(class, handle, pattern, \[max_length\]\)/,
+         "usage message");
+    ok(!eval { re::Stream::next("re::Stream"); 1 }, "next needs a stream");
+}
+
+is(re::optimization(qr/ab{2,5}c/)->{maxlen}, 7, "optimization reports maxlen");
+is(re::optimization(qr/ab+/)->{maxlen}, undef, "maxlen of an unbounded pattern");
+
+done_testing();
+
+#
+# ex: set ts=8 sts=4 sw=4 et:
+#
@@ -46,6 +46,48 @@ holds the key and hash value.
 #define DO_HSPLIT(xhv) ( ( ((xhv)->xhv_keys + ((xhv)->xhv_keys >> 1)) > (xhv)->xhv_max ) && \
                            ((xhv)->xhv_max < MAX_BUCKET_MAX) )
 
+/* Keep count of splits, and of the most entries any one of them had to
+ * rehash, for Hash::Util::hash_split_stats() */
+#define HV_SPLIT_RECORD(rehashed) STMT_START {                       \
+    PL_hv_split_count++;                                            \
+    if ((UV)(rehashed) > PL_hv_split_worst)                         \
+        PL_hv_split_worst = (UV)(rehashed);                         \
+} STMT_END
+
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+/* Hashes with at least PERL_HV_INCREMENTAL_SPLIT_MIN buckets are split
+ * incrementally: the bucket array is doubled straight away, but the
+ * entries in the old buckets are only moved to their new homes
+ * PERL_HV_SPLIT_STEP buckets at a time, by later accesses to the hash.
+ * Until then an entry whose bucket has not been split yet lives in the
+ * lower half of the array, which HV_BUCKET_INDEX() accounts for. */
+#  ifndef PERL_HV_INCREMENTAL_SPLIT_MIN
+#    define PERL_HV_INCREMENTAL_SPLIT_MIN 4096
+#  endif
+#  ifndef PERL_HV_SPLIT_STEP
+#    define PERL_HV_SPLIT_STEP 4
+#  endif
+#  define HV_BUCKET_INDEX(hv, hash) hv_bucket_index(hv, hash)
+/* Entries must not move between chains under an active iterator, or it
+ * would skip or repeat them, so only lookups on hashes which aren't being
+ * iterated move the split along.  Storing a new key always does, as that
+ * already leaves the iteration order undefined. */
+#  define HV_SPLIT_STEP_IF_IDLE(hv) STMT_START {                     \
+    if (HvHasAUX(hv) && HvAUX(hv)->xhv_split_pending                \
+        && HvAUX(hv)->xhv_riter == -1 && !HvAUX(hv)->xhv_eiter)     \
+        hsplit_step(hv, PERL_HV_SPLIT_STEP);                        \
+} STMT_END
+#else
+#  define HV_BUCKET_INDEX(hv, hash) ((hash) & (I32) HvMAX(hv))
+#  define HV_SPLIT_STEP_IF_IDLE(hv) NOOP
+#endif
+
+#ifdef __GNUC__
+#  define HV_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#  define HV_PREFETCH(addr) NOOP
+#endif
+
 static const char S_strtab_error[]
     = "Cannot modify shared string table in hv_%s";
 
@@ -287,11 +329,11 @@ Perl_he_dup(pTHX_ const HE *e, bool shared, CLONE_PARAMS* param)
                                   HEK_HASH(source), HEK_FLAGS(source));
             ptr_table_store(PL_ptr_table, source, shared);
         }
-        HeKEY_hek(ret) = shared;
+        HeKEY_hek_set(ret, shared);
     }
     else
-        HeKEY_hek(ret) = save_hek_flags(HeKEY(e), HeKLEN(e), HeHASH(e),
-                                        HeKFLAGS(e));
+        HeKEY_hek_set(ret, save_hek_flags(HeKEY(e), HeKLEN(e), HeHASH(e),
+                                          HeKFLAGS(e)));
     HeVAL(ret) = sv_dup_inc(HeVAL(e), param);
 
     HeNEXT(ret) = he_dup(HeNEXT(e), FALSE, param);
@@ -792,7 +834,8 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen,
     else
 #endif
     {
-        entry = (HvARRAY(hv))[hash & (I32) HvMAX(hv)];
+        HV_SPLIT_STEP_IF_IDLE(hv);
+        entry = (HvARRAY(hv))[HV_BUCKET_INDEX(hv, hash)];
     }
 
     if (!entry)
@@ -826,7 +869,7 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen,
     }
 
     for (; entry; entry = HeNEXT(entry)) {
-        if (HeHASH(entry) != hash)		/* strings can't be equal */
+        if (HeHASH_cached(entry) != hash)		/* strings can't be equal */
             continue;
         if (HeKLEN(entry) != (I32)klen)
             continue;
@@ -849,7 +892,7 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen,
                     HEK * const new_hek
                         = share_hek_flags(key, klen, hash, flags & ~HVhek_FREEKEY);
                     unshare_hek (HeKEY_hek(entry));
-                    HeKEY_hek(entry) = new_hek;
+                    HeKEY_hek_set(entry, new_hek);
                 }
                 else if (hv == PL_strtab) {
                     /* PL_strtab is usually the only hash without HvSHAREKEYS,
@@ -971,13 +1014,13 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen,
         HvARRAY(hv) = (HE**)array;
     }
 
-    oentry = &(HvARRAY(hv))[hash & (I32) xhv->xhv_max];
+    oentry = &(HvARRAY(hv))[HV_BUCKET_INDEX(hv, hash)];
 
     /* share_hek_flags will do the free for us.  This might be considered
        bad API design.  */
     if (LIKELY(HvSHAREKEYS(hv))) {
         entry = new_HE();
-        HeKEY_hek(entry) = share_hek_flags(key, klen, hash, flags);
+        HeKEY_hek_set(entry, share_hek_flags(key, klen, hash, flags));
     }
     else if (UNLIKELY(hv == PL_strtab)) {
         /* PL_strtab is usually the only hash without HvSHAREKEYS, so putting
@@ -990,7 +1033,7 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen,
     else {
         /* gotta do the real thing */
         entry = new_HE();
-        HeKEY_hek(entry) = save_hek_flags(key, klen, hash, flags);
+        HeKEY_hek_set(entry, save_hek_flags(key, klen, hash, flags));
     }
     HeVAL(entry) = val;
     in_collision = cBOOL(*oentry != NULL);
@@ -1041,6 +1084,10 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen,
         HvHASKFLAGS_on(hv);
 
     xhv->xhv_keys++; /* HvTOTALKEYS(hv)++ */
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+    if (HvHasAUX(hv) && HvAUX(hv)->xhv_split_pending)
+        hsplit_step(hv, PERL_HV_SPLIT_STEP);
+#endif
     if ( in_collision && DO_HSPLIT(xhv) ) {
         const STRLEN oldsize = xhv->xhv_max + 1;
         const U32 items = (U32)HvPLACEHOLDERS_get(hv);
@@ -1361,7 +1408,8 @@ S_hv_delete_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen,
     else if (!hash)
         PERL_HASH(hash, key, klen);
 
-    first_entry = oentry = &(HvARRAY(hv))[hash & (I32) HvMAX(hv)];
+    HV_SPLIT_STEP_IF_IDLE(hv);
+    first_entry = oentry = &(HvARRAY(hv))[HV_BUCKET_INDEX(hv, hash)];
     entry = *oentry;
 
     if (!entry)
@@ -1395,7 +1443,7 @@ S_hv_delete_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen,
     }
 
     for (; entry; oentry = &HeNEXT(entry), entry = *oentry) {
-        if (HeHASH(entry) != hash)		/* strings can't be equal */
+        if (HeHASH_cached(entry) != hash)		/* strings can't be equal */
             continue;
         if (HeKLEN(entry) != (I32)klen)
             continue;
@@ -1621,10 +1669,61 @@ S_large_hash_heuristic(pTHX_ HV *hv, STRLEN size) {
 }
 #endif
 
+/* Move the entries of bucket i of the array aep which no longer belong
+ * there, now that the array's mask is mask, to the buckets they do belong
+ * in.  Returns how many entries were looked at. */
+
+PERL_STATIC_INLINE STRLEN
+S_hsplit_bucket(pTHX_ HE **aep, STRLEN i, STRLEN mask)
+{
+    HE **oentry = aep + i;
+    HE *entry = aep[i];
+    STRLEN seen = 0;
+
+    PERL_ARGS_ASSERT_HSPLIT_BUCKET;
+
+    for (; entry; entry = *oentry) {
+        U32 j = (HeHASH_cached(entry) & mask);
+        seen++;
+        if (j != (U32)i) {
+            *oentry = HeNEXT(entry);
+#ifdef PERL_HASH_RANDOMIZE_KEYS
+            /* if the target cell is empty or PL_HASH_RAND_BITS_ENABLED is false
+             * insert to top, otherwise rotate the bucket rand 1 bit,
+             * and use the new low bit to decide if we insert at top,
+             * or next from top. IOW, we only rotate on a collision.*/
+            if (aep[j] && PL_HASH_RAND_BITS_ENABLED) {
+                UPDATE_HASH_RAND_BITS();
+                if (PL_hash_rand_bits & 1) {
+                    HeNEXT(entry)= HeNEXT(aep[j]);
+                    HeNEXT(aep[j])= entry;
+                } else {
+                    /* Note, this is structured in such a way as the optimizer
+                    * should eliminate the duplicated code here and below without
+                    * us needing to explicitly use a goto. */
+                    HeNEXT(entry) = aep[j];
+                    aep[j] = entry;
+                }
+            } else
+#endif
+            {
+                /* see comment above about duplicated code */
+                HeNEXT(entry) = aep[j];
+                aep[j] = entry;
+            }
+        }
+        else {
+            oentry = &HeNEXT(entry);
+        }
+    }
+    return seen;
+}
+
 STATIC void
 S_hsplit(pTHX_ HV *hv, STRLEN const oldsize, STRLEN newsize)
 {
     STRLEN i = 0;
+    STRLEN rehashed = 0;
     char *a = (char*) HvARRAY(hv);
     HE **aep;
 
@@ -1632,6 +1731,12 @@ S_hsplit(pTHX_ HV *hv, STRLEN const oldsize, STRLEN newsize)
     if (newsize > MAX_BUCKET_MAX+1)
             return;
 
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+    /* the previous split has to be finished before the next one starts */
+    if (HvHasAUX(hv) && HvAUX(hv)->xhv_split_pending)
+        hsplit_step(hv, HvAUX(hv)->xhv_split_pending);
+#endif
+
     PL_nomemok = TRUE;
     Renew(a, PERL_HV_ARRAY_ALLOC_BYTES(newsize), char);
     PL_nomemok = FALSE;
@@ -1659,52 +1764,69 @@ S_hsplit(pTHX_ HV *hv, STRLEN const oldsize, STRLEN newsize)
     if (LARGE_HASH_HEURISTIC(hv, HvTOTALKEYS(hv)))
         HvSHAREKEYS_off(hv);
 
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+    if (newsize == oldsize * 2 && oldsize >= PERL_HV_INCREMENTAL_SPLIT_MIN) {
+        struct xpvhv_aux * const aux
+            = HvHasAUX(hv) ? HvAUX(hv) : hv_auxinit(hv);
+        aux->xhv_split_pending = oldsize;
+        PL_hv_split_count++;
+        return;
+    }
+#endif
 
     newsize--;
     aep = (HE**)a;
     do {
-        HE **oentry = aep + i;
-        HE *entry = aep[i];
-
-        if (!entry)				/* non-existent */
-            continue;
-        do {
-            U32 j = (HeHASH(entry) & newsize);
-            if (j != (U32)i) {
-                *oentry = HeNEXT(entry);
-#ifdef PERL_HASH_RANDOMIZE_KEYS
-                /* if the target cell is empty or PL_HASH_RAND_BITS_ENABLED is false
-                 * insert to top, otherwise rotate the bucket rand 1 bit,
-                 * and use the new low bit to decide if we insert at top,
-                 * or next from top. IOW, we only rotate on a collision.*/
-                if (aep[j] && PL_HASH_RAND_BITS_ENABLED) {
-                    UPDATE_HASH_RAND_BITS();
-                    if (PL_hash_rand_bits & 1) {
-                        HeNEXT(entry)= HeNEXT(aep[j]);
-                        HeNEXT(aep[j])= entry;
-                    } else {
-                        /* Note, this is structured in such a way as the optimizer
-                        * should eliminate the duplicated code here and below without
-                        * us needing to explicitly use a goto. */
-                        HeNEXT(entry) = aep[j];
-                        aep[j] = entry;
-                    }
-                } else
-#endif
-                {
-                    /* see comment above about duplicated code */
-                    HeNEXT(entry) = aep[j];
-                    aep[j] = entry;
-                }
-            }
-            else {
-                oentry = &HeNEXT(entry);
-            }
-            entry = *oentry;
-        } while (entry);
+        rehashed += hsplit_bucket(aep, i, newsize);
     } while (i++ < oldsize);
+    HV_SPLIT_RECORD(rehashed);
 }
 
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+
+/* Which bucket of hv an entry with the given hash is in, taking any
+ * unfinished incremental split into account. */
+
+PERL_STATIC_INLINE STRLEN
+S_hv_bucket_index(HV *hv, U32 hash)
+{
+    STRLEN idx = hash & HvMAX(hv);
+
+    PERL_ARGS_ASSERT_HV_BUCKET_INDEX;
+
+    if (HvHasAUX(hv)) {
+        const STRLEN pending = HvAUX(hv)->xhv_split_pending;
+        const STRLEN oldsize = (HvMAX(hv) + 1) >> 1;
+        if (pending && idx >= oldsize && idx - oldsize >= oldsize - pending)
+            idx -= oldsize;
+    }
+    return idx;
+}
+
+/* Split up to nbuckets more of the buckets left by an incremental split
+ * of hv. */
+
+STATIC void
+S_hsplit_step(pTHX_ HV *hv, STRLEN nbuckets)
+{
+    struct xpvhv_aux * const aux = HvAUX(hv);
+    const STRLEN pending = aux->xhv_split_pending;
+    const STRLEN mask = HvMAX(hv);
+    STRLEN i = ((mask + 1) >> 1) - pending;
+    STRLEN rehashed = 0;
+
+    PERL_ARGS_ASSERT_HSPLIT_STEP;
+
+    if (nbuckets > pending)
+        nbuckets = pending;
+    aux->xhv_split_pending = pending - nbuckets;
+    for (; nbuckets; nbuckets--, i++)
+        rehashed += hsplit_bucket(HvARRAY(hv), i, mask);
+    HV_SPLIT_RECORD(rehashed);
+}
+
+#endif /* PERL_HV_INCREMENTAL_SPLIT */
+
 /*
 =for apidoc hv_ksplit
 
@@ -1773,6 +1895,94 @@ Perl_hv_ksplit(pTHX_ HV *hv, IV newmax)
     }
 }
 
+/*
+=for apidoc hv_build_from_pairs
+
+Stores C<npairs> key/value pairs into C<hv>.  C<pairs> points to
+C<2 * npairs> SVs, alternately a key and its value, as on the right hand
+side of a list assignment to a hash.  If a key appears more than once,
+the last value stored for it wins.  The existing contents of C<hv> are
+kept; call C<hv_clear> first to replace them.
+
+This is equivalent to calling C<hv_store_ent> for each pair in turn, but
+it grows the bucket array once for all the new keys, and it computes the
+hash values of the keys in batches before storing them, which is
+considerably faster for building large hashes.
+
+As with C<hv_store_ent>, the keys are only read, while C<hv> takes
+ownership of one reference to each value.  Unlike C<hv_store_ent>, that
+reference is always consumed, even if the value did not need to be
+stored (as in the case of tied hashes).  A C<NULL> value is stored as a
+new undefined scalar.  Set magic is called on each value after it is
+stored, as list assignment does, so tied hashes work as expected.
+
+=cut
+*/
+
+/* How many keys hv_build_from_pairs() hashes before it stores them */
+#define HV_BUILD_BATCH 32
+
+void
+Perl_hv_build_from_pairs(pTHX_ HV *hv, SV * const *pairs, SSize_t npairs)
+{
+    U32 hashes[HV_BUILD_BATCH];
+    const bool plain = !SvMAGICAL((const SV *)hv);
+
+    PERL_ARGS_ASSERT_HV_BUILD_FROM_PAIRS;
+
+    if (npairs <= 0)
+        return;
+
+    if (plain && HvTOTALKEYS(hv) + npairs > PERL_HASH_DEFAULT_HvMAX)
+        hv_ksplit(hv, HvTOTALKEYS(hv) + npairs);
+
+    while (npairs) {
+        const SSize_t n = npairs < HV_BUILD_BATCH ? npairs : HV_BUILD_BATCH;
+        SSize_t i;
+
+        /* Hash the keys first.  Keys which are get-magical, not strings,
+         * or may need to be downgraded from UTF-8 are left for hv_common()
+         * to deal with, as it would have to hash those again anyway. */
+        for (i = 0; i < n; i++) {
+            SV * const keysv = pairs[2 * i];
+            if (SvIsCOW_shared_hash(keysv))
+                hashes[i] = SvSHARED_HASH(keysv);
+            else if (SvPOK(keysv) && !SvGMAGICAL(keysv) && !SvUTF8(keysv))
+                PERL_HASH(hashes[i], SvPVX_const(keysv), SvCUR(keysv));
+            else
+                hashes[i] = 0;
+        }
+
+        /* then start pulling in the buckets they go in, and the shared
+         * string table buckets of their keys */
+        if (plain && HvARRAY(hv)) {
+            for (i = 0; i < n; i++) {
+                if (!hashes[i])
+                    continue;
+                HV_PREFETCH(&HvARRAY(hv)[HV_BUCKET_INDEX(hv, hashes[i])]);
+                if (HvSHAREKEYS(hv))
+                    HV_PREFETCH(&HvARRAY(PL_strtab)[hashes[i]
+                                                    & HvMAX(PL_strtab)]);
+            }
+        }
+
+        for (i = 0; i < n; i++) {
+            SV * const val = pairs[2 * i + 1]
+                             ? pairs[2 * i + 1] : newSV_type(SVt_NULL);
+            const bool stored = cBOOL(hv_common(hv, pairs[2 * i], NULL, 0, 0,
+                                                HV_FETCH_ISSTORE, val,
+                                                hashes[i]));
+            /* storing into a tied hash only adds set magic to val */
+            SvSETMAGIC(val);
+            if (!stored)
+                SvREFCNT_dec_NN(val);
+        }
+
+        pairs += 2 * n;
+        npairs -= n;
+    }
+}
+
 /* IMO this should also handle cases where hv_max is smaller than hv_keys
  * as tied hashes could play silly buggers and mess us around. We will
  * do the right thing during hv_store() afterwards, but still - Yves */
@@ -1812,6 +2022,11 @@ Perl_newHVhv(pTHX_ HV *ohv)
         STRLEN i;
         HE **ents, ** const oents = (HE **)HvARRAY(ohv);
         char *a;
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+        /* the copy gets the same layout, so it must be a settled one */
+        if (HvHasAUX(ohv) && HvAUX(ohv)->xhv_split_pending)
+            hsplit_step(ohv, HvAUX(ohv)->xhv_split_pending);
+#endif
         Newx(a, PERL_HV_ARRAY_ALLOC_BYTES(hv_max+1), char);
         ents = (HE**)a;
 
@@ -1845,13 +2060,13 @@ Perl_newHVhv(pTHX_ HV *ohv)
 
                 HeVAL(ent) = SvIMMORTAL(val) ? val : newSVsv(val);
                 if ((flags & HVhek_NOTSHARED) == 0) {
-                    HeKEY_hek(ent) = share_hek_hek(HeKEY_hek(oent));
+                    HeKEY_hek_set(ent, share_hek_hek(HeKEY_hek(oent)));
                 }
                 else {
                     const U32 hash   = HeHASH(oent);
                     const char * const key = HeKEY(oent);
                     const STRLEN len = HeKLEN(oent);
-                    HeKEY_hek(ent) = save_hek_flags(key, len, hash, flags);
+                    HeKEY_hek_set(ent, save_hek_flags(key, len, hash, flags));
                 }
                 if (prev)
                     HeNEXT(prev) = ent;
@@ -2358,6 +2573,10 @@ Perl_hv_undef_flags(pTHX_ HV *hv, U32 flags)
     Safefree(HvARRAY(hv));
     HvMAX(hv) = PERL_HASH_DEFAULT_HvMAX;        /* 7 (it's a normal hash) */
     HvARRAY(hv) = 0;
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+    if (HvHasAUX(hv))
+        HvAUX(hv)->xhv_split_pending = 0;
+#endif
 
     /* if we're freeing the HV, the SvMAGIC field has been reused for
      * other purposes, and so there can't be any placeholder magic */
@@ -2456,6 +2675,9 @@ S_hv_auxinit(pTHX_ HV *hv) {
     iter->xhv_backreferences = 0;
     iter->xhv_mro_meta = NULL;
     iter->xhv_aux_flags = 0;
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+    iter->xhv_split_pending = 0;
+#endif
     return iter;
 }
 
@@ -3282,7 +3504,8 @@ S_unshare_hek_or_pvn(pTHX_ const HEK *hek, const char *str, I32 len, U32 hash)
     } */
 
     /* assert(xhv_array != 0) */
-    oentry = &(HvARRAY(PL_strtab))[hash & (I32) HvMAX(PL_strtab)];
+    HV_SPLIT_STEP_IF_IDLE(PL_strtab);
+    oentry = &(HvARRAY(PL_strtab))[HV_BUCKET_INDEX(PL_strtab, hash)];
     if (he) {
         const HE *const he_he = &(he->shared_he_he);
         for (entry = *oentry; entry; oentry = &HeNEXT(entry), entry = *oentry) {
@@ -3292,7 +3515,7 @@ S_unshare_hek_or_pvn(pTHX_ const HEK *hek, const char *str, I32 len, U32 hash)
     } else {
         const U8 flags_masked = k_flags & HVhek_STORAGE_MASK;
         for (entry = *oentry; entry; oentry = &HeNEXT(entry), entry = *oentry) {
-            if (HeHASH(entry) != hash)		/* strings can't be equal */
+            if (HeHASH_cached(entry) != hash)		/* strings can't be equal */
                 continue;
             if (HeKLEN(entry) != len)
                 continue;
@@ -3362,7 +3585,7 @@ S_share_hek_flags(pTHX_ const char *str, STRLEN len, U32 hash, int flags)
 {
     HE *entry;
     const U8 flags_masked = flags & HVhek_STORAGE_MASK;
-    const U32 hindex = hash & (I32) HvMAX(PL_strtab);
+    U32 hindex;
 
     PERL_ARGS_ASSERT_SHARE_HEK_FLAGS;
     assert(!(flags & HVhek_NOTSHARED));
@@ -3381,9 +3604,11 @@ S_share_hek_flags(pTHX_ const char *str, STRLEN len, U32 hash, int flags)
     */
 
     /* assert(xhv_array != 0) */
+    HV_SPLIT_STEP_IF_IDLE(PL_strtab);
+    hindex = HV_BUCKET_INDEX(PL_strtab, hash);
     entry = (HvARRAY(PL_strtab))[hindex];
     for (;entry; entry = HeNEXT(entry)) {
-        if (HeHASH(entry) != hash)		/* strings can't be equal */
+        if (HeHASH_cached(entry) != hash)		/* strings can't be equal */
             continue;
         if (HeKLEN(entry) != (SSize_t) len)
             continue;
@@ -3425,7 +3650,7 @@ S_share_hek_flags(pTHX_ const char *str, STRLEN len, U32 hash, int flags)
 
         /* Still "point" to the HEK, so that other code need not know what
            we're up to.  */
-        HeKEY_hek(entry) = hek;
+        HeKEY_hek_set(entry, hek);
         entry->he_valu.hent_refcount = 0;
         HeNEXT(entry) = next;
         *head = entry;
@@ -3594,7 +3819,7 @@ Perl_refcounted_he_chain_2hv(pTHX_ const struct refcounted_he *chain, U32 flags)
         SV *value;
 
         for (; entry; entry = HeNEXT(entry)) {
-            if (HeHASH(entry) == hash) {
+            if (HeHASH_cached(entry) == hash) {
                 /* We might have a duplicate key here.  If so, entry is older
                    than the key we've already put in the hash, so if they are
                    the same, skip adding entry.  */
@@ -3621,14 +3846,14 @@ Perl_refcounted_he_chain_2hv(pTHX_ const struct refcounted_he *chain, U32 flags)
         entry = new_HE();
 
 #ifdef USE_ITHREADS
-        HeKEY_hek(entry)
-            = share_hek_flags(REF_HE_KEY(chain),
-                              chain->refcounted_he_keylen,
-                              chain->refcounted_he_hash,
-                              (chain->refcounted_he_data[0]
-                               & (HVhek_UTF8|HVhek_WASUTF8)));
+        HeKEY_hek_set(entry,
+                      share_hek_flags(REF_HE_KEY(chain),
+                                      chain->refcounted_he_keylen,
+                                      chain->refcounted_he_hash,
+                                      (chain->refcounted_he_data[0]
+                                       & (HVhek_UTF8|HVhek_WASUTF8))));
 #else
-        HeKEY_hek(entry) = share_hek_hek(chain->refcounted_he_hek);
+        HeKEY_hek_set(entry, share_hek_hek(chain->refcounted_he_hek));
 #endif
         value = refcounted_he_value(chain);
         if (value == &PL_sv_placeholder)
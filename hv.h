@@ -46,6 +46,10 @@ struct he {
         SV	*hent_val;	/* scalar value that was hashed */
         Size_t	hent_refcount;	/* references for this shared hash key */
     } he_valu;
+#ifdef PERL_HE_CACHE_HASH
+    U32		hent_hash;	/* copy of HEK_HASH(hent_hek), so that chain
+                                   walks need not dereference the HEK */
+#endif
 };
 
 /* hash key -- defined separately for use as shared pointer */
@@ -135,6 +139,10 @@ struct xpvhv_aux {
                                    used to detect each() after insert for warnings */
 #endif
     U32         xhv_aux_flags;      /* assorted extra flags */
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+    STRLEN      xhv_split_pending;  /* buckets of the lower half of the
+                                       array still waiting to be split */
+#endif
 
     /* The following fields are only valid if we have the flag HvAUXf_IS_CLASS */
     HV          *xhv_class_superclass;         /* STASH of the :isa() base class */
@@ -429,6 +437,26 @@ whether it is valid to call C<HvAUX()>.
 #define HeKFLAGS(he)  HEK_FLAGS(HeKEY_hek(he))
 #define HeVAL(he)		(he)->he_valu.hent_val
 #define HeHASH(he)		HEK_HASH(HeKEY_hek(he))
+
+/* Building with -DPERL_HE_CACHE_HASH keeps a copy of the key's hash in the
+ * HE itself.  Bucket chains are then filtered on the hash without touching
+ * the (usually cache-cold) HEK of each non-matching entry, at the cost of
+ * 8 more bytes per HE on 64-bit platforms.  Core code that stores a real
+ * key into a HE that may be linked into a hash must use HeKEY_hek_set(),
+ * and may use HeHASH_cached() wherever it would use HeHASH() on such an
+ * entry. */
+#ifdef PERL_HE_CACHE_HASH
+#  define HeHASH_cached(he)	(he)->hent_hash
+#  define HeKEY_hek_set(he,hek)					\
+        STMT_START {						\
+            HEK * const he_hek_ = (hek);			\
+            (he)->hent_hek = he_hek_;				\
+            (he)->hent_hash = HEK_HASH(he_hek_);		\
+        } STMT_END
+#else
+#  define HeHASH_cached(he)	HeHASH(he)
+#  define HeKEY_hek_set(he,hek)	((he)->hent_hek = (hek))
+#endif
 #define HePV(he,lp)		((HeKLEN(he) == HEf_SVKEY) ?		\
                                  SvPV(HeKEY_sv(he),lp) :		\
                                  ((lp = HeKLEN(he)), HeKEY(he)))
@@ -1372,6 +1372,27 @@ Perl_is_utf8_invariant_string_loc(const U8* const s, STRLEN len, const U8 ** ep)
                                       | ( ( (PTR2nat(x)                       \
                                            & PERL_WORD_BOUNDARY_MASK) >> 2))))
 
+#ifdef PERL_USE_SSE2
+
+    /* 16 bytes at a time.  Unaligned loads cost no more than aligned ones,
+     * so there is no need to first advance to a boundary.  _mm_movemask_epi8()
+     * gathers the upper bit of each byte, which is set just for variants */
+    while ((STRLEN) (send - x) >= 16) {
+        const int variants
+                    = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) x));
+        if (variants) {
+            if (ep) {
+                *ep = x + lsbit_pos32((U32) variants);
+            }
+
+            return FALSE;
+        }
+
+        x += 16;
+    }
+
+#endif
+
 #ifndef EBCDIC
 
     /* Do the word-at-a-time iff there is at least one usable full word.  That
@@ -1913,6 +1934,32 @@ S_variant_under_utf8_count(const U8* const s, const U8* const e)
 
     PERL_ARGS_ASSERT_VARIANT_UNDER_UTF8_COUNT;
 
+#  ifdef PERL_USE_SSE2
+
+    /* Compare 16 bytes at a time as signed, where the variants are the
+     * negative ones.  Each matching byte of the comparison is -1, which is
+     * subtracted from the running count in its column.  The columns can
+     * count up to 255 before _mm_sad_epu8() must add them up */
+    while ((STRLEN) (e - x) >= 16) {
+        const U8 * const chunk_end
+                        = x + 16 * MIN(255, (STRLEN) (e - x) / 16);
+        __m128i counts = _mm_setzero_si128();
+        __m128i sums;
+
+        do {
+            counts = _mm_sub_epi8(counts,
+                        _mm_cmplt_epi8(_mm_loadu_si128((const __m128i *) x),
+                                       _mm_setzero_si128()));
+            x += 16;
+        } while (x < chunk_end);
+
+        sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+        count += (Size_t) _mm_cvtsi128_si32(sums)
+               + (Size_t) _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+    }
+
+#  endif
+
 #  ifndef EBCDIC
 
     /* Test if the string is long enough to use word-at-a-time.  (Logic is the
@@ -1964,6 +2011,25 @@ S_variant_under_utf8_count(const U8* const s, const U8* const e)
 #  undef PERL_VARIANTS_WORD_MASK
 #endif
 
+/* Used in the validation loops below, which go a character at a time once
+ * they have found a variant.  Skip the invariant at 'x' and any that follow
+ * it, adding their number to 'count'.  Runs long enough for it to pay off,
+ * as in mostly ASCII text, are skipped in bulk; the single spaces between
+ * the words of other scripts are quicker done a byte at a time. */
+#define SKIP_INVARIANT_RUN_(x, send, count)                                 \
+    STMT_START {                                                            \
+        const U8 * const run_ = (x);                                        \
+        do {                                                                \
+            (x)++;                                                          \
+        } while ((x) < (send) && (x) - run_ < 8 && UTF8_IS_INVARIANT(*(x))); \
+        if (   (x) - run_ == 8 && (x) < (send)                              \
+            && is_utf8_invariant_string_loc((x), (send) - (x), &(x)))       \
+        {                                                                   \
+            (x) = (send);                                                   \
+        }                                                                   \
+        (count) += (x) - run_;                                              \
+    } STMT_END
+
 /*
 =for apidoc is_utf8_string
 
@@ -2258,7 +2324,14 @@ Perl_is_utf8_string_loclen(const U8 *s, STRLEN len, const U8 **ep, STRLEN *el)
         STRLEN outlen = first_variant - s;
 
         while (x < send) {
-            const STRLEN cur_len = isUTF8_CHAR(x, send);
+            STRLEN cur_len;
+
+            if (UTF8_IS_INVARIANT(*x)) {
+                SKIP_INVARIANT_RUN_(x, send, outlen);
+                continue;
+            }
+
+            cur_len = isUTF8_CHAR(x, send);
             if (UNLIKELY(! cur_len)) {
                 break;
             }
@@ -2610,7 +2683,14 @@ Perl_is_strict_utf8_string_loclen(const U8 *s, STRLEN len, const U8 **ep, STRLEN
         STRLEN outlen = first_variant - s;
 
         while (x < send) {
-            const STRLEN cur_len = isSTRICT_UTF8_CHAR(x, send);
+            STRLEN cur_len;
+
+            if (UTF8_IS_INVARIANT(*x)) {
+                SKIP_INVARIANT_RUN_(x, send, outlen);
+                continue;
+            }
+
+            cur_len = isSTRICT_UTF8_CHAR(x, send);
             if (UNLIKELY(! cur_len)) {
                 break;
             }
@@ -2687,7 +2767,14 @@ Perl_is_c9strict_utf8_string_loclen(const U8 *s, STRLEN len, const U8 **ep, STRL
         STRLEN outlen = first_variant - s;
 
         while (x < send) {
-            const STRLEN cur_len = isC9_STRICT_UTF8_CHAR(x, send);
+            STRLEN cur_len;
+
+            if (UTF8_IS_INVARIANT(*x)) {
+                SKIP_INVARIANT_RUN_(x, send, outlen);
+                continue;
+            }
+
+            cur_len = isC9_STRICT_UTF8_CHAR(x, send);
             if (UNLIKELY(! cur_len)) {
                 break;
             }
@@ -2787,7 +2874,14 @@ Perl_is_utf8_string_loclen_flags(const U8 *s, STRLEN len, const U8 **ep, STRLEN
         STRLEN outlen = first_variant - s;
 
         while (x < send) {
-            const STRLEN cur_len = isUTF8_CHAR_flags(x, send, flags);
+            STRLEN cur_len;
+
+            if (UTF8_IS_INVARIANT(*x)) {
+                SKIP_INVARIANT_RUN_(x, send, outlen);
+                continue;
+            }
+
+            cur_len = isUTF8_CHAR_flags(x, send, flags);
             if (UNLIKELY(! cur_len)) {
                 break;
             }
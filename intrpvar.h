@@ -66,6 +66,8 @@ PERLVARI(I, hash_rand_bits_enabled, U8, 1) /* used to randomize hash stuff
 PERLVARI(I, hash_rand_bits, UV, 0)      /* used to randomize hash stuff */
 #endif
 PERLVAR(I, strtab,	HV *)		/* shared string table */
+PERLVARI(I, hv_split_count, UV, 0)	/* hash array splits, and split steps */
+PERLVARI(I, hv_split_worst, UV, 0)	/* most entries one of them rehashed */
 /* prog counter for the currently executing OP_MULTIDEREF Used to signal
  * to S_find_uninit_var() where we are */
 PERLVAR(I, multideref_pc, UNOP_AUX_item *)
@@ -188,6 +190,9 @@ PERLVARI(I, reg_curpm, PMOP*, NULL)
 PERLVARI(I, regmatch_slab, regmatch_slab *,	NULL)
 PERLVAR(I, regmatch_state, regmatch_state *)
 
+/* cache of compiled run-time patterns, allocated on first use */
+PERLVARI(I, re_cache,	re_cache *,	NULL)
+
 PERLVAR(I, comppad,	PAD *)		/* storage for lexically scoped temporaries */
 
 /*
@@ -733,6 +738,11 @@ PERLVARI(I, padlist_generation, U32, 1)	/* id to identify padlist clones */
 
 PERLVARI(I, runops,	runops_proc_t, RUNOPS_DEFAULT)
 
+/* state of the sampling op profiler in run.c */
+PERLVARI(I, op_profile_counts, UV *, NULL)  /* executions of each op type */
+PERLVARI(I, op_profile_samples, HV *, NULL) /* collapsed stack => count */
+PERLVARI(I, op_profile_file, char *, NULL)  /* where to write them */
+
 PERLVAR(I, subname,	SV *)		/* name of current subroutine */
 
 PERLVAR(I, subline,	I32)		/* line this subroutine began on */
@@ -1,6 +1,6 @@
 package PerlIO;
 
-our $VERSION = '1.12';
+our $VERSION = '1.13';
 
 # Map layer name to package that defines it
 our %alias;
@@ -235,6 +235,36 @@ like C<:utf8>.  An example of a possible use might be:
 
 A more elegant (and safer) interface is needed.
 
+=item :bufsize(N)
+
+=item :bufsize(auto)
+
+=item :bufsize(auto,MAX)
+
+A pseudo-layer that sets the buffer size of the nearest C<:perlio> or
+C<:crlf> layer below it to I<N> bytes, in place of the default of 8192
+or the C library's C<BUFSIZ>, whichever is larger.  I<N> must be at
+least 16.  If there is no such layer the C<open> or C<binmode> fails.
+A large buffer means fewer system calls when a big file is
+read or written sequentially; a small one wastes less when only the
+start of many files is read.
+
+    open(my $fh, "<:bufsize(1048576)", $file)
+      or die "open failed: $!";
+    binmode($fh, ":bufsize(65536)") or die "binmode failed: $!";
+
+With C<auto> the buffer starts at its current size and doubles each time
+a read finds that the previous fill, which filled the whole buffer, has
+been completely consumed, up to a limit of I<MAX> bytes, or 1MB if no
+limit is given.  Reads interrupted by seeks do not grow the buffer, so a
+handle only pays for a large buffer when it is read from end to end.
+
+Changing the size of a buffer which holds data first flushes it, as
+C<seek> would.  If the layer below cannot seek back over unread data,
+the buffer keeps that data and does not shrink below it.  A handle
+duplicated with C<open(my $dup, "<&", $fh)> or when a thread is created
+keeps the size of the original.
+
 =back
 
 =head2 Custom Layers
@@ -379,6 +409,50 @@ the fourth element a name again, and so forth.
 
 B<You may open your eyes now.>
 
+=head2 Reading lines in batches
+
+   my @lines;
+   while (PerlIO::read_lines($fh, @lines, 10_000)) {
+       for my $line (@lines) { ... }
+   }
+
+read_lines() reads up to the given number of lines from a filehandle,
+as C<readline> does, using C<$/> and updating C<$.>, and sets the array
+to them.  It returns the number of lines read, which is 0 at end of
+file and less than the count if the file ended first.  Unlike C<readline>
+in list context it doesn't read the whole file at once, and unlike
+C<readline> in a loop the work is done in a single call.
+
+The scalars already in the array are read into again, so the buffers
+they have allocated are reused from one batch to the next, unless
+something else holds a reference to them.  The array itself is passed
+by reference, because of the C<*\@$> prototype; without the prototype,
+as in C<&PerlIO::read_lines($fh, \@lines, 100)>, pass a reference.
+
+It returns C<undef> and sets C<$!> if the handle is not open.  It does
+not do the C<ARGV> processing of C<< <> >>, but reads from a tied
+handle by calling its C<READLINE> method for each line.
+
+=head2 Copying between filehandles
+
+   open my $in, "<", $file or die;
+   defined(PerlIO::copy($in, $socket)) or die "copy failed: $!";
+
+copy() copies from the position an input filehandle has reached to an
+output filehandle, to the end of the file or, given a third argument, up
+to that many bytes, and returns the number of bytes copied.  It returns
+C<undef> and sets C<$!> if it fails before copying anything, and otherwise
+the number copied up to the failure, as C<syswrite> does.
+
+When each handle has only the C<:unix> and C<:perlio> layers, and both or
+neither are C<:utf8>, what is in the input buffer is written out, the
+output buffer is flushed, and on Linux the kernel is asked to copy the
+rest with C<copy_file_range>, C<sendfile> or C<splice>, whichever can
+be used with the two file descriptors.  Otherwise, or when none of them
+can, the data is read and printed in large blocks, converting to or from
+UTF-8 as C<print> would.  The positions of the handles are kept up to
+date either way.
+
 =head1 AUTHOR
 
 Nick Ing-Simmons E<lt>nick@ing-simmons.netE<gt>
@@ -3,7 +3,10 @@ package sort;
 use strict;
 use warnings;
 
-our $VERSION = '2.05';
+our $VERSION = '2.06';
+
+# the default for "use sort 'parallel'"
+my $parallel_threshold = 1_000_000;
 
 sub import {
     shift;
@@ -12,11 +15,26 @@ sub import {
 	Carp::croak("sort pragma requires arguments");
     }
     $^H{sort} //= 0;
-    for my $subpragma (@_) {
+    while (@_) {
+        my $subpragma = shift;
         next
             if $subpragma eq 'stable' || $subpragma eq 'defaults';
+        if ($subpragma eq 'parallel') {
+            $^H{sort_parallel} =
+                @_ && $_[0] =~ /\A[0-9]+\z/ ? shift : $parallel_threshold;
+            next;
+        }
+        if ($subpragma eq 'threads') {
+            my $threads = shift;
+            if (!defined $threads || $threads !~ /\A[0-9]+\z/) {
+                require Carp;
+                Carp::croak("sort: 'threads' needs a number of threads");
+            }
+            $^H{sort_threads} = $threads;
+            next;
+        }
         require Carp;
-        Carp::croak("sort: unknown subpragma '$_'");
+        Carp::croak("sort: unknown subpragma '$subpragma'");
     }
 }
 
@@ -29,8 +47,13 @@ sub unimport {
     for my $subpragma (@_) {
         next
             if $subpragma eq 'stable';
+        if ($subpragma eq 'parallel') {
+            delete $^H{sort_parallel};
+            delete $^H{sort_threads};
+            next;
+        }
         require Carp;
-        Carp::croak("sort: unknown subpragma '$_'");
+        Carp::croak("sort: unknown subpragma '$subpragma'");
     }
 }
 
@@ -48,8 +71,13 @@ sort - perl pragma to control sort() behaviour
 
 =head1 SYNOPSIS
 
-The sort pragma is now a no-op, and its use is discouraged. These three
-operations are valid, but have no effect:
+    use sort 'parallel';		# sort big arrays using threads
+    use sort parallel => 100_000;	# ... of at least 100_000 elements
+    use sort threads => 4;		# ... using 4 threads
+    no  sort 'parallel';		# back to sorting serially
+
+Apart from C<parallel>, the sort pragma is now a no-op, and its use is
+discouraged. These three operations are valid, but have no effect:
 
     use sort 'stable';		# guarantee stability
     use sort 'defaults';	# revert to default behavior
@@ -88,6 +116,40 @@ used for all keys and has larger overheads.)
 We are not averse to B<changing> the sort algorithm, but we don't see the
 benefit in offering the choice of two general purpose implementations.
 
+=head1 PARALLEL SORTING
+
+On perls built with threads, C<use sort 'parallel'> lets C<sort> split
+large arrays between several threads.  This only applies to sorts which
+use one of the built-in comparisons, i.e. no block or sub at all, or
+one of
+
+    sort { $a <=> $b } ...
+    sort { $b <=> $a } ...
+    sort { $a cmp $b } ...
+    sort { $b cmp $a } ...
+
+The result is exactly the same as a normal sort, including the order of
+elements which compare equal.
+
+By default only arrays of at least 1_000_000 elements are sorted in
+parallel, since below that the cost of starting the threads outweighs
+the gain.  A different threshold can be given as
+C<< use sort parallel => $threshold >>.
+
+The number of threads defaults to the number of online CPUs, and can be
+set with C<< use sort threads => $n >>.  It is rounded down to a power
+of two, and capped at 8 (or C<PERL_SORT_MAX_THREADS> if perl was built
+with that defined).  With fewer than two, sorts are never parallel.
+
+The threads don't run any perl code, so the array is sorted serially
+anyway if any of its elements are tied or otherwise magical, or
+overloaded, if any number is a NaN, or if a sort by numeric value mixes
+floating point values with integers too big to be held exactly as one.
+For string sorts, all
+the strings need to have the same UTF-8 flag, and C<use locale> must
+not be in effect.  On perls without threads, the pragma is accepted but
+has no effect.
+
 =head1 CAVEATS
 
 The function C<sort::current()> was provided to report the current state of
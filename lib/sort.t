@@ -212,4 +212,62 @@ main(sub { sort {&{$_[0]}} @{$_[1]} }, 0);
     is($sort_current, 'stable', 'sort::current for stable');
 }
 
+# use sort 'parallel' has to give exactly the same result as the serial
+# sort, including the order of elements which compare equal, which the
+# string forms of these numbers make visible.  Force it on for small
+# arrays, and with more threads than there are likely to be CPUs.
+{
+    my @int = map { my $n = int rand 500; ($n, "0$n") } 1 .. 3000;
+    my @num = map { my $n = int(rand 500) / 4; ($n, sprintf "%.2f", $n) }
+        1 .. 3000;
+    my @str = map { sprintf "%03d", rand 500 } 1 .. 6000;
+    my @utf = map { "\x{100}" . chr(0x80 + rand 300) } 1 .. 6000;
+    my $sorts = <<'EOS';
+        my %got;
+        $got{int}     = [ sort { $a <=> $b } @int ];
+        $got{intdesc} = [ sort { $b <=> $a } @int ];
+        $got{num}     = [ sort { $a <=> $b } @num ];
+        $got{numdesc} = [ sort { $b <=> $a } @num ];
+        $got{str}     = [ sort @str ];
+        $got{strdesc} = [ sort { $b cmp $a } @str ];
+        $got{utf}     = [ sort @utf ];
+        {
+            use integer;
+            $got{integer} = [ sort { $a <=> $b } @num ];
+        }
+        my @inplace = @num;
+        @inplace = reverse sort { $a <=> $b } @inplace;
+        $got{inplace} = \@inplace;
+        \%got;
+EOS
+    my $serial = eval $sorts or die $@;
+    for my $threads (2, 3, 4, 8) {
+        my $got = eval "use sort parallel => 0, threads => $threads; $sorts"
+            or die $@;
+        for my $kind (sort keys %$serial) {
+            is("@{$got->{$kind}}", "@{$serial->{$kind}}",
+               "parallel $kind sort with $threads threads");
+        }
+    }
+
+    my $threshold = eval <<'EOS' or die $@;
+        use sort parallel => 10_000;
+        my $hint;
+        BEGIN { $hint = $^H{sort_parallel} }
+        $hint;
+EOS
+    is($threshold, 10_000, "use sort parallel => N sets the threshold");
+    my $off = eval <<'EOS';
+        use sort 'parallel';
+        no sort 'parallel';
+        my $hint;
+        BEGIN { $hint = exists $^H{sort_parallel} ? 1 : 0 }
+        $hint;
+EOS
+    is($off, 0, "no sort 'parallel'");
+    ok(!eval "use sort threads => 'lots'; 1", "threads needs a number");
+    like($@, qr/^sort: 'threads' needs a number of threads/,
+         "... with the right error");
+}
+
 done_testing();
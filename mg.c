@@ -147,6 +147,9 @@ Perl_mg_magical(SV *sv)
                 if (vtbl->svt_clear)
                     SvRMAGICAL_on(sv);
             }
+            else if (mg->mg_type == PERL_MAGIC_view)
+                /* so writing to it goes through sv_force_normal() */
+                SvRMAGICAL_on(sv);
         } while ((mg = mg->mg_moremagic));
         if (!(SvFLAGS(sv) & (SVs_GMG|SVs_SMG)))
             SvRMAGICAL_on(sv);
@@ -74,6 +74,8 @@
       "/* vstring 'V' SV was vstring literal */" },
     { 'v', "want_vtbl_vec | PERL_MAGIC_VALUE_MAGIC",
       "/* vec 'v' vec() lvalue */" },
+    { 'W', "magic_vtable_max | PERL_MAGIC_VALUE_MAGIC",
+      "/* view 'W' SV's string is in another SV's buffer */" },
     { 'w', "want_vtbl_utf8 | PERL_MAGIC_VALUE_MAGIC",
       "/* utf8 'w' Cached UTF-8 information */" },
     { 'X', "want_vtbl_destruct | PERL_MAGIC_VALUE_MAGIC",
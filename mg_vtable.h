@@ -50,6 +50,7 @@
 #define PERL_MAGIC_uvar_elem      'u' /* Reserved for use by extensions */
 #define PERL_MAGIC_vstring        'V' /* SV was vstring literal */
 #define PERL_MAGIC_vec            'v' /* vec() lvalue */
+#define PERL_MAGIC_view           'W' /* SV's string is in another SV's buffer */
 #define PERL_MAGIC_utf8           'w' /* Cached UTF-8 information */
 #define PERL_MAGIC_destruct       'X' /* destruct callback */
 #define PERL_MAGIC_substr         'x' /* substr() lvalue */
@@ -14009,6 +14009,28 @@ Perl_ck_split(pTHX_ OP *o)
     o = kid;
     kid = sibs; /* kid is now the string arg of the split */
 
+    /* A constant pattern that matches just a fixed string, like /,/ or
+     * /::/, lets pp_split() take its fixed string path without counting
+     * the characters in the subject, as long as the subject has the
+     * same utf8ness as the pattern */
+    if (cLISTOPo->op_first == kid) { /* no regcomp op */
+        REGEXP * const rx = PM_GETRE(cPMOPo);
+        if (rx) {
+            const U32 extflags = RX_EXTFLAGS(rx);
+            SV * const csv = (extflags & RXf_USE_INTUIT)
+                           ? CALLREG_INTUIT_STRING(rx) : NULL;
+
+            if (   csv && SvCUR(csv) && !RX_NPARENS(rx)
+                && (extflags & RXf_CHECK_ALL)
+                && !(extflags & (RXf_IS_ANCHORED|RXf_INTUIT_TAIL
+                                |RXf_SKIPWHITE|RXf_WHITE|RXf_START_ONLY
+                                |RXf_NULL|RXf_EVAL_SEEN)))
+            {
+                o->op_private |= OPpSPLIT_FIXED;
+            }
+        }
+    }
+
     if (!kid) {
         kid = newDEFSVOP();
         op_append_elem(OP_SPLIT, o, kid);
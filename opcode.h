@@ -2301,6 +2301,7 @@ END_EXTERN_C
 #define OPpITER_REVERSED        0x02
 #define OPpMETH_NO_BAREWORD_IO  0x02
 #define OPpSORT_INTEGER         0x02
+#define OPpSPLIT_FIXED          0x02
 #define OPpTRANS_USE_SVOP       0x02
 #define OPpARG2_MASK            0x03
 #define OPpAVHVSWITCH_MASK      0x03
@@ -2469,6 +2470,7 @@ EXTCONST char PL_op_private_labels[] = {
     'F','A','K','E','\0',
     'F','I','L','E','\0',
     'F','I','N','A','L','L','Y','\0',
+    'F','I','X','E','D','\0',
     'F','T','A','C','C','E','S','S','\0',
     'F','T','A','F','T','E','R','t','\0',
     'F','T','S','T','A','C','K','E','D','\0',
@@ -2555,15 +2557,15 @@ EXTCONST char PL_op_private_labels[] = {
 EXTCONST I16 PL_op_private_bitfields[] = {
     0, 8, -1,
     0, 8, -1,
-    0, 714, -1,
+    0, 720, -1,
     0, 8, -1,
     0, 8, -1,
-    0, 721, -1,
-    0, 710, -1,
-    1, -1, 0, 665, 1, 39, 2, 324, -1,
+    0, 727, -1,
+    0, 716, -1,
+    1, -1, 0, 671, 1, 39, 2, 330, -1,
     4, -1, 1, 185, 2, 192, 3, 199, -1,
-    4, -1, 0, 665, 1, 39, 2, 324, 3, 131, -1,
-    6, 680, 1, 455, 2, 246, 3, 567, -1,
+    4, -1, 0, 671, 1, 39, 2, 330, 3, 131, -1,
+    6, 686, 1, 461, 2, 246, 3, 573, -1,
 
 };
 
@@ -2732,73 +2734,73 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
       56, /* pack */
      157, /* split */
       56, /* join */
-     162, /* list */
+     163, /* list */
       13, /* lslice */
       56, /* anonlist */
       56, /* anonhash */
-     164, /* emptyavhv */
+     165, /* emptyavhv */
       56, /* splice */
      102, /* push */
        0, /* pop */
        0, /* shift */
      102, /* unshift */
-     169, /* sort */
-     174, /* reverse */
+     170, /* sort */
+     175, /* reverse */
        0, /* grepstart */
-     176, /* grepwhile */
+     177, /* grepwhile */
        0, /* mapstart */
        0, /* mapwhile */
        0, /* range */
-     178, /* flip */
-     178, /* flop */
+     179, /* flip */
+     179, /* flop */
        0, /* and */
        0, /* or */
       13, /* xor */
        0, /* dor */
-     180, /* cond_expr */
+     181, /* cond_expr */
        0, /* andassign */
        0, /* orassign */
        0, /* dorassign */
-     182, /* entersub */
-     189, /* leavesub */
-     189, /* leavesublv */
+     183, /* entersub */
+     190, /* leavesub */
+     190, /* leavesublv */
        0, /* argcheck */
-     191, /* argelem */
-     193, /* argdefelem */
-     196, /* caller */
+     192, /* argelem */
+     194, /* argdefelem */
+     197, /* caller */
       56, /* warn */
       56, /* die */
       56, /* reset */
       -1, /* lineseq */
-     198, /* nextstate */
-     198, /* dbstate */
+     199, /* nextstate */
+     199, /* dbstate */
       -1, /* unstack */
       -1, /* enter */
-     199, /* leave */
+     200, /* leave */
       -1, /* scope */
-     201, /* enteriter */
-     205, /* iter */
+     202, /* enteriter */
+     206, /* iter */
       -1, /* enterloop */
-     206, /* leaveloop */
+     207, /* leaveloop */
       -1, /* return */
-     208, /* last */
-     208, /* next */
-     208, /* redo */
-     208, /* dump */
-     208, /* goto */
+     209, /* last */
+     209, /* next */
+     209, /* redo */
+     209, /* dump */
+     209, /* goto */
       56, /* exit */
-     210, /* method */
-     210, /* method_named */
-     210, /* method_super */
-     210, /* method_redir */
-     210, /* method_redir_super */
+     211, /* method */
+     211, /* method_named */
+     211, /* method_super */
+     211, /* method_redir */
+     211, /* method_redir_super */
        0, /* entergiven */
        0, /* leavegiven */
        0, /* enterwhen */
        0, /* leavewhen */
       -1, /* break */
       -1, /* continue */
-     212, /* open */
+     213, /* open */
       56, /* close */
       56, /* pipe_op */
       56, /* fileno */
@@ -2814,7 +2816,7 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
       56, /* getc */
       56, /* read */
       56, /* enterwrite */
-     189, /* leavewrite */
+     190, /* leavewrite */
       -1, /* prtf */
       -1, /* print */
       -1, /* say */
@@ -2844,33 +2846,33 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* getpeername */
        0, /* lstat */
        0, /* stat */
-     217, /* ftrread */
-     217, /* ftrwrite */
-     217, /* ftrexec */
-     217, /* fteread */
-     217, /* ftewrite */
-     217, /* fteexec */
-     222, /* ftis */
-     222, /* ftsize */
-     222, /* ftmtime */
-     222, /* ftatime */
-     222, /* ftctime */
-     222, /* ftrowned */
-     222, /* fteowned */
-     222, /* ftzero */
-     222, /* ftsock */
-     222, /* ftchr */
-     222, /* ftblk */
-     222, /* ftfile */
-     222, /* ftdir */
-     222, /* ftpipe */
-     222, /* ftsuid */
-     222, /* ftsgid */
-     222, /* ftsvtx */
-     222, /* ftlink */
-     222, /* fttty */
-     222, /* fttext */
-     222, /* ftbinary */
+     218, /* ftrread */
+     218, /* ftrwrite */
+     218, /* ftrexec */
+     218, /* fteread */
+     218, /* ftewrite */
+     218, /* fteexec */
+     223, /* ftis */
+     223, /* ftsize */
+     223, /* ftmtime */
+     223, /* ftatime */
+     223, /* ftctime */
+     223, /* ftrowned */
+     223, /* fteowned */
+     223, /* ftzero */
+     223, /* ftsock */
+     223, /* ftchr */
+     223, /* ftblk */
+     223, /* ftfile */
+     223, /* ftdir */
+     223, /* ftpipe */
+     223, /* ftsuid */
+     223, /* ftsgid */
+     223, /* ftsvtx */
+     223, /* ftlink */
+     223, /* fttty */
+     223, /* fttext */
+     223, /* ftbinary */
      102, /* chdir */
      102, /* chown */
       79, /* chroot */
@@ -2890,17 +2892,17 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* rewinddir */
        0, /* closedir */
       -1, /* fork */
-     226, /* wait */
+     227, /* wait */
      102, /* waitpid */
      102, /* system */
      102, /* exec */
      102, /* kill */
-     226, /* getppid */
+     227, /* getppid */
      102, /* getpgrp */
      102, /* setpgrp */
      102, /* getpriority */
      102, /* setpriority */
-     226, /* time */
+     227, /* time */
       -1, /* tms */
        0, /* localtime */
       56, /* gmtime */
@@ -2920,8 +2922,8 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* require */
        0, /* dofile */
       -1, /* hintseval */
-     227, /* entereval */
-     189, /* leaveeval */
+     228, /* entereval */
+     190, /* leaveeval */
        0, /* entertry */
       -1, /* leavetry */
        0, /* ghbyname */
@@ -2959,17 +2961,17 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* lock */
        0, /* once */
       -1, /* custom */
-     234, /* coreargs */
-     238, /* avhvswitch */
+     235, /* coreargs */
+     239, /* avhvswitch */
        3, /* runcv */
        0, /* fc */
       -1, /* padcv */
       -1, /* introcv */
       -1, /* clonecv */
-     240, /* padrange */
-     242, /* refassign */
-     248, /* lvref */
-     254, /* lvrefslice */
+     241, /* padrange */
+     243, /* refassign */
+     249, /* lvref */
+     255, /* lvrefslice */
       17, /* lvavref */
        0, /* anonconst */
       13, /* isa */
@@ -2979,7 +2981,7 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
       -1, /* leavetrycatch */
       -1, /* poptry */
        0, /* catch */
-     255, /* pushdefer */
+     256, /* pushdefer */
        0, /* is_bool */
        0, /* is_weak */
        0, /* weaken */
@@ -2990,9 +2992,9 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
       79, /* ceil */
       79, /* floor */
        0, /* is_tainted */
-     257, /* helemexistsor */
-     259, /* methstart */
-     261, /* initfield */
+     258, /* helemexistsor */
+     260, /* methstart */
+     262, /* initfield */
       -1, /* classname */
 
 };
@@ -3013,85 +3015,85 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
 
 EXTCONST U16  PL_op_private_bitdefs[] = {
     0x0003, /* scalar, prototype, refgen, srefgen, readline, regcmaybe, regcreset, regcomp, substcont, chop, schop, defined, study, preinc, i_preinc, predec, i_predec, postinc, i_postinc, postdec, i_postdec, not, ucfirst, lcfirst, uc, lc, quotemeta, aeach, avalues, each, pop, shift, grepstart, mapstart, mapwhile, range, and, or, dor, andassign, orassign, dorassign, argcheck, entergiven, leavegiven, enterwhen, leavewhen, untie, tied, dbmclose, getsockname, getpeername, lstat, stat, readlink, readdir, telldir, rewinddir, closedir, localtime, alarm, require, dofile, entertry, ghbyname, gnbyname, gpbyname, shostent, snetent, sprotoent, sservent, gpwnam, gpwuid, ggrnam, ggrgid, lock, once, fc, anonconst, cmpchain_and, cmpchain_dup, entertrycatch, catch, is_bool, is_weak, weaken, unweaken, is_tainted */
-    0x3bfc, 0x4fd9, /* pushmark */
+    0x3cbc, 0x5099, /* pushmark */
     0x00bd, /* wantarray, runcv */
-    0x065e, 0x0554, 0x1b70, 0x508c, 0x4c28, 0x4125, /* const */
-    0x3bfc, 0x4459, /* gvsv */
+    0x065e, 0x0554, 0x1b70, 0x514c, 0x4ce8, 0x41e5, /* const */
+    0x3cbc, 0x4519, /* gvsv */
     0x19d5, /* gv */
     0x0067, /* gelem, lt, i_lt, gt, i_gt, le, i_le, ge, i_ge, eq, i_eq, ne, i_ne, ncmp, i_ncmp, slt, sgt, sle, sge, seq, sne, scmp, smartmatch, lslice, xor, isa */
-    0x3bfc, 0x4fd8, 0x03d7, /* padsv */
-    0x3bfc, 0x4fd8, 0x0003, /* padsv_store, lvavref */
-    0x3bfc, 0x4fd8, 0x06d4, 0x3cec, 0x4da9, /* padav */
-    0x3bfc, 0x4fd8, 0x06d4, 0x0770, 0x3cec, 0x4da8, 0x36c1, /* padhv */
-    0x3bfc, 0x1e38, 0x03d6, 0x3cec, 0x4048, 0x5084, 0x0003, /* rv2gv */
-    0x3bfc, 0x4458, 0x03d6, 0x5084, 0x0003, /* rv2sv */
-    0x3cec, 0x0003, /* av2arylen, akeys, values, keys */
-    0x3fbc, 0x1198, 0x0ef4, 0x014c, 0x5388, 0x5084, 0x0003, /* rv2cv */
+    0x3cbc, 0x5098, 0x03d7, /* padsv */
+    0x3cbc, 0x5098, 0x0003, /* padsv_store, lvavref */
+    0x3cbc, 0x5098, 0x06d4, 0x3dac, 0x4e69, /* padav */
+    0x3cbc, 0x5098, 0x06d4, 0x0770, 0x3dac, 0x4e68, 0x3781, /* padhv */
+    0x3cbc, 0x1e38, 0x03d6, 0x3dac, 0x4108, 0x5144, 0x0003, /* rv2gv */
+    0x3cbc, 0x4518, 0x03d6, 0x5144, 0x0003, /* rv2sv */
+    0x3dac, 0x0003, /* av2arylen, akeys, values, keys */
+    0x407c, 0x1198, 0x0ef4, 0x014c, 0x5448, 0x5144, 0x0003, /* rv2cv */
     0x06d4, 0x0770, 0x0003, /* ref, blessed */
     0x018f, /* bless, glob, sprintf, formline, unpack, pack, join, anonlist, anonhash, splice, warn, die, reset, exit, close, pipe_op, fileno, umask, binmode, tie, dbmopen, sselect, select, getc, read, enterwrite, sysopen, sysseek, sysread, syswrite, eof, tell, seek, truncate, fcntl, ioctl, send, recv, socket, sockpair, bind, connect, listen, accept, shutdown, gsockopt, ssockopt, open_dir, seekdir, gmtime, shmget, shmctl, shmread, shmwrite, msgget, msgctl, msgsnd, msgrcv, semop, semget, semctl, ghbyaddr, gnbyaddr, gpbynumber, gsbyname, gsbyport, syscall */
-    0x463c, 0x4558, 0x2e74, 0x2db0, 0x0003, /* backtick */
+    0x46fc, 0x4618, 0x2f34, 0x2e70, 0x0003, /* backtick */
     0x06d5, /* subst */
-    0x129c, 0x2558, 0x0ad4, 0x4eec, 0x28e8, 0x5724, 0x08e1, /* trans, transr */
+    0x129c, 0x2618, 0x0ad4, 0x4fac, 0x29a8, 0x57e4, 0x08e1, /* trans, transr */
     0x10dc, 0x05f8, 0x0067, /* sassign */
-    0x0d98, 0x0c94, 0x0b90, 0x3cec, 0x06c8, 0x0067, /* aassign */
-    0x5430, 0x0003, /* chomp, schomp, negate, i_negate, scomplement, sin, cos, exp, log, sqrt, int, hex, oct, abs, ord, chr, chroot, rmdir, refaddr, reftype, ceil, floor */
-    0x3bfc, 0x4fd8, 0x35d4, 0x5430, 0x0003, /* undef */
-    0x06d4, 0x3cec, 0x0003, /* pos */
-    0x5430, 0x0067, /* pow, multiply, i_multiply, divide, i_divide, modulo, i_modulo, add, i_add, subtract, i_subtract */
+    0x0d98, 0x0c94, 0x0b90, 0x3dac, 0x06c8, 0x0067, /* aassign */
+    0x54f0, 0x0003, /* chomp, schomp, negate, i_negate, scomplement, sin, cos, exp, log, sqrt, int, hex, oct, abs, ord, chr, chroot, rmdir, refaddr, reftype, ceil, floor */
+    0x3cbc, 0x5098, 0x3694, 0x54f0, 0x0003, /* undef */
+    0x06d4, 0x3dac, 0x0003, /* pos */
+    0x54f0, 0x0067, /* pow, multiply, i_multiply, divide, i_divide, modulo, i_modulo, add, i_add, subtract, i_subtract */
     0x1658, 0x0067, /* repeat */
-    0x3ed8, 0x5430, 0x0067, /* concat */
-    0x3bfc, 0x0338, 0x1e34, 0x5430, 0x516c, 0x0003, /* multiconcat */
-    0x5430, 0x018f, /* stringify, atan2, rand, srand, crypt, push, unshift, flock, chdir, chown, unlink, chmod, utime, rename, link, symlink, mkdir, waitpid, system, exec, kill, getpgrp, setpgrp, getpriority, setpriority, sleep */
-    0x5430, 0x5649, /* left_shift, right_shift, nbit_and, nbit_xor, nbit_or, ncomplement */
-    0x5649, /* bit_and, bit_xor, bit_or, sbit_and, sbit_xor, sbit_or, complement */
-    0x06d4, 0x5430, 0x0003, /* length */
-    0x4990, 0x3cec, 0x012b, /* substr */
-    0x3cec, 0x0067, /* vec */
-    0x3e58, 0x06d4, 0x5430, 0x018f, /* index, rindex */
-    0x3bfc, 0x4458, 0x06d4, 0x3cec, 0x4da8, 0x5084, 0x0003, /* rv2av */
+    0x3f98, 0x54f0, 0x0067, /* concat */
+    0x3cbc, 0x0338, 0x1e34, 0x54f0, 0x522c, 0x0003, /* multiconcat */
+    0x54f0, 0x018f, /* stringify, atan2, rand, srand, crypt, push, unshift, flock, chdir, chown, unlink, chmod, utime, rename, link, symlink, mkdir, waitpid, system, exec, kill, getpgrp, setpgrp, getpriority, setpriority, sleep */
+    0x54f0, 0x5709, /* left_shift, right_shift, nbit_and, nbit_xor, nbit_or, ncomplement */
+    0x5709, /* bit_and, bit_xor, bit_or, sbit_and, sbit_xor, sbit_or, complement */
+    0x06d4, 0x54f0, 0x0003, /* length */
+    0x4a50, 0x3dac, 0x012b, /* substr */
+    0x3dac, 0x0067, /* vec */
+    0x3f18, 0x06d4, 0x54f0, 0x018f, /* index, rindex */
+    0x3cbc, 0x4518, 0x06d4, 0x3dac, 0x4e68, 0x5144, 0x0003, /* rv2av */
     0x025f, /* aelemfast, aelemfast_lex, aelemfastlex_store */
-    0x3bfc, 0x3af8, 0x03d6, 0x3cec, 0x0067, /* aelem, helem */
-    0x3bfc, 0x3cec, 0x4da9, /* aslice, hslice */
-    0x3ced, /* kvaslice, kvhslice */
-    0x3bfc, 0x4cf8, 0x3774, 0x0003, /* delete */
-    0x52b8, 0x0003, /* exists */
-    0x3bfc, 0x4458, 0x06d4, 0x0770, 0x3cec, 0x4da8, 0x5084, 0x36c1, /* rv2hv */
-    0x3bfc, 0x3af8, 0x1314, 0x1d50, 0x3cec, 0x5084, 0x0003, /* multideref */
-    0x3bfc, 0x4458, 0x0410, 0x386c, 0x2be9, /* split */
-    0x3bfc, 0x2619, /* list */
-    0x3bfc, 0x4fd8, 0x0214, 0x5430, 0x018f, /* emptyavhv */
-    0x15b0, 0x33ac, 0x4a88, 0x34a4, 0x43c1, /* sort */
-    0x33ac, 0x0003, /* reverse */
+    0x3cbc, 0x3bb8, 0x03d6, 0x3dac, 0x0067, /* aelem, helem */
+    0x3cbc, 0x3dac, 0x4e69, /* aslice, hslice */
+    0x3dad, /* kvaslice, kvhslice */
+    0x3cbc, 0x4db8, 0x3834, 0x0003, /* delete */
+    0x5378, 0x0003, /* exists */
+    0x3cbc, 0x4518, 0x06d4, 0x0770, 0x3dac, 0x4e68, 0x5144, 0x3781, /* rv2hv */
+    0x3cbc, 0x3bb8, 0x1314, 0x1d50, 0x3dac, 0x5144, 0x0003, /* multideref */
+    0x3cbc, 0x4518, 0x0410, 0x392c, 0x2ca8, 0x2065, /* split */
+    0x3cbc, 0x26d9, /* list */
+    0x3cbc, 0x5098, 0x0214, 0x54f0, 0x018f, /* emptyavhv */
+    0x15b0, 0x346c, 0x4b48, 0x3564, 0x4481, /* sort */
+    0x346c, 0x0003, /* reverse */
     0x06d4, 0x0003, /* grepwhile */
-    0x3998, 0x0003, /* flip, flop */
-    0x3bfc, 0x0003, /* cond_expr */
-    0x3bfc, 0x1198, 0x03d6, 0x014c, 0x5388, 0x5084, 0x2cc1, /* entersub */
-    0x47f8, 0x0003, /* leavesub, leavesublv, leavewrite, leaveeval */
+    0x3a58, 0x0003, /* flip, flop */
+    0x3cbc, 0x0003, /* cond_expr */
+    0x3cbc, 0x1198, 0x03d6, 0x014c, 0x5448, 0x5144, 0x2d81, /* entersub */
+    0x48b8, 0x0003, /* leavesub, leavesublv, leavewrite, leaveeval */
     0x02aa, 0x0003, /* argelem */
-    0x2adc, 0x29b8, 0x0003, /* argdefelem */
+    0x2b9c, 0x2a78, 0x0003, /* argdefelem */
     0x00bc, 0x018f, /* caller */
-    0x27f5, /* nextstate, dbstate */
-    0x3a9c, 0x47f9, /* leave */
-    0x3bfc, 0x4458, 0x120c, 0x4b05, /* enteriter */
-    0x4b05, /* iter */
-    0x3a9c, 0x0067, /* leaveloop */
-    0x585c, 0x0003, /* last, next, redo, dump, goto */
-    0x41e4, 0x0003, /* method, method_named, method_super, method_redir, method_redir_super */
-    0x463c, 0x4558, 0x2e74, 0x2db0, 0x018f, /* open */
-    0x2190, 0x23ec, 0x22a8, 0x2064, 0x0003, /* ftrread, ftrwrite, ftrexec, fteread, ftewrite, fteexec */
-    0x2190, 0x23ec, 0x22a8, 0x0003, /* ftis, ftsize, ftmtime, ftatime, ftctime, ftrowned, fteowned, ftzero, ftsock, ftchr, ftblk, ftfile, ftdir, ftpipe, ftsuid, ftsgid, ftsvtx, ftlink, fttty, fttext, ftbinary */
-    0x5431, /* wait, getppid, time */
-    0x1c78, 0x4894, 0x0fb0, 0x082c, 0x55c8, 0x2704, 0x0003, /* entereval */
-    0x3dbc, 0x0018, 0x14c4, 0x13e1, /* coreargs */
-    0x3cec, 0x00c7, /* avhvswitch */
-    0x3bfc, 0x01fb, /* padrange */
-    0x3bfc, 0x4fd8, 0x04f6, 0x352c, 0x1ac8, 0x0067, /* refassign */
-    0x3bfc, 0x4fd8, 0x04f6, 0x352c, 0x1ac8, 0x0003, /* lvref */
-    0x3bfd, /* lvrefslice */
+    0x28b5, /* nextstate, dbstate */
+    0x3b5c, 0x48b9, /* leave */
+    0x3cbc, 0x4518, 0x120c, 0x4bc5, /* enteriter */
+    0x4bc5, /* iter */
+    0x3b5c, 0x0067, /* leaveloop */
+    0x591c, 0x0003, /* last, next, redo, dump, goto */
+    0x42a4, 0x0003, /* method, method_named, method_super, method_redir, method_redir_super */
+    0x46fc, 0x4618, 0x2f34, 0x2e70, 0x018f, /* open */
+    0x2250, 0x24ac, 0x2368, 0x2124, 0x0003, /* ftrread, ftrwrite, ftrexec, fteread, ftewrite, fteexec */
+    0x2250, 0x24ac, 0x2368, 0x0003, /* ftis, ftsize, ftmtime, ftatime, ftctime, ftrowned, fteowned, ftzero, ftsock, ftchr, ftblk, ftfile, ftdir, ftpipe, ftsuid, ftsgid, ftsvtx, ftlink, fttty, fttext, ftbinary */
+    0x54f1, /* wait, getppid, time */
+    0x1c78, 0x4954, 0x0fb0, 0x082c, 0x5688, 0x27c4, 0x0003, /* entereval */
+    0x3e7c, 0x0018, 0x14c4, 0x13e1, /* coreargs */
+    0x3dac, 0x00c7, /* avhvswitch */
+    0x3cbc, 0x01fb, /* padrange */
+    0x3cbc, 0x5098, 0x04f6, 0x35ec, 0x1ac8, 0x0067, /* refassign */
+    0x3cbc, 0x5098, 0x04f6, 0x35ec, 0x1ac8, 0x0003, /* lvref */
+    0x3cbd, /* lvrefslice */
     0x1f7c, 0x0003, /* pushdefer */
     0x131c, 0x0003, /* helemexistsor */
-    0x2f1c, 0x0003, /* methstart */
-    0x3208, 0x3064, 0x0003, /* initfield */
+    0x2fdc, 0x0003, /* methstart */
+    0x32c8, 0x3124, 0x0003, /* initfield */
 
 };
 
@@ -3258,7 +3260,7 @@ EXTCONST U8 PL_op_private_valid[] = {
     /* MULTIDEREF */ (OPpARG1_MASK|OPpHINT_STRICT_REFS|OPpMAYBE_LVSUB|OPpMULTIDEREF_EXISTS|OPpMULTIDEREF_DELETE|OPpLVAL_DEFER|OPpLVAL_INTRO),
     /* UNPACK     */ (OPpARG4_MASK),
     /* PACK       */ (OPpARG4_MASK),
-    /* SPLIT      */ (OPpSPLIT_IMPLIM|OPpSPLIT_LEX|OPpSPLIT_ASSIGN|OPpOUR_INTRO|OPpLVAL_INTRO),
+    /* SPLIT      */ (OPpSPLIT_FIXED|OPpSPLIT_IMPLIM|OPpSPLIT_LEX|OPpSPLIT_ASSIGN|OPpOUR_INTRO|OPpLVAL_INTRO),
     /* JOIN       */ (OPpARG4_MASK),
     /* LIST       */ (OPpLIST_GUESSED|OPpLVAL_INTRO),
     /* LSLICE     */ (OPpARG2_MASK),
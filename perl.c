@@ -703,6 +703,9 @@ perl_destruct(pTHXx)
 #endif
     my_fflush_all();
 
+    /* write out the results of PERL_OP_PROFILE */
+    op_profile_stop();
+
 #ifdef PERL_TRACE_OPS
     /* dump OP-counts if $ENV{PERL_TRACE_OPS} > 0 */
     {
@@ -981,6 +984,11 @@ perl_destruct(pTHXx)
     }
 #endif
 
+    if (PL_re_cache) {
+        re_cache_resize(0);
+        Safefree(PL_re_cache);
+        PL_re_cache = NULL;
+    }
 
     SvREFCNT_dec(MUTABLE_SV(PL_stashcache));
     PL_stashcache = NULL;
@@ -2040,6 +2048,9 @@ S_Internals_V(pTHX_ CV *cv)
 #  ifdef PERL_RELOCATABLE_INCPUSH
                              " PERL_RELOCATABLE_INCPUSH"
 #  endif
+#  ifdef PERL_RUNOPS_COMPUTED_GOTO
+                             " PERL_RUNOPS_COMPUTED_GOTO"
+#  endif
 #  ifdef PERL_USE_DEVEL
                              " PERL_USE_DEVEL"
 #  endif
@@ -2653,6 +2664,13 @@ S_parse_body(pTHX_ char **env, XSINIT_t xsinit)
          else
               Perl_croak(aTHX_ "PERL_SIGNALS illegal: \"%s\"", s);
     }
+    if (!TAINTING_get && (s = PerlEnv_getenv("PERL_OP_PROFILE")) && *s) {
+        const char *interval = PerlEnv_getenv("PERL_OP_PROFILE_INTERVAL");
+        UV uv = 0;
+        if (interval && !grok_atoUV(interval, &uv, NULL))
+            uv = 0;
+        op_profile_start(s, uv);
+    }
     }
 
 
@@ -4541,6 +4541,17 @@ typedef        struct crypt_data {     /* straight from /usr/include/crypt.h */
 #include "warnings.h"
 #include "utf8.h"
 
+/* SSE2 is part of the baseline x86-64 instruction set, so it can be used
+ * without checking the CPU at run time.  The kernels using it all rely on
+ * the ASCII bit patterns of UTF-8.  Build with -DPERL_NO_SSE2 to use the
+ * portable code instead. */
+#if ! defined(PERL_NO_SSE2) && ! defined(EBCDIC)                            \
+ && (   defined(__SSE2__) || defined(_M_X64)                                \
+     || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define PERL_USE_SSE2
+#  include <emmintrin.h>
+#endif
+
 /* these would be in doio.h if there was such a file */
 #define my_stat()  my_stat_flags(SV_GMAGIC)
 #define my_lstat() my_lstat_flags(SV_GMAGIC)
@@ -4568,6 +4579,7 @@ typedef struct regnode_charclass_posixl regnode_charclass_class;
 typedef struct regnode_charclass_posixl regnode_charclass_posixl;
 
 typedef struct regnode_ssc regnode_ssc;
+typedef struct reg_stclass_ranges reg_stclass_ranges;
 typedef struct RExC_state_t RExC_state_t;
 struct _reg_trie_data;
 typedef struct scan_data_t scan_data_t;
@@ -5744,6 +5756,12 @@ EXTCONST char PL_bincompat_options[] =
 #  else
                              " PERL_HASH_NO_SBOX32"
 #  endif
+#  ifdef PERL_HE_CACHE_HASH
+                             " PERL_HE_CACHE_HASH"
+#  endif
+#  ifdef PERL_HV_INCREMENTAL_SPLIT
+                             " PERL_HV_INCREMENTAL_SPLIT"
+#  endif
 #  ifdef PERL_IMPLICIT_SYS
                              " PERL_IMPLICIT_SYS"
 #  endif
@@ -6147,6 +6165,8 @@ EXTCONST U16 PL_interp_size_5_18_0
 #endif /* MULTIPLICITY */
 
 struct tempsym; /* defined in pp_pack.c */
+struct psort_job; /* defined in pp_sort.c */
+struct psplit_job; /* defined in pp.c */
 
 #include "thread.h"
 #include "pp.h"
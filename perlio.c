@@ -1499,6 +1499,7 @@ PerlIO_default_layers(pTHX)
         PerlIO_define_layer(aTHX_ PERLIO_FUNCS_CAST(&PerlIO_utf8));
         PerlIO_define_layer(aTHX_ PERLIO_FUNCS_CAST(&PerlIO_remove));
         PerlIO_define_layer(aTHX_ PERLIO_FUNCS_CAST(&PerlIO_byte));
+        PerlIO_define_layer(aTHX_ PERLIO_FUNCS_CAST(&PerlIO_bufsize));
         PerlIO_define_layer(aTHX_ PERLIO_FUNCS_CAST(&PerlIO_scalar));
         PerlIO_list_push(aTHX_ PL_def_layerlist, (PerlIO_funcs *)osLayer,
                          &PL_sv_undef);
@@ -4419,6 +4420,16 @@ PerlIOBuf_fill(pTHX_ PerlIO *f)
     PerlIOBuf * const b = PerlIOSelf(f, PerlIOBuf);
     PerlIO *n = PerlIONext(f);
     SSize_t avail;
+    /*
+     * Under :bufsize(auto) a buffer which the last fill filled completely
+     * and which has since been drained means we are reading sequentially:
+     * double it (up to the limit) so that each fill does more of the work.
+     */
+    const bool grow = b->bufmax > b->bufsiz
+                   && b->buf && b->buf != (STDCHAR *) & b->oneword
+                   && (PerlIOBase(f)->flags & PERLIO_F_RDBUF)
+                   && b->ptr == b->end
+                   && (Size_t)(b->end - b->buf) == b->bufsiz;
     /*
      * Down-stream flush is defined not to loose read data so is harmless.
      * we would not normally be fill'ing if there was data left in anycase.
@@ -4428,6 +4439,16 @@ PerlIOBuf_fill(pTHX_ PerlIO *f)
     if (PerlIOBase(f)->flags & PERLIO_F_TTY)
         PerlIOBase_flush_linebuf(aTHX);
 
+    if (grow) {
+        /* The buffer is empty after the flush, so nothing to copy */
+        Size_t size = b->bufsiz * 2;
+        if (size > b->bufmax || size < b->bufsiz)
+            size = b->bufmax;
+        Safefree(b->buf);
+        b->buf = NULL;
+        b->bufsiz = size;
+    }
+
     if (!b->buf)
         PerlIO_get_base(f);     /* allocate via vtable */
 
@@ -4739,7 +4760,18 @@ PerlIOBuf_set_ptrcnt(pTHX_ PerlIO *f, STDCHAR * ptr, SSize_t cnt)
 PerlIO *
 PerlIOBuf_dup(pTHX_ PerlIO *f, PerlIO *o, CLONE_PARAMS *param, int flags)
 {
- return PerlIOBase_dup(aTHX_ f, o, param, flags);
+    f = PerlIOBase_dup(aTHX_ f, o, param, flags);
+    if (f) {
+        /* Carry over any size set with :bufsize; the new layer has not
+           allocated its buffer yet */
+        PerlIOBuf * const fb = PerlIOSelf(f, PerlIOBuf);
+        const PerlIOBuf * const ob = PerlIOSelf(o, PerlIOBuf);
+        if (!fb->buf) {
+            fb->bufsiz = ob->bufsiz;
+            fb->bufmax = ob->bufmax;
+        }
+    }
+    return f;
 }
 
 
@@ -4775,6 +4807,128 @@ PERLIO_FUNCS_DECL(PerlIO_perlio) = {
     PerlIOBuf_set_ptrcnt,
 };
 
+/*--------------------------------------------------------------------------------------*/
+/*
+ * :bufsize(N) and :bufsize(auto[,MAX]) dummy layer, which sets the buffer
+ * size of the nearest perlio-style buffer below it
+ */
+
+/* Smallest size accepted, crlf needs room to hold back a CR */
+#define PERLIOBUF_MIN_BUFSIZ 16
+
+STATIC bool
+S_bufsize_arg(pTHX_ SV *arg, Size_t *sizep, Size_t *maxp)
+{
+    STRLEN len;
+    const char *s;
+    const char *e;
+    UV uv;
+
+    if (!arg || !SvOK(arg))
+        return FALSE;
+    s = SvPV_const(arg, len);
+    e = s + len;
+    if (memBEGINs(s, len, "auto")) {
+        s += STRLENs("auto");
+        *sizep = 0;
+        *maxp = PERLIOBUF_MAX_BUFSIZ;
+        if (s == e)
+            return TRUE;
+        if (*s++ != ',')
+            return FALSE;
+        sizep = maxp;
+    }
+    else
+        *maxp = 0;
+    {
+        const char *end = e;
+        if (s == e || !grok_atoUV(s, &uv, &end) || end != e
+            || uv < PERLIOBUF_MIN_BUFSIZ || uv > (UV)(MEM_SIZE_MAX / 2))
+            return FALSE;
+    }
+    *sizep = (Size_t)uv;
+    return TRUE;
+}
+
+IV
+PerlIOBufsize_pushed(pTHX_ PerlIO *f, const char *mode, SV *arg, PerlIO_funcs *tab)
+{
+    Size_t size;
+    Size_t max;
+    PERL_UNUSED_ARG(mode);
+    PERL_UNUSED_ARG(tab);
+
+    if (!S_bufsize_arg(aTHX_ arg, &size, &max)) {
+        Perl_ck_warner(aTHX_ packWARN(WARN_LAYER),
+                       "Invalid argument \"%" SVf "\" for PerlIO layer \":bufsize\"",
+                       SVfARG(arg && SvOK(arg) ? arg : &PL_sv_no));
+        SETERRNO(EINVAL, LIB_INVARG);
+        return -1;
+    }
+    if (PerlIOValid(f))
+        PerlIO_flush(f);
+    /* Skip layers such as :encoding which manage a buffer of their own */
+    while (PerlIOValid(f) && PerlIOBase(f)->tab->Get_base != PerlIOBuf_get_base)
+        f = PerlIONext(f);
+    if (PerlIOValid(f)) {
+        PerlIOBuf * const b = PerlIOSelf(f, PerlIOBuf);
+        if (!size)
+            size = b->bufsiz ? b->bufsiz : PERLIOBUF_DEFAULT_BUFSIZ;
+        if (b->buf && b->buf != (STDCHAR *) & b->oneword) {
+            /* A read buffer we could not seek back over keeps its data */
+            const Size_t used = (b->end > b->ptr ? b->end : b->ptr) - b->buf;
+            if (used) {
+                const Size_t ptroff = b->ptr - b->buf;
+                if (size < used)
+                    size = used;
+                Renew(b->buf, size, STDCHAR);
+                b->ptr = b->buf + ptroff;
+                b->end = b->buf + used;
+            }
+            else {
+                Safefree(b->buf);
+                b->buf = b->ptr = b->end = NULL;
+            }
+        }
+        b->bufsiz = size;
+        b->bufmax = max > size ? max : 0;
+        return 0;
+    }
+    SETERRNO(EINVAL, LIB_INVARG);
+    return -1;
+}
+
+PERLIO_FUNCS_DECL(PerlIO_bufsize) = {
+    sizeof(PerlIO_funcs),
+    "bufsize",
+    0,
+    PERLIO_K_DUMMY,
+    PerlIOBufsize_pushed,
+    NULL,
+    PerlIOBase_open,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,                       /* flush */
+    NULL,                       /* fill */
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,                       /* get_base */
+    NULL,                       /* get_bufsiz */
+    NULL,                       /* get_ptr */
+    NULL,                       /* get_cnt */
+    NULL,                       /* set_ptrcnt */
+};
+
 /*--------------------------------------------------------------------------------------*/
 /*
  * Temp layer to hold unread chars when cannot do it any other way
@@ -5067,6 +5221,7 @@ PerlIOCrlf_get_cnt(pTHX_ PerlIO *f)
                     }
                     else {
                         int code;
+                        const Size_t bufmax = b->bufmax;
                         b->ptr++;       /* say we have read it as far as
                                          * flush() is concerned */
                         b->buf++;       /* Leave space in front of buffer */
@@ -5074,9 +5229,11 @@ PerlIOCrlf_get_cnt(pTHX_ PerlIO *f)
                            posn += ptr-buf
                            will naturally make posn point at CR
                          */
+                        b->bufmax = 0;  /* buf is offset, so no growing */
                         b->bufsiz--;    /* Buffer is thus smaller */
                         code = PerlIO_fill(f);  /* Fetch some more */
                         b->bufsiz++;    /* Restore size for next time */
+                        b->bufmax = bufmax;
                         b->buf--;       /* Point at space */
                         b->ptr = nl = b->buf;   /* Which is what we hand
                                                  * off */
@@ -153,6 +153,11 @@ PERL_CALLCONV void PerlIO_clone(pTHX_ PerlInterpreter *proto,
 #define PERLIOBUF_DEFAULT_BUFSIZ (BUFSIZ > 8192 ? BUFSIZ : 8192)
 #endif
 
+/* The limit a buffer grows to under :bufsize(auto) */
+#ifndef PERLIOBUF_MAX_BUFSIZ
+#define PERLIOBUF_MAX_BUFSIZ (1024 * 1024)
+#endif
+
 #ifndef SEEK_SET
 #define SEEK_SET 0
 #endif
@@ -112,6 +112,7 @@ EXTCONST PerlIO_funcs PerlIO_stdio;
 EXTCONST PerlIO_funcs PerlIO_crlf;
 EXTCONST PerlIO_funcs PerlIO_utf8;
 EXTCONST PerlIO_funcs PerlIO_byte;
+EXTCONST PerlIO_funcs PerlIO_bufsize;
 EXTCONST PerlIO_funcs PerlIO_raw;
 EXTCONST PerlIO_funcs PerlIO_pending;
 PERL_CALLCONV PerlIO *PerlIO_allocate(pTHX);
@@ -137,6 +138,7 @@ typedef struct {
     STDCHAR *ptr;		/* Current position in buffer */
     Off_t posn;			/* Offset of buf into the file */
     Size_t bufsiz;		/* Real size of buffer */
+    Size_t bufmax;		/* Limit for adaptive growth, 0 if fixed */
     IV oneword;			/* Emergency buffer */
 } PerlIOBuf;
 
@@ -206,6 +208,9 @@ PERL_CALLCONV Off_t     PerlIOBuf_tell(pTHX_ PerlIO *f);
 PERL_CALLCONV SSize_t   PerlIOBuf_unread(pTHX_ PerlIO *f, const void *vbuf, Size_t count);
 PERL_CALLCONV SSize_t   PerlIOBuf_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count);
 
+/* Bufsize */
+PERL_CALLCONV IV        PerlIOBufsize_pushed(pTHX_ PerlIO *f, const char *mode, SV *arg, PerlIO_funcs *tab);
+
 /* Crlf */
 PERL_CALLCONV IV        PerlIOCrlf_binmode(pTHX_ PerlIO *f);
 PERL_CALLCONV IV        PerlIOCrlf_flush(pTHX_ PerlIO *f);
@@ -337,6 +337,9 @@ PERLVARI(G, infix_plugin, Perl_infix_plugin_t, Perl_infix_plugin_standard)
 PERLVARI(G, op_sequence, HV *, NULL)	/* dump.c */
 PERLVARI(G, op_seq,	UV,	0)	/* dump.c */
 
+/* set by the SIGPROF handler of the op profiler */
+PERLVARI(G, op_profile_tick, volatile sig_atomic_t, 0)	/* run.c */
+
 #ifdef USE_ITHREADS
 PERLVAR(G, dollarzero_mutex, perl_mutex) /* Modifying $0 */
 #endif
@@ -862,7 +862,7 @@ S_do_chomp(pTHX_ SV *retval, SV *sv, bool chomping)
             nope_free_nothing: ;
         }
     } else {
-        if (len && (!SvPOK(sv) || SvIsCOW(sv)))
+        if (len && (!SvPOK(sv) || SvIsCOW(sv) || SvVIEW_mg(sv)))
             s = SvPV_force_nomg(sv, len);
         if (DO_UTF8(sv)) {
             if (s && len) {
@@ -3708,7 +3708,12 @@ PP_wrapped(pp_substr,
         if (rvalue) {
             SvTAINTED_off(TARG);			/* decontaminate */
             SvUTF8_off(TARG);			/* decontaminate */
-            sv_setpvn(TARG, tmps, byte_len);
+            /* the rest of a long string can share its buffer */
+            if (!repl && SvPOK(sv) && tmps - byte_pos == SvPVX_const(sv)
+                && byte_pos + byte_len == SvCUR(sv))
+                sv_setpv_view(TARG, sv, byte_pos);
+            else
+                sv_setpvn(TARG, tmps, byte_len);
 #ifdef USE_LOCALE_COLLATE
             sv_unmagic(TARG, PERL_MAGIC_collxfrm);
 #endif
@@ -6587,6 +6592,231 @@ PP_wrapped(pp_reverse, 0, 1)
     RETURN;
 }
 
+/* Guess how many more fields splitting [s, strend) on the fixed string
+ * sep will give, from how often sep occurs in its first
+ * PERL_SPLIT_SAMPLE bytes.  It's used to size the array "@a = split"
+ * creates the fields in, so it never asks for more pointers than fit in
+ * the bytes left, which keeps a bad guess from costing more memory than
+ * the string itself does. */
+
+#ifndef PERL_SPLIT_SAMPLE
+#  define PERL_SPLIT_SAMPLE 4096
+#endif
+
+STATIC SSize_t
+S_split_estimate(const char *s, const char *strend, const char *sep,
+                 STRLEN seplen)
+{
+    const STRLEN left = strend - s;
+    const char * const end = left > PERL_SPLIT_SAMPLE
+                           ? s + PERL_SPLIT_SAMPLE : strend;
+    const char *p = s;
+    SSize_t found = 0;
+    NV guess;
+
+    PERL_ARGS_ASSERT_SPLIT_ESTIMATE;
+
+    while (p < end && (p = seplen == 1
+                           ? (const char *)memchr(p, *sep, end - p)
+                           : ninstr(p, end, sep, sep + seplen)))
+    {
+        found++;
+        p += seplen;
+    }
+
+    if (end == strend)
+        return found + 1;
+    guess = (NV)found * (NV)left / (NV)PERL_SPLIT_SAMPLE;
+    if (guess > (NV)(left / sizeof(SV *)))
+        return (SSize_t)(left / sizeof(SV *)) + 1;
+    return (SSize_t)guess + 1;
+}
+
+#if defined(USE_ITHREADS) && defined(I_PTHREAD)
+
+/* Parallel split, enabled by "use re 'split_parallel'".
+ *
+ * When the separator is a fixed string which can't overlap itself, the
+ * places it occurs don't depend on where the search for it starts, so
+ * the string can be cut into one chunk per thread, and each thread can
+ * list the separators starting in its own chunk (reading past its end to
+ * see one that straddles it).  The field SVs are then made from those
+ * lists by the interpreter's thread, exactly as the serial loop would.
+ *
+ * The worker threads have no interpreter of their own: they only read the
+ * string and fill in their list of separators, as offsets into their
+ * chunk, which they grow with the shared allocator.
+ */
+
+#ifndef PERL_SPLIT_MAX_THREADS
+#  define PERL_SPLIT_MAX_THREADS 8
+#endif
+
+typedef struct psplit_job {
+    PerlInterpreter *interp;    /* only for the shared allocator */
+    const char *from;           /* find separators starting here */
+    const char *to;             /* ... up to here */
+    const char *strend;
+    const char *sep;
+    STRLEN seplen;
+    U32 *found;                 /* where each one starts, from 'from' */
+    size_t nfound;
+    size_t maxfound;
+    bool failed;                /* ran out of memory */
+} psplit_job;
+
+STATIC void *
+S_psplit_worker(void *arg)
+{
+    psplit_job * const job = (psplit_job *)arg;
+    const char *s = job->from;
+    const char * const bigend = job->to + job->seplen - 1 < job->strend
+                              ? job->to + job->seplen - 1
+                              : job->strend;
+    dTHXa(job->interp);
+
+    PERL_ARGS_ASSERT_PSPLIT_WORKER;
+    PERL_UNUSED_CONTEXT;
+
+    while (s < job->to) {
+        const char * const m = job->seplen == 1
+                             ? (const char *)memchr(s, *job->sep, job->to - s)
+                             : ninstr(s, bigend, job->sep,
+                                      job->sep + job->seplen);
+        if (!m)
+            break;
+        if (job->nfound == job->maxfound) {
+            const size_t max = job->maxfound ? job->maxfound * 2 : 1024;
+            U32 * const found = (U32 *)
+                PerlMemShared_realloc(job->found, max * sizeof(U32));
+
+            if (!found) {
+                job->failed = TRUE;
+                break;
+            }
+            job->found = found;
+            job->maxfound = max;
+        }
+        job->found[job->nfound++] = (U32)(m - job->from);
+        s = m + job->seplen;
+    }
+
+    return NULL;
+}
+
+/* Run the jobs, all but the first in new threads, and wait for them
+ * all to finish, with signals blocked in the new threads, as
+ * psort_run_jobs() in pp_sort.c does. */
+
+STATIC void
+S_psplit_run_jobs(psplit_job *jobs, unsigned njobs)
+{
+    pthread_t tids[PERL_SPLIT_MAX_THREADS];
+    bool started[PERL_SPLIT_MAX_THREADS];
+    sigset_t newmask, oldmask;
+    unsigned i;
+
+    PERL_ARGS_ASSERT_PSPLIT_RUN_JOBS;
+
+    sigfillset(&newmask);
+#ifdef SIGILL
+    sigdelset(&newmask, SIGILL);
+#endif
+#ifdef SIGBUS
+    sigdelset(&newmask, SIGBUS);
+#endif
+#ifdef SIGSEGV
+    sigdelset(&newmask, SIGSEGV);
+#endif
+    pthread_sigmask(SIG_BLOCK, &newmask, &oldmask);
+    for (i = 1; i < njobs; i++)
+        started[i] = pthread_create(&tids[i], NULL, S_psplit_worker,
+                                    &jobs[i]) == 0;
+    pthread_sigmask(SIG_SETMASK, &oldmask, NULL);
+
+    (void)S_psplit_worker(&jobs[0]);
+
+    for (i = 1; i < njobs; i++) {
+        if (started[i])
+            pthread_join(tids[i], NULL);
+        else
+            (void)S_psplit_worker(&jobs[i]);
+    }
+}
+
+/* If "use re 'split_parallel'" is in effect and [s, strend) is long
+ * enough, find the separators sep in it using several threads, and
+ * return how many of the jobs hold them; otherwise, or if a worker ran
+ * out of memory, return 0. */
+
+STATIC unsigned
+S_split_parallel(pTHX_ const char *s, const char *strend, SV *sep,
+                       psplit_job *jobs)
+{
+    STRLEN seplen;
+    const char * const sepstr = SvPV_const(sep, seplen);
+    SV *hint;
+    IV nthreads = 0;
+    STRLEN i;
+    unsigned j;
+
+    PERL_ARGS_ASSERT_SPLIT_PARALLEL;
+
+    if (!(CopHINTS_get(PL_curcop) & HINT_LOCALIZE_HH))
+        return 0;
+    hint = cop_hints_fetch_pvs(PL_curcop, "re_split_parallel", 0);
+    if (!SvOK(hint) || (UV)(strend - s) < SvUV(hint))
+        return 0;
+
+    hint = cop_hints_fetch_pvs(PL_curcop, "re_split_threads", 0);
+    if (SvOK(hint))
+        nthreads = SvIV(hint);
+#ifdef _SC_NPROCESSORS_ONLN
+    else
+        nthreads = (IV)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (nthreads > PERL_SPLIT_MAX_THREADS)
+        nthreads = PERL_SPLIT_MAX_THREADS;
+    if (nthreads < 2 || !seplen
+        || (UV)(strend - s) / (UV)nthreads >= (UV)U32_MAX / 2)
+    {
+        return 0;
+    }
+
+    /* a separator that could overlap itself, like "aa" in "aaa", would be
+     * found in different places depending on where the search started */
+    for (i = 1; i < seplen; i++)
+        if (memEQ(sepstr, sepstr + i, seplen - i))
+            return 0;
+
+    for (j = 0; j < (unsigned)nthreads; j++) {
+        jobs[j].interp   = my_perl;
+        jobs[j].from     = s + (strend - s) / nthreads * j;
+        jobs[j].to       = j + 1 < (unsigned)nthreads
+                         ? s + (strend - s) / nthreads * (j + 1)
+                         : strend;
+        jobs[j].strend   = strend;
+        jobs[j].sep      = sepstr;
+        jobs[j].seplen   = seplen;
+        jobs[j].found    = NULL;
+        jobs[j].nfound   = 0;
+        jobs[j].maxfound = 0;
+        jobs[j].failed   = FALSE;
+    }
+    psplit_run_jobs(jobs, (unsigned)nthreads);
+
+    for (j = 0; j < (unsigned)nthreads; j++) {
+        if (jobs[j].failed) {
+            for (j = 0; j < (unsigned)nthreads; j++)
+                PerlMemShared_free(jobs[j].found);
+            return 0;
+        }
+    }
+    return (unsigned)nthreads;
+}
+
+#endif /* USE_ITHREADS && I_PTHREAD */
+
 PP_wrapped(pp_split,
               (   (PL_op->op_private & OPpSPLIT_ASSIGN)
                && (PL_op->op_flags & OPf_STACKED))
@@ -6609,10 +6839,10 @@ PP_wrapped(pp_split,
     SV *dstr;
     const char *m;
     SSize_t iters = 0;
-    const STRLEN slen = do_utf8
-                        ? utf8_length((U8*)s, (U8*)strend)
-                        : (STRLEN)(strend - s);
-    SSize_t maxiters = slen + 10;
+    STRLEN slen;
+    SSize_t maxiters;
+    bool fixed;
+    bool direct = FALSE;     /* the fields are going straight into ary */
     I32 trailing_empty = 0;
     const char *orig;
     const IV origlimit = limit;
@@ -6627,6 +6857,15 @@ PP_wrapped(pp_split,
 
     rx = PM_GETRE(pm);
 
+    /* ck_split() found the pattern to be a fixed string, so there can't
+     * be more fields than bytes, and no need to count the characters */
+    fixed = (PL_op->op_private & OPpSPLIT_FIXED)
+         && do_utf8 == (RX_UTF8(rx) != 0);
+    slen = do_utf8 && !fixed
+           ? utf8_length((U8*)s, (U8*)strend)
+           : (STRLEN)(strend - s);
+    maxiters = slen + 10;
+
     TAINT_IF(get_regex_charset(RX_EXTFLAGS(rx)) == REGEX_LOCALE_CHARSET &&
              (RX_EXTFLAGS(rx) & (RXf_WHITE | RXf_SKIPWHITE)));
 
@@ -6827,64 +7066,96 @@ PP_wrapped(pp_split,
             }
         }
     }
-    else if (do_utf8 == (RX_UTF8(rx) != 0) &&
-             (RX_EXTFLAGS(rx) & RXf_USE_INTUIT) && !RX_NPARENS(rx)
-             && (RX_EXTFLAGS(rx) & RXf_CHECK_ALL)
-             && !(RX_EXTFLAGS(rx) & RXf_IS_ANCHORED)) {
+    else if (fixed
+             || (do_utf8 == (RX_UTF8(rx) != 0) &&
+                 (RX_EXTFLAGS(rx) & RXf_USE_INTUIT) && !RX_NPARENS(rx)
+                 && (RX_EXTFLAGS(rx) & RXf_CHECK_ALL)
+                 && !(RX_EXTFLAGS(rx) & RXf_IS_ANCHORED))) {
         const int tail = (RX_EXTFLAGS(rx) & RXf_INTUIT_TAIL);
         SV * const csv = CALLREG_INTUIT_STRING(rx);
+        STRLEN seplen;
+        const char * const sep = SvPV_const(csv, seplen);
+        const bool multiline = (RX_EXTFLAGS(rx) & RXf_PMf_MULTILINE) ? 1 : 0;
+
+#if defined(USE_ITHREADS) && defined(I_PTHREAD)
+        psplit_job jobs[PERL_SPLIT_MAX_THREADS];
+        const unsigned njobs = !tail && origlimit <= 0 && !SvGMAGICAL(sv)
+                             ? split_parallel(s, strend, csv, jobs)
+                             : 0;
+        unsigned j = 0;
+        size_t i = 0;
+#endif
 
         len = RX_MINLENRET(rx);
-        if (len == 1 && !RX_UTF8(rx) && !tail) {
-            const char c = *SvPV_nolen_const(csv);
-            while (--limit) {
-                for (m = s; m < strend && *m != c; m++)
-                    ;
-                if (m >= strend)
-                    break;
-                if (gimme_scalar) {
-                    iters++;
-                    if (m-s == 0)
-                        trailing_empty++;
-                    else
-                        trailing_empty = 0;
-                } else {
-                    dstr = newSVpvn_flags(s, m-s, flags);
-                    XPUSHs(dstr);
-                }
-                /* The rx->minlen is in characters but we want to step
-                 * s ahead by bytes. */
-                if (do_utf8)
-                    s = (char*)utf8_hop_forward((U8*) m, len, (U8*) strend);
-                else
-                    s = m + len; /* Fake \n at the end */
-            }
+
+        /* With no elements to free first, and nothing tied, the fields can
+         * be created straight into the array rather than on the stack,
+         * after making room for as many as there look to be. */
+        direct = ary && !mg && AvREAL(ary) && AvFILLp(ary) < 0 && seplen;
+        if (direct && (STRLEN)AvMAX(ary) < (STRLEN)(strend - s) / seplen) {
+            SSize_t guess = split_estimate(s, strend, sep, seplen);
+            if (origlimit > 0 && guess > origlimit)
+                guess = origlimit;
+            if (guess > AvMAX(ary) + 1)
+                av_extend(ary, guess - 1);
         }
-        else {
-            const bool multiline = (RX_EXTFLAGS(rx) & RXf_PMf_MULTILINE) ? 1 : 0;
 
-            while (s < strend && --limit &&
-              (m = fbm_instr((unsigned char*)s, (unsigned char*)strend,
-                             csv, multiline ? FBMrf_MULTILINE : 0)) )
-            {
-                if (gimme_scalar) {
-                    iters++;
-                    if (m-s == 0)
-                        trailing_empty++;
-                    else
-                        trailing_empty = 0;
-                } else {
-                    dstr = newSVpvn_flags(s, m-s, flags);
-                    XPUSHs(dstr);
+        while (--limit) {
+#if defined(USE_ITHREADS) && defined(I_PTHREAD)
+            if (njobs) {
+                while (j < njobs && i == jobs[j].nfound) {
+                    PerlMemShared_free(jobs[j].found);
+                    j++;
+                    i = 0;
                 }
-                /* The rx->minlen is in characters but we want to step
-                 * s ahead by bytes. */
-                if (do_utf8)
-                    s = (char*)utf8_hop_forward((U8*)m, len, (U8 *) strend);
+                if (j == njobs)
+                    break;
+                m = jobs[j].from + jobs[j].found[i++];
+            }
+            else
+#endif
+            if (tail) {
+                if (s >= strend)
+                    break;
+                m = fbm_instr((unsigned char*)s, (unsigned char*)strend,
+                              csv, multiline ? FBMrf_MULTILINE : 0);
+            }
+            else if (seplen == 1)
+                m = (const char *)memchr(s, *sep, strend - s);
+            else
+                m = ninstr(s, strend, sep, sep + seplen);
+            if (!m)
+                break;
+
+            if (gimme_scalar) {
+                iters++;
+                if (m-s == 0)
+                    trailing_empty++;
                 else
-                    s = m + len; /* Fake \n at the end */
+                    trailing_empty = 0;
+            } else if (direct) {
+                if (AvFILLp(ary) == AvMAX(ary))
+                    av_extend(ary, AvMAX(ary)
+                                   + split_estimate(m, strend, sep, seplen));
+                AvARRAY(ary)[++AvFILLp(ary)] = newSVpvn_flags(s, m-s, flags);
+            } else {
+                dstr = newSVpvn_flags(s, m-s, flags);
+                XPUSHs(dstr);
             }
+            if (!tail)
+                s = m + seplen;
+            /* The rx->minlen is in characters but we want to step
+             * s ahead by bytes. */
+            else if (do_utf8)
+                s = (char*)utf8_hop_forward((U8*)m, len, (U8 *) strend);
+            else
+                s = m + len; /* Fake \n at the end */
         }
+
+#if defined(USE_ITHREADS) && defined(I_PTHREAD)
+        for (; j < njobs; j++)
+            PerlMemShared_free(jobs[j].found);
+#endif
     }
     else {
         maxiters += slen * RX_NPARENS(rx);
@@ -6943,7 +7214,9 @@ PP_wrapped(pp_split,
         }
     }
 
-    if (!gimme_scalar) {
+    if (direct)
+        iters = AvFILLp(ary) + 1;
+    else if (!gimme_scalar) {
         iters = (SP - PL_stack_base) - base;
     }
     if (iters > maxiters)
@@ -6951,16 +7224,38 @@ PP_wrapped(pp_split,
 
     /* keep field after final delim? */
     if (s < strend || (iters && origlimit)) {
-        if (!gimme_scalar) {
-            const STRLEN l = strend - s;
-            dstr = newSVpvn_flags(s, l, flags);
-            XPUSHs(dstr);
+        if (direct || !gimme_scalar) {
+            /* it's the end of the string, so a long one can share its
+             * buffer */
+            if (SvPOK(sv) && strend == SvEND(sv) && s >= SvPVX_const(sv)) {
+                dstr = newSV_type(SVt_PV);
+                sv_setpv_view(dstr, sv, s - SvPVX_const(sv));
+                if (do_utf8)
+                    SvUTF8_on(dstr);
+                if (flags & SVs_TEMP)
+                    sv_2mortal(dstr);
+            }
+            else
+                dstr = newSVpvn_flags(s, strend - s, flags);
         }
+        if (direct) {
+            if (AvFILLp(ary) == AvMAX(ary))
+                av_extend(ary, AvMAX(ary) + 1);
+            AvARRAY(ary)[++AvFILLp(ary)] = dstr;
+        }
+        else if (!gimme_scalar)
+            XPUSHs(dstr);
         iters++;
     }
     else if (!origlimit) {
         if (gimme_scalar) {
             iters -= trailing_empty;
+        } else if (direct) {
+            while (iters > 0 && SvCUR(AvARRAY(ary)[iters - 1]) == 0) {
+                SvREFCNT_dec_NN(AvARRAY(ary)[--iters]);
+                AvARRAY(ary)[iters] = NULL;
+            }
+            AvFILLp(ary) = iters - 1;
         } else {
             while (iters > 0 && (!TOPs || !SvANY(TOPs) || SvCUR(TOPs) == 0)) {
                 if (TOPs && !(flags & SVs_TEMP))
@@ -6974,7 +7269,20 @@ PP_wrapped(pp_split,
     PUTBACK;
     LEAVE_SCOPE(oldsave);
     SPAGAIN;
-    if (realarray) {
+    if (direct) {
+        if (SvSMAGICAL(ary)) {
+            PUTBACK;
+            mg_set(MUTABLE_SV(ary));
+            SPAGAIN;
+        }
+        if (gimme == G_LIST) {
+            EXTEND(SP, iters);
+            Copy(AvARRAY(ary), SP + 1, iters, SV*);
+            SP += iters;
+            RETURN;
+        }
+    }
+    else if (realarray) {
         if (!mg) {
             PUTBACK;
             if(AvREAL(ary)) {
@@ -129,8 +129,12 @@ PP(pp_regcomp)
         ReANY(new_re)->qr_anoncv
                         = (CV*) SvREFCNT_inc(PAD_SV(PL_op->op_targ));
 
-    if (is_bare_re) {
-        REGEXP *tmp;
+    /* pp_match() doesn't call the get-magic of its LHS when matching against
+       a copy of a regexp (which has a mother_re), relying on it being called
+       here.  Such copies are made of bare regexps, and of compilations found
+       in the interpreter's cache, which re_op_compile() also returns as bare
+       regexps; and the op may already hold one from an earlier iteration. */
+    if (is_bare_re || ReANY(new_re)->mother_re) {
         /* The match's LHS's get-magic might need to access this op's regexp
            (e.g. $' =~ /$re/ while foo; see bug 70764).  So we must call
            get-magic now before we replace the regexp. Hopefully this hack can
@@ -154,7 +158,10 @@ PP(pp_regcomp)
             PERL_UNUSED_VAR(was_tainted);
 #endif
         }
-        tmp = reg_temp_copy(NULL, new_re);
+    }
+
+    if (is_bare_re) {
+        REGEXP *tmp = reg_temp_copy(NULL, new_re);
         ReREFCNT_dec(new_re);
         new_re = tmp;
     }
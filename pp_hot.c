@@ -5280,7 +5280,8 @@ PP(pp_subst)
     /* note we don't (yet) force the var into being a string; if we fail
      * to match, we leave as-is; on successful match however, we *will*
      * coerce into a string, then repeat the match */
-    if (!SvPOKp(TARG) || SvTYPE(TARG) == SVt_PVGV || SvVOK(TARG))
+    if (!SvPOKp(TARG) || SvTYPE(TARG) == SVt_PVGV || SvVOK(TARG)
+        || SvVIEW_mg(TARG))
         force_on_match = 1;
 
     /* only replace once? */
@@ -330,25 +330,25 @@ typedef struct {
     IV  runs;           /* how many runs must be combined into 1 */
 } off_runs;             /* pseudo-stack element */
 
+/* The mergesort proper, using the caller's auxiliary array of nmemb
+ * pointers.  It neither allocates nor calls back into perl, other than
+ * through cmp, so the parallel sort below can run it in worker threads.
+ */
+
 PERL_STATIC_FORCE_INLINE void
-S_sortsv_flags_impl(pTHX_ gptr *base, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
+S_sortsv_merge_impl(pTHX_ gptr *base, gptr *aux, size_t nmemb, SVCOMPARE_t cmp)
 {
     IV i, run, offset;
     I32 sense, level;
     gptr *f1, *f2, *t, *b, *p;
     int iwhich;
-    gptr *aux;
     gptr *p1;
-    gptr small[SMALLSORT];
     gptr *which[3];
     off_runs stack[60], *stackp;
 
-    PERL_UNUSED_ARG(flags);
-    PERL_ARGS_ASSERT_SORTSV_FLAGS_IMPL;
+    PERL_ARGS_ASSERT_SORTSV_MERGE_IMPL;
     if (nmemb <= 1) return;                     /* sorted trivially */
 
-    if (nmemb <= SMALLSORT) aux = small;        /* use stack for aux array */
-    else { Newx(aux,nmemb,gptr); }              /* allocate auxiliary array */
     level = 0;
     stackp = stack;
     stackp->runs = dynprep(aTHX_ base, aux, nmemb, cmp);
@@ -531,11 +531,25 @@ S_sortsv_flags_impl(pTHX_ gptr *base, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
         }
     }
   done:
-    if (aux != small) Safefree(aux);    /* free iff allocated */
-
     return;
 }
 
+PERL_STATIC_FORCE_INLINE void
+S_sortsv_flags_impl(pTHX_ gptr *base, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
+{
+    gptr *aux;
+    gptr small[SMALLSORT];
+
+    PERL_UNUSED_ARG(flags);
+    PERL_ARGS_ASSERT_SORTSV_FLAGS_IMPL;
+    if (nmemb <= 1) return;                     /* sorted trivially */
+
+    if (nmemb <= SMALLSORT) aux = small;        /* use stack for aux array */
+    else { Newx(aux,nmemb,gptr); }              /* allocate auxiliary array */
+    sortsv_merge_impl(base, aux, nmemb, cmp);
+    if (aux != small) Safefree(aux);    /* free iff allocated */
+}
+
 /*
 =for apidoc sortsv_flags
 
@@ -686,6 +700,591 @@ Perl_sortsv(pTHX_ SV **array, size_t nmemb, SVCOMPARE_t cmp)
 #define SvSIOK(sv) ((SvFLAGS(sv) & (SVf_IOK|SVf_IVisUV)) == SVf_IOK)
 #define SvNSIV(sv) ( SvNOK(sv) ? SvNVX(sv) : ( SvSIOK(sv) ? SvIVX(sv) : sv_2nv(sv) ) )
 
+/* Faster paths for the sorts which use one of the built-in comparators.
+ *
+ * The built-in comparators have to cope with magic, overloading,
+ * locales, NaNs (which warn), strings which need upgrading, and so on.
+ * But most big arrays being sorted are just plain numbers or plain
+ * strings which pp_sort has already converted, and for those, there
+ * are simpler ways of comparing them which give exactly the same
+ * order.  S_sort_simple_kind() checks whether an array qualifies, and
+ * if so, S_sortsv_simple() sorts it with a radix sort or, if asked to,
+ * in parallel.
+ */
+
+/* what the elements are compared as; add 1 for descending order */
+#define SORT_SIMPLE_IV  0
+#define SORT_SIMPLE_NV  2
+#define SORT_SIMPLE_PV  4
+
+PERL_STATIC_FORCE_INLINE I32
+S_simple_iv_cmp(pTHX_ SV *const a, SV *const b)
+{
+    const IV iv1 = SvIVX(a);
+    const IV iv2 = SvIVX(b);
+
+    PERL_ARGS_ASSERT_SIMPLE_IV_CMP;
+    PERL_UNUSED_CONTEXT;
+
+    return iv1 < iv2 ? -1 : iv1 > iv2 ? 1 : 0;
+}
+
+PERL_STATIC_FORCE_INLINE I32
+S_simple_iv_cmp_desc(pTHX_ SV *const a, SV *const b)
+{
+    PERL_ARGS_ASSERT_SIMPLE_IV_CMP_DESC;
+
+    return -S_simple_iv_cmp(aTHX_ a, b);
+}
+
+/* for SORT_SIMPLE_NV, which can also have integers that fit in an NV */
+#define SORT_SIMPLE_NVX(sv) (SvNOK(sv) ? SvNVX(sv) : (NV)SvIVX(sv))
+
+PERL_STATIC_FORCE_INLINE I32
+S_simple_nv_cmp(pTHX_ SV *const a, SV *const b)
+{
+    const NV nv1 = SORT_SIMPLE_NVX(a);
+    const NV nv2 = SORT_SIMPLE_NVX(b);
+
+    PERL_ARGS_ASSERT_SIMPLE_NV_CMP;
+    PERL_UNUSED_CONTEXT;
+
+    return nv1 < nv2 ? -1 : nv1 > nv2 ? 1 : 0;
+}
+
+PERL_STATIC_FORCE_INLINE I32
+S_simple_nv_cmp_desc(pTHX_ SV *const a, SV *const b)
+{
+    PERL_ARGS_ASSERT_SIMPLE_NV_CMP_DESC;
+
+    return -S_simple_nv_cmp(aTHX_ a, b);
+}
+
+/* same as sv_cmp() for two non-magical strings with the same UTF-8 flag */
+
+PERL_STATIC_FORCE_INLINE I32
+S_simple_pv_cmp(pTHX_ SV *const a, SV *const b)
+{
+    const STRLEN cur1 = SvCUR(a);
+    const STRLEN cur2 = SvCUR(b);
+    const int retval = memcmp(SvPVX_const(a), SvPVX_const(b),
+                              cur1 < cur2 ? cur1 : cur2);
+
+    PERL_ARGS_ASSERT_SIMPLE_PV_CMP;
+    PERL_UNUSED_CONTEXT;
+
+    if (retval)
+        return retval < 0 ? -1 : 1;
+    return cur1 < cur2 ? -1 : cur1 > cur2 ? 1 : 0;
+}
+
+PERL_STATIC_FORCE_INLINE I32
+S_simple_pv_cmp_desc(pTHX_ SV *const a, SV *const b)
+{
+    PERL_ARGS_ASSERT_SIMPLE_PV_CMP_DESC;
+
+    return -S_simple_pv_cmp(aTHX_ a, b);
+}
+
+/* If all the elements are already in a form that the simple comparators
+ * handle just as the built-in ones would, return which comparator to
+ * use (SORT_SIMPLE_*, plus 1 if descending), otherwise -1. */
+
+STATIC int
+S_sort_simple_kind(pTHX_ gptr *base, size_t nmemb, U8 priv, bool all_SIVs,
+                         bool descending)
+{
+    size_t i;
+    int kind;
+
+    PERL_ARGS_ASSERT_SORT_SIMPLE_KIND;
+
+    if (priv & OPpSORT_NUMERIC) {
+        if ((priv & OPpSORT_INTEGER) || all_SIVs) {
+            kind = SORT_SIMPLE_IV;
+            for (i = 0; i < nmemb; i++)
+                if ((SvFLAGS(base[i]) & (SVf_IOK|SVs_GMG)) != SVf_IOK)
+                    return -1;
+        }
+        else {
+            /* integers too big for an NV would lose precision */
+#if NV_PRESERVES_UV_BITS < IVSIZE * 8 - 1
+            const IV nv_max = (IV)1 << NV_PRESERVES_UV_BITS;
+#else
+            const IV nv_max = IV_MAX;
+#endif
+            kind = SORT_SIMPLE_NV;
+            for (i = 0; i < nmemb; i++) {
+                SV * const sv = base[i];
+                if (SvGMAGICAL(sv))
+                    return -1;
+                if (SvNOK(sv)) {
+                    if (Perl_isnan(SvNVX(sv)))
+                        return -1;
+                }
+                else if (!SvSIOK(sv)
+                         || SvIVX(sv) > nv_max || SvIVX(sv) < -nv_max)
+                    return -1;
+            }
+        }
+    }
+    else {
+        const U32 utf8 = SvUTF8(base[0]);
+#ifdef USE_LOCALE_COLLATE
+        if (IN_LC_RUNTIME(LC_COLLATE))
+            return -1;
+#endif
+        kind = SORT_SIMPLE_PV;
+        for (i = 0; i < nmemb; i++)
+            if ((SvFLAGS(base[i]) & (SVf_POK|SVs_GMG|SVf_UTF8))
+                != (SVf_POK|utf8))
+                return -1;
+    }
+
+    return descending ? kind + 1 : kind;
+}
+
+/* Radix sort.
+ *
+ * Rather than doing O(n log n) comparisons, extract each element's key
+ * once into a UV whose unsigned order is the sort order, and sort the
+ * (key, SV) pairs with an LSD radix sort, a byte at a time.  Each pass
+ * is a stable counting sort, so elements with equal keys keep their
+ * original order, as they do in the mergesort.  Passes where every key
+ * has the same byte are skipped, which makes small integers cheap.
+ *
+ * For strings, only the first UVSIZE bytes go into the key (big-endian
+ * and zero padded, so that a prefix sorts before the longer string),
+ * and each run of equal keys is then finished off with the mergesort.
+ */
+
+#ifndef PERL_SORT_RADIX_MIN
+#  define PERL_SORT_RADIX_MIN 512
+#endif
+
+typedef struct {
+    UV      key;
+    SV      *sv;
+} sort_keyed;
+
+#define SORT_KEY_TOPBIT (((UV)1) << (UVSIZE * 8 - 1))
+
+STATIC bool
+S_sortsv_radix(pTHX_ gptr *base, size_t nmemb, int kind)
+{
+    const UV flip = (kind & 1) ? UV_MAX : 0;    /* descending */
+    size_t counts[UVSIZE][256];
+    sort_keyed *src, *dst;
+    sort_keyed *keys;
+    size_t i;
+    unsigned byte;
+
+    PERL_ARGS_ASSERT_SORTSV_RADIX;
+
+#if NVSIZE != UVSIZE
+    /* no key big enough to hold an NV */
+    if ((kind & ~1) == SORT_SIMPLE_NV)
+        return FALSE;
+#endif
+
+    Newx(keys, 2 * nmemb, sort_keyed);
+
+    switch (kind & ~1) {
+    case SORT_SIMPLE_IV:
+        for (i = 0; i < nmemb; i++) {
+            keys[i].key = ((UV)SvIVX(base[i]) ^ SORT_KEY_TOPBIT) ^ flip;
+            keys[i].sv = base[i];
+        }
+        break;
+#if NVSIZE == UVSIZE
+    case SORT_SIMPLE_NV:
+        for (i = 0; i < nmemb; i++) {
+            NV nv = SORT_SIMPLE_NVX(base[i]);
+            UV key;
+            if (nv == 0.0)
+                nv = 0.0;               /* -0.0 sorts equal to 0.0 */
+            Copy(&nv, &key, 1, UV);
+            /* negatives sort in reverse, and before the positives */
+            key = (key & SORT_KEY_TOPBIT) ? ~key : key | SORT_KEY_TOPBIT;
+            keys[i].key = key ^ flip;
+            keys[i].sv = base[i];
+        }
+        break;
+#endif
+    case SORT_SIMPLE_PV:
+        for (i = 0; i < nmemb; i++) {
+            const U8 *s = (const U8 *)SvPVX_const(base[i]);
+            const STRLEN len = SvCUR(base[i]);
+            UV key = 0;
+            for (byte = 0; byte < UVSIZE; byte++)
+                key = (key << 8) | (byte < len ? s[byte] : 0);
+            keys[i].key = key ^ flip;
+            keys[i].sv = base[i];
+        }
+        break;
+    }
+
+    Zero(counts[0], UVSIZE * 256, size_t);
+    for (i = 0; i < nmemb; i++) {
+        UV key = keys[i].key;
+        for (byte = 0; byte < UVSIZE; byte++) {
+            counts[byte][key & 0xFF]++;
+            key >>= 8;
+        }
+    }
+
+    src = keys;
+    dst = keys + nmemb;
+    for (byte = 0; byte < UVSIZE; byte++) {
+        size_t *count = counts[byte];
+        const unsigned shift = byte * 8;
+        size_t total = 0;
+        sort_keyed *t;
+        unsigned digit;
+
+        if (count[(src[0].key >> shift) & 0xFF] == nmemb)
+            continue;                   /* all the same */
+        for (digit = 0; digit < 256; digit++) {
+            const size_t c = count[digit];
+            count[digit] = total;
+            total += c;
+        }
+        for (i = 0; i < nmemb; i++)
+            dst[count[(src[i].key >> shift) & 0xFF]++] = src[i];
+        t = src;
+        src = dst;
+        dst = t;
+    }
+
+    for (i = 0; i < nmemb; i++)
+        base[i] = src[i].sv;
+
+    if ((kind & ~1) == SORT_SIMPLE_PV) {
+        /* the other half of keys is free for use as the aux array */
+        gptr *aux = (gptr *)dst;
+        size_t j;
+        for (i = 0; i < nmemb; i = j) {
+            for (j = i + 1; j < nmemb && src[j].key == src[i].key; j++)
+                ;
+            if (j - i > 1) {
+                if (kind & 1)
+                    sortsv_merge_impl(base + i, aux, j - i,
+                                      S_simple_pv_cmp_desc);
+                else
+                    sortsv_merge_impl(base + i, aux, j - i,
+                                      S_simple_pv_cmp);
+            }
+        }
+    }
+
+    Safefree(keys);
+    return TRUE;
+}
+
+#if defined(USE_ITHREADS) && defined(I_PTHREAD)
+
+/* Parallel mergesort, enabled by "use sort 'parallel'".
+ *
+ * The array is cut into nthreads equal chunks, each of which is sorted
+ * by its own thread with the mergesort above.  Pairs of adjacent runs
+ * are then merged, each merge being split into nthreads/pairs pieces so
+ * that every level keeps all the threads busy, until one run is left.
+ * Merges take from the left run on ties, and each piece boundary is put
+ * where everything in the left run before it sorts no later than the
+ * split element, and everything in the right run before it strictly
+ * earlier, so the result is as stable as the serial sort's.
+ *
+ * The worker threads have no interpreter of their own, so they must do
+ * nothing except read the SVs being sorted and shuffle pointers to
+ * them, which the simple comparators are careful to do.
+ */
+
+#ifndef PERL_SORT_MAX_THREADS
+#  define PERL_SORT_MAX_THREADS 8
+#endif
+
+static const SVCOMPARE_t simple_cmps[] = {
+    S_simple_iv_cmp, S_simple_iv_cmp_desc,
+    S_simple_nv_cmp, S_simple_nv_cmp_desc,
+    S_simple_pv_cmp, S_simple_pv_cmp_desc,
+};
+
+typedef struct psort_job {
+    PerlInterpreter *interp;    /* only passed through to the comparator */
+    int     kind;               /* SORT_SIMPLE_* */
+    gptr    *list1;             /* sort: the chunk; merge: first run */
+    size_t  n1;
+    gptr    *list2;             /* merge: second run; NULL when sorting */
+    size_t  n2;
+    gptr    *dest;              /* sort: scratch space; merge: output */
+} psort_job;
+
+/* Sort list1 using dest as the auxiliary array, or, if list2 is
+ * non-NULL, merge the runs list1 and list2 into dest. */
+
+PERL_STATIC_FORCE_INLINE void
+S_psort_run(pTHX_ gptr *list1, size_t n1, gptr *list2, size_t n2,
+                  gptr *dest, SVCOMPARE_t cmp)
+{
+    gptr *end1 = list1 + n1;
+    gptr *end2;
+
+    PERL_ARGS_ASSERT_PSORT_RUN;
+
+    if (!list2) {
+        sortsv_merge_impl(list1, dest, n1, cmp);
+        return;
+    }
+
+    end2 = list2 + n2;
+    while (list1 < end1 && list2 < end2)
+        *dest++ = cmp(aTHX_ *list2, *list1) < 0 ? *list2++ : *list1++;
+    while (list1 < end1)
+        *dest++ = *list1++;
+    while (list2 < end2)
+        *dest++ = *list2++;
+}
+
+/* The body of each worker thread; with the comparator known, the
+ * compiler can inline it into the sort and merge loops. */
+
+STATIC void *
+S_psort_worker(void *arg)
+{
+    psort_job *job = (psort_job *)arg;
+    dTHXa(job->interp);
+
+    PERL_ARGS_ASSERT_PSORT_WORKER;
+
+#define PSORT_CASE(kind, cmp)                                           \
+    case kind:                                                          \
+        psort_run(job->list1, job->n1, job->list2, job->n2,             \
+                  job->dest, cmp);                                      \
+        break;
+
+    switch (job->kind) {
+    PSORT_CASE(SORT_SIMPLE_IV,     S_simple_iv_cmp)
+    PSORT_CASE(SORT_SIMPLE_IV + 1, S_simple_iv_cmp_desc)
+    PSORT_CASE(SORT_SIMPLE_NV,     S_simple_nv_cmp)
+    PSORT_CASE(SORT_SIMPLE_NV + 1, S_simple_nv_cmp_desc)
+    PSORT_CASE(SORT_SIMPLE_PV,     S_simple_pv_cmp)
+    PSORT_CASE(SORT_SIMPLE_PV + 1, S_simple_pv_cmp_desc)
+    }
+
+#undef PSORT_CASE
+
+    return NULL;
+}
+
+/* Run the jobs, all but the first in new threads, and wait for them
+ * all to finish.  The threads are started with signals blocked, so
+ * that they are only ever delivered to the interpreter's own thread.
+ * If a thread can't be started, its job is just run here instead. */
+
+STATIC void
+S_psort_run_jobs(psort_job *jobs, unsigned njobs)
+{
+    pthread_t tids[PERL_SORT_MAX_THREADS];
+    bool started[PERL_SORT_MAX_THREADS];
+    sigset_t newmask, oldmask;
+    unsigned i;
+
+    PERL_ARGS_ASSERT_PSORT_RUN_JOBS;
+
+    sigfillset(&newmask);
+#ifdef SIGILL
+    sigdelset(&newmask, SIGILL);
+#endif
+#ifdef SIGBUS
+    sigdelset(&newmask, SIGBUS);
+#endif
+#ifdef SIGSEGV
+    sigdelset(&newmask, SIGSEGV);
+#endif
+    pthread_sigmask(SIG_BLOCK, &newmask, &oldmask);
+    for (i = 1; i < njobs; i++)
+        started[i] = pthread_create(&tids[i], NULL, S_psort_worker,
+                                    &jobs[i]) == 0;
+    pthread_sigmask(SIG_SETMASK, &oldmask, NULL);
+
+    (void)S_psort_worker(&jobs[0]);
+
+    for (i = 1; i < njobs; i++) {
+        if (started[i])
+            pthread_join(tids[i], NULL);
+        else
+            (void)S_psort_worker(&jobs[i]);
+    }
+}
+
+/* number of elements in list less than key */
+
+STATIC size_t
+S_psort_lower_bound(pTHX_ gptr *list, size_t n, SV *key, SVCOMPARE_t cmp)
+{
+    size_t lo = 0;
+
+    PERL_ARGS_ASSERT_PSORT_LOWER_BOUND;
+
+    while (lo < n) {
+        const size_t mid = lo + (n - lo) / 2;
+        if (cmp(aTHX_ list[mid], key) < 0)
+            lo = mid + 1;
+        else
+            n = mid;
+    }
+    return lo;
+}
+
+/* How many threads to sort nmemb elements with, if "use sort 'parallel'"
+ * is in effect and the array is big enough; otherwise 0. */
+
+STATIC unsigned
+S_sort_parallel_threads(pTHX_ size_t nmemb)
+{
+    SV *hint;
+    IV nthreads = 0;
+
+    PERL_ARGS_ASSERT_SORT_PARALLEL_THREADS;
+
+    if (!(CopHINTS_get(PL_curcop) & HINT_LOCALIZE_HH))
+        return 0;
+    hint = cop_hints_fetch_pvs(PL_curcop, "sort_parallel", 0);
+    if (!SvOK(hint) || nmemb < SvUV(hint))
+        return 0;
+
+    hint = cop_hints_fetch_pvs(PL_curcop, "sort_threads", 0);
+    if (SvOK(hint))
+        nthreads = SvIV(hint);
+#ifdef _SC_NPROCESSORS_ONLN
+    else
+        nthreads = (IV)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (nthreads > PERL_SORT_MAX_THREADS)
+        nthreads = PERL_SORT_MAX_THREADS;
+    if (nthreads < 2)
+        return 0;
+    /* the merge levels below want a power of two */
+    while (nthreads & (nthreads - 1))
+        nthreads &= nthreads - 1;
+    return nthreads;
+}
+
+STATIC void
+S_sortsv_parallel(pTHX_ gptr *base, size_t nmemb, int kind,
+                        unsigned nthreads)
+{
+    const SVCOMPARE_t cmp = simple_cmps[kind];
+    psort_job jobs[PERL_SORT_MAX_THREADS];
+    size_t bounds[PERL_SORT_MAX_THREADS + 1];
+    gptr *aux, *src, *dst;
+    size_t i;
+    unsigned runs;
+
+    PERL_ARGS_ASSERT_SORTSV_PARALLEL;
+
+    Newx(aux, nmemb, gptr);
+
+    for (i = 0; i <= nthreads; i++)
+        bounds[i] = nmemb / nthreads * i + nmemb % nthreads * i / nthreads;
+
+    /* sort each chunk */
+    for (i = 0; i < nthreads; i++) {
+        jobs[i].interp = my_perl;
+        jobs[i].kind   = kind;
+        jobs[i].list1  = base + bounds[i];
+        jobs[i].n1     = bounds[i + 1] - bounds[i];
+        jobs[i].list2  = NULL;
+        jobs[i].n2     = 0;
+        jobs[i].dest   = aux + bounds[i];
+    }
+    psort_run_jobs(jobs, nthreads);
+
+    /* then merge pairs of runs until there's just one */
+    src = base;
+    dst = aux;
+    for (runs = nthreads; runs > 1; runs /= 2) {
+        const unsigned pieces = nthreads / (runs / 2);
+        unsigned njobs = 0;
+        unsigned r;
+
+        for (r = 0; r < runs; r += 2) {
+            gptr *list1 = src + bounds[r];
+            gptr *list2 = src + bounds[r + 1];
+            const size_t n1 = bounds[r + 1] - bounds[r];
+            const size_t n2 = bounds[r + 2] - bounds[r + 1];
+            size_t done1 = 0, done2 = 0;
+            unsigned piece;
+
+            for (piece = 1; piece <= pieces; piece++) {
+                size_t end1 = n1, end2 = n2;
+                if (piece < pieces) {
+                    end1 = n1 / pieces * piece + n1 % pieces * piece / pieces;
+                    end2 = end1 < n1
+                         ? psort_lower_bound(list2, n2, list1[end1], cmp)
+                         : n2;
+                }
+                jobs[njobs].interp = my_perl;
+                jobs[njobs].kind   = kind;
+                jobs[njobs].list1  = list1 + done1;
+                jobs[njobs].n1     = end1 - done1;
+                jobs[njobs].list2  = list2 + done2;
+                jobs[njobs].n2     = end2 - done2;
+                jobs[njobs].dest   = dst + bounds[r] + done1 + done2;
+                njobs++;
+                done1 = end1;
+                done2 = end2;
+            }
+        }
+        psort_run_jobs(jobs, njobs);
+
+        for (r = 0; r <= runs; r += 2)
+            bounds[r / 2] = bounds[r];
+        src = dst;
+        dst = src == aux ? base : aux;
+    }
+
+    if (src != base)
+        Copy(src, base, nmemb, gptr);
+    Safefree(aux);
+}
+
+#endif /* USE_ITHREADS && I_PTHREAD */
+
+/* Sort base with one of the faster paths above, if it's worth it and
+ * the elements are suitable.  Returns false, having done nothing, if
+ * the caller should do a normal sort instead. */
+
+STATIC bool
+S_sortsv_simple(pTHX_ gptr *base, size_t nmemb, U8 priv, bool all_SIVs,
+                      bool descending)
+{
+    unsigned nthreads = 0;
+    int kind;
+
+    PERL_ARGS_ASSERT_SORTSV_SIMPLE;
+
+#if defined(USE_ITHREADS) && defined(I_PTHREAD)
+    nthreads = sort_parallel_threads(nmemb);
+#endif
+    if (!nthreads && nmemb < PERL_SORT_RADIX_MIN)
+        return FALSE;
+
+    kind = sort_simple_kind(base, nmemb, priv, all_SIVs, descending);
+    if (kind < 0)
+        return FALSE;
+
+#if defined(USE_ITHREADS) && defined(I_PTHREAD)
+    if (nthreads) {
+        sortsv_parallel(base, nmemb, kind, nthreads);
+        return TRUE;
+    }
+#endif
+    return sortsv_radix(base, nmemb, kind);
+}
+
+
+
 PP(pp_sort)
 {
     dMARK; dORIGMARK;
@@ -1000,6 +1599,11 @@ PP(pp_sort)
             MEXTEND(SP, 20); Can't afford stack realloc on signal.
             */
             start = p1 - max;
+            if (!overloading
+                && sortsv_simple(start, max, priv, cBOOL(all_SIVs),
+                                 cBOOL(descending)))
+                NOOP;
+            else
             if (priv & OPpSORT_NUMERIC) {
                 if ((priv & OPpSORT_INTEGER) || all_SIVs) {
                     if (overloading)
@@ -1386,7 +1386,8 @@ PP_wrapped(pp_sselect, 4, 0)
             if (!(SvPOK(sv) && SvCUR(sv) == 0))
                 Perl_croak_no_modify();
         }
-        else if (SvIsCOW(sv)) sv_force_normal_flags(sv, 0);
+        else if (SvIsCOW(sv) || SvVIEW_mg(sv))
+            sv_force_normal_flags(sv, 0);
         if (SvPOK(sv)) {
             if (SvUTF8(sv)) sv_utf8_downgrade(sv, FALSE);
         }
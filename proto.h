@@ -1575,6 +1575,11 @@ Perl_hv_bucket_ratio(pTHX_ HV *hv)
 #define PERL_ARGS_ASSERT_HV_BUCKET_RATIO        \
         assert(hv)
 
+PERL_CALLCONV void
+Perl_hv_build_from_pairs(pTHX_ HV *hv, SV * const *pairs, SSize_t npairs);
+#define PERL_ARGS_ASSERT_HV_BUILD_FROM_PAIRS    \
+        assert(hv); assert(pairs)
+
 PERL_CALLCONV void
 Perl_hv_clear(pTHX_ HV *hv);
 #define PERL_ARGS_ASSERT_HV_CLEAR
@@ -3262,6 +3267,14 @@ PERL_CALLCONV OP *
 Perl_op_prepend_elem(pTHX_ I32 optype, OP *first, OP *last);
 #define PERL_ARGS_ASSERT_OP_PREPEND_ELEM
 
+PERL_CALLCONV void
+Perl_op_profile_start(pTHX_ const char *file, UV interval);
+#define PERL_ARGS_ASSERT_OP_PROFILE_START
+
+PERL_CALLCONV void
+Perl_op_profile_stop(pTHX);
+#define PERL_ARGS_ASSERT_OP_PROFILE_STOP
+
 PERL_CALLCONV void
 Perl_op_refcnt_lock(pTHX);
 #define PERL_ARGS_ASSERT_OP_REFCNT_LOCK
@@ -3623,6 +3636,20 @@ Perl_rcpv_new(pTHX_ const char * const pv, STRLEN len, U32 flags)
         __attribute__warn_unused_result__;
 #define PERL_ARGS_ASSERT_RCPV_NEW
 
+PERL_CALLCONV REGEXP *
+Perl_re_cache_fetch(pTHX_ const regexp_engine *eng, const char *pat, STRLEN plen, U32 hash, U32 flags);
+#define PERL_ARGS_ASSERT_RE_CACHE_FETCH         \
+        assert(eng); assert(pat)
+
+PERL_CALLCONV void
+Perl_re_cache_resize(pTHX_ Size_t size);
+#define PERL_ARGS_ASSERT_RE_CACHE_RESIZE
+
+PERL_CALLCONV void
+Perl_re_cache_store(pTHX_ REGEXP *rx, U32 hash, U32 flags);
+#define PERL_ARGS_ASSERT_RE_CACHE_STORE         \
+        assert(rx)
+
 PERL_CALLCONV REGEXP *
 Perl_re_compile(pTHX_ SV * const pattern, U32 orig_rx_flags);
 #define PERL_ARGS_ASSERT_RE_COMPILE             \
@@ -3875,6 +3902,10 @@ PERL_CALLCONV int
 Perl_runops_debug(pTHX);
 #define PERL_ARGS_ASSERT_RUNOPS_DEBUG
 
+PERL_CALLCONV int
+Perl_runops_profile(pTHX);
+#define PERL_ARGS_ASSERT_RUNOPS_PROFILE
+
 PERL_CALLCONV int
 Perl_runops_standard(pTHX);
 #define PERL_ARGS_ASSERT_RUNOPS_STANDARD
@@ -4361,6 +4392,11 @@ Perl_sv_2uv_flags(pTHX_ SV * const sv, const I32 flags);
 #define PERL_ARGS_ASSERT_SV_2UV_FLAGS           \
         assert(sv)
 
+PERL_CALLCONV void
+Perl_sv_arena_stats(pTHX_ HV *hv);
+#define PERL_ARGS_ASSERT_SV_ARENA_STATS         \
+        assert(hv)
+
 PERL_CALLCONV void
 Perl_sv_backoff(SV * const sv);
 #define PERL_ARGS_ASSERT_SV_BACKOFF             \
@@ -4449,6 +4485,10 @@ PERL_CALLCONV I32
 Perl_sv_cmp_locale_flags(pTHX_ SV * const sv1, SV * const sv2, const U32 flags);
 #define PERL_ARGS_ASSERT_SV_CMP_LOCALE_FLAGS
 
+PERL_CALLCONV Size_t
+Perl_sv_compact_arenas(pTHX);
+#define PERL_ARGS_ASSERT_SV_COMPACT_ARENAS
+
 PERL_CALLCONV void
 Perl_sv_copypv_flags(pTHX_ SV * const dsv, SV * const ssv, const I32 flags);
 #define PERL_ARGS_ASSERT_SV_COPYPV_FLAGS        \
@@ -4579,6 +4619,10 @@ Perl_sv_grow_fresh(pTHX_ SV * const sv, STRLEN newlen);
 #define PERL_ARGS_ASSERT_SV_GROW_FRESH          \
         assert(sv)
 
+PERL_CALLCONV void
+Perl_sv_heap_usage(pTHX_ HV *by_type, HV *by_package, HV *by_pad);
+#define PERL_ARGS_ASSERT_SV_HEAP_USAGE
+
 PERL_CALLCONV void
 Perl_sv_inc(pTHX_ SV * const sv);
 #define PERL_ARGS_ASSERT_SV_INC
@@ -4808,6 +4852,12 @@ Perl_sv_setpv_mg(pTHX_ SV * const sv, const char * const ptr);
 #define PERL_ARGS_ASSERT_SV_SETPV_MG            \
         assert(sv)
 
+PERL_CALLCONV void
+Perl_sv_setpv_view(pTHX_ SV * const dsv, SV * const ssv, const STRLEN offset)
+        __attribute__visibility__("hidden");
+#define PERL_ARGS_ASSERT_SV_SETPV_VIEW          \
+        assert(dsv); assert(ssv)
+
 PERL_CALLCONV void
 Perl_sv_setpvf(pTHX_ SV * const sv, const char * const pat, ...)
         __attribute__format__(__printf__,pTHX_2,pTHX_3);
@@ -6977,6 +7027,28 @@ STATIC void
 S_unshare_hek_or_pvn(pTHX_ const HEK *hek, const char *str, I32 len, U32 hash);
 # define PERL_ARGS_ASSERT_UNSHARE_HEK_OR_PVN
 
+# if defined(PERL_HV_INCREMENTAL_SPLIT)
+STATIC void
+S_hsplit_step(pTHX_ HV *hv, STRLEN nbuckets);
+#   define PERL_ARGS_ASSERT_HSPLIT_STEP         \
+        assert(hv)
+
+#   if !defined(PERL_NO_INLINE_FUNCTIONS)
+PERL_STATIC_INLINE STRLEN
+S_hv_bucket_index(HV *hv, U32 hash)
+        __attribute__warn_unused_result__;
+#     define PERL_ARGS_ASSERT_HV_BUCKET_INDEX   \
+        assert(hv)
+
+#   endif
+# endif /* defined(PERL_HV_INCREMENTAL_SPLIT) */
+# if !defined(PERL_NO_INLINE_FUNCTIONS)
+PERL_STATIC_INLINE STRLEN
+S_hsplit_bucket(pTHX_ HE **aep, STRLEN i, STRLEN mask);
+#   define PERL_ARGS_ASSERT_HSPLIT_BUCKET       \
+        assert(aep)
+
+# endif
 # if !defined(PURIFY)
 STATIC HE *
 S_new_he(pTHX)
@@ -7742,6 +7814,29 @@ S_refto(pTHX_ SV *sv)
 # define PERL_ARGS_ASSERT_REFTO                 \
         assert(sv)
 
+STATIC SSize_t
+S_split_estimate(const char *s, const char *strend, const char *sep, STRLEN seplen)
+        __attribute__warn_unused_result__;
+# define PERL_ARGS_ASSERT_SPLIT_ESTIMATE        \
+        assert(s); assert(strend); assert(sep)
+
+# if defined(I_PTHREAD) && defined(USE_ITHREADS)
+STATIC void
+S_psplit_run_jobs(struct psplit_job *jobs, unsigned njobs);
+#   define PERL_ARGS_ASSERT_PSPLIT_RUN_JOBS     \
+        assert(jobs)
+
+STATIC void *
+S_psplit_worker(void *arg);
+#   define PERL_ARGS_ASSERT_PSPLIT_WORKER       \
+        assert(arg)
+
+STATIC unsigned
+S_split_parallel(pTHX_ const char *s, const char *strend, SV *sep, struct psplit_job *jobs);
+#   define PERL_ARGS_ASSERT_SPLIT_PARALLEL      \
+        assert(s); assert(strend); assert(sep); assert(jobs)
+
+# endif /* defined(I_PTHREAD) && defined(USE_ITHREADS) */
 #endif /* defined(PERL_IN_PP_C) */
 #if defined(PERL_IN_PP_C) || defined(PERL_IN_PP_HOT_C)
 
@@ -7983,6 +8078,11 @@ S_unpack_rec(pTHX_ struct tempsym *symptr, const char *s, const char *strbeg, co
 
 #endif /* defined(PERL_IN_PP_PACK_C) */
 #if defined(PERL_IN_PP_SORT_C)
+STATIC int
+S_sort_simple_kind(pTHX_ SV **base, size_t nmemb, U8 priv, bool all_SIVs, bool descending);
+# define PERL_ARGS_ASSERT_SORT_SIMPLE_KIND      \
+        assert(base)
+
 STATIC I32
 S_sortcv(pTHX_ SV * const a, SV * const b);
 # define PERL_ARGS_ASSERT_SORTCV                \
@@ -7998,6 +8098,50 @@ S_sortcv_xsub(pTHX_ SV * const a, SV * const b);
 # define PERL_ARGS_ASSERT_SORTCV_XSUB           \
         assert(a); assert(b)
 
+STATIC bool
+S_sortsv_radix(pTHX_ SV **base, size_t nmemb, int kind);
+# define PERL_ARGS_ASSERT_SORTSV_RADIX          \
+        assert(base)
+
+STATIC bool
+S_sortsv_simple(pTHX_ SV **base, size_t nmemb, U8 priv, bool all_SIVs, bool descending);
+# define PERL_ARGS_ASSERT_SORTSV_SIMPLE         \
+        assert(base)
+
+# if defined(I_PTHREAD) && defined(USE_ITHREADS)
+STATIC size_t
+S_psort_lower_bound(pTHX_ SV **list, size_t n, SV *key, SVCOMPARE_t cmp);
+#   define PERL_ARGS_ASSERT_PSORT_LOWER_BOUND   \
+        assert(list); assert(key); assert(cmp)
+
+STATIC void
+S_psort_run_jobs(struct psort_job *jobs, unsigned njobs);
+#   define PERL_ARGS_ASSERT_PSORT_RUN_JOBS      \
+        assert(jobs)
+
+STATIC void *
+S_psort_worker(void *arg);
+#   define PERL_ARGS_ASSERT_PSORT_WORKER        \
+        assert(arg)
+
+STATIC unsigned
+S_sort_parallel_threads(pTHX_ size_t nmemb);
+#   define PERL_ARGS_ASSERT_SORT_PARALLEL_THREADS
+
+STATIC void
+S_sortsv_parallel(pTHX_ SV **base, size_t nmemb, int kind, unsigned nthreads);
+#   define PERL_ARGS_ASSERT_SORTSV_PARALLEL     \
+        assert(base)
+
+#   if !defined(PERL_NO_INLINE_FUNCTIONS)
+PERL_STATIC_FORCE_INLINE void
+S_psort_run(pTHX_ SV **list1, size_t n1, SV **list2, size_t n2, SV **dest, SVCOMPARE_t cmp)
+        __attribute__always_inline__;
+#     define PERL_ARGS_ASSERT_PSORT_RUN         \
+        assert(list1); assert(dest); assert(cmp)
+
+#   endif
+# endif /* defined(I_PTHREAD) && defined(USE_ITHREADS) */
 # if !defined(PERL_NO_INLINE_FUNCTIONS)
 PERL_STATIC_INLINE I32
 S_amagic_cmp(pTHX_ SV * const str1, SV * const str2);
@@ -8034,12 +8178,48 @@ S_cmp_desc(pTHX_ SV * const str1, SV * const str2);
 #   define PERL_ARGS_ASSERT_CMP_DESC            \
         assert(str1); assert(str2)
 
+PERL_STATIC_INLINE I32
+S_simple_iv_cmp(pTHX_ SV * const a, SV * const b);
+#   define PERL_ARGS_ASSERT_SIMPLE_IV_CMP       \
+        assert(a); assert(b)
+
+PERL_STATIC_INLINE I32
+S_simple_iv_cmp_desc(pTHX_ SV * const a, SV * const b);
+#   define PERL_ARGS_ASSERT_SIMPLE_IV_CMP_DESC  \
+        assert(a); assert(b)
+
+PERL_STATIC_INLINE I32
+S_simple_nv_cmp(pTHX_ SV * const a, SV * const b);
+#   define PERL_ARGS_ASSERT_SIMPLE_NV_CMP       \
+        assert(a); assert(b)
+
+PERL_STATIC_INLINE I32
+S_simple_nv_cmp_desc(pTHX_ SV * const a, SV * const b);
+#   define PERL_ARGS_ASSERT_SIMPLE_NV_CMP_DESC  \
+        assert(a); assert(b)
+
+PERL_STATIC_INLINE I32
+S_simple_pv_cmp(pTHX_ SV * const a, SV * const b);
+#   define PERL_ARGS_ASSERT_SIMPLE_PV_CMP       \
+        assert(a); assert(b)
+
+PERL_STATIC_INLINE I32
+S_simple_pv_cmp_desc(pTHX_ SV * const a, SV * const b);
+#   define PERL_ARGS_ASSERT_SIMPLE_PV_CMP_DESC  \
+        assert(a); assert(b)
+
 PERL_STATIC_FORCE_INLINE void
 S_sortsv_flags_impl(pTHX_ SV **array, size_t num_elts, SVCOMPARE_t cmp, U32 flags)
         __attribute__always_inline__;
 #   define PERL_ARGS_ASSERT_SORTSV_FLAGS_IMPL   \
         assert(cmp)
 
+PERL_STATIC_FORCE_INLINE void
+S_sortsv_merge_impl(pTHX_ SV **base, SV **aux, size_t nmemb, SVCOMPARE_t cmp)
+        __attribute__always_inline__;
+#   define PERL_ARGS_ASSERT_SORTSV_MERGE_IMPL   \
+        assert(base); assert(aux); assert(cmp)
+
 PERL_STATIC_INLINE I32
 S_sv_i_ncmp(pTHX_ SV * const a, SV * const b);
 #   define PERL_ARGS_ASSERT_SV_I_NCMP           \
@@ -8301,6 +8481,16 @@ S_is_ssc_worth_it(const RExC_state_t *pRExC_state, const regnode_ssc *ssc);
 # define PERL_ARGS_ASSERT_IS_SSC_WORTH_IT       \
         assert(pRExC_state); assert(ssc)
 
+STATIC void
+S_linear_compile(pTHX_ RExC_state_t *pRExC_state, const bool required);
+# define PERL_ARGS_ASSERT_LINEAR_COMPILE        \
+        assert(pRExC_state)
+
+STATIC bool
+S_linear_hint(pTHX)
+        __attribute__warn_unused_result__;
+# define PERL_ARGS_ASSERT_LINEAR_HINT
+
 STATIC void
 S_nextchar(pTHX_ RExC_state_t *pRExC_state);
 # define PERL_ARGS_ASSERT_NEXTCHAR              \
@@ -8420,6 +8610,11 @@ S_set_regex_pv(pTHX_ RExC_state_t *pRExC_state, REGEXP *Rx);
 # define PERL_ARGS_ASSERT_SET_REGEX_PV          \
         assert(pRExC_state); assert(Rx)
 
+STATIC void
+S_set_stclass_ranges(pTHX_ RExC_state_t *pRExC_state);
+# define PERL_ARGS_ASSERT_SET_STCLASS_RANGES    \
+        assert(pRExC_state)
+
 STATIC void
 S_skip_to_be_ignored_text(pTHX_ RExC_state_t *pRExC_state, char **p, const bool force_to_xmod);
 # define PERL_ARGS_ASSERT_SKIP_TO_BE_IGNORED_TEXT \
@@ -8430,6 +8625,11 @@ S_ssc_finalize(pTHX_ RExC_state_t *pRExC_state, regnode_ssc *ssc);
 # define PERL_ARGS_ASSERT_SSC_FINALIZE          \
         assert(pRExC_state); assert(ssc)
 
+STATIC void
+S_straight_compile(pTHX_ RExC_state_t *pRExC_state);
+# define PERL_ARGS_ASSERT_STRAIGHT_COMPILE      \
+        assert(pRExC_state)
+
 # if defined(DEBUGGING)
 STATIC regnode_offset
 S_regnode_guts_debug(pTHX_ RExC_state_t *pRExC_state, const U8 op, const STRLEN extra_len);
@@ -8720,6 +8920,12 @@ S_find_byclass(pTHX_ regexp *prog, const regnode *c, char *s, const char *strend
 # define PERL_ARGS_ASSERT_FIND_BYCLASS          \
         assert(prog); assert(c); assert(s); assert(strend)
 
+STATIC U8 *
+S_find_next_in_ranges(U8 *s, const U8 *send, const reg_stclass_ranges *ranges)
+        __attribute__warn_unused_result__;
+# define PERL_ARGS_ASSERT_FIND_NEXT_IN_RANGES   \
+        assert(s); assert(send); assert(ranges)
+
 STATIC U8 *
 S_find_next_masked(U8 *s, const U8 *send, const U8 byte, const U8 mask)
         __attribute__warn_unused_result__;
@@ -8773,6 +8979,18 @@ S_isWB(pTHX_ WB_enum previous, WB_enum before, WB_enum after, const U8 * const s
 # define PERL_ARGS_ASSERT_ISWB                  \
         assert(strbeg); assert(curpos); assert(strend)
 
+STATIC bool
+S_linear_assert(pTHX_ const regnode *scan, const char *locinput, const regmatch_info *reginfo)
+        __attribute__warn_unused_result__;
+# define PERL_ARGS_ASSERT_LINEAR_ASSERT         \
+        assert(scan); assert(locinput); assert(reginfo)
+
+STATIC I32
+S_linear_exec(pTHX_ regmatch_info *reginfo, char *startpos)
+        __attribute__warn_unused_result__;
+# define PERL_ARGS_ASSERT_LINEAR_EXEC           \
+        assert(reginfo); assert(startpos)
+
 STATIC I32
 S_reg_check_named_buff_matched(const regexp *rex, const regnode *scan)
         __attribute__warn_unused_result__;
@@ -8837,6 +9055,12 @@ S_regtry(pTHX_ regmatch_info *reginfo, char **startposp)
 # define PERL_ARGS_ASSERT_REGTRY                \
         assert(reginfo); assert(startposp)
 
+STATIC SSize_t
+S_straight_exec(pTHX_ regmatch_info *reginfo, char *startpos)
+        __attribute__warn_unused_result__;
+# define PERL_ARGS_ASSERT_STRAIGHT_EXEC         \
+        assert(reginfo); assert(startpos)
+
 STATIC bool
 S_to_byte_substr(pTHX_ regexp *prog);
 # define PERL_ARGS_ASSERT_TO_BYTE_SUBSTR        \
@@ -8991,6 +9215,14 @@ S_assert_uft8_cache_coherent(pTHX_ const char * const func, STRLEN from_cache, S
 # define PERL_ARGS_ASSERT_ASSERT_UFT8_CACHE_COHERENT \
         assert(func); assert(sv)
 
+STATIC Size_t
+S_compact_body_arenas(pTHX);
+# define PERL_ARGS_ASSERT_COMPACT_BODY_ARENAS
+
+STATIC Size_t
+S_compact_head_arenas(pTHX);
+# define PERL_ARGS_ASSERT_COMPACT_HEAD_ARENAS
+
 STATIC bool
 S_curse(pTHX_ SV * const sv, const bool check_refcnt);
 # define PERL_ARGS_ASSERT_CURSE                 \
@@ -9027,6 +9259,11 @@ S_glob_assign_glob(pTHX_ SV * const dsv, SV * const ssv, const int dtype);
 # define PERL_ARGS_ASSERT_GLOB_ASSIGN_GLOB      \
         assert(dsv); assert(ssv)
 
+STATIC void
+S_heap_usage_store(pTHX_ HV *hv, const char *name, STRLEN len, bool utf8, UV count, UV bytes);
+# define PERL_ARGS_ASSERT_HEAP_USAGE_STORE      \
+        assert(hv); assert(name)
+
 PERL_CALLCONV SV *
 Perl_more_sv(pTHX);
 # define PERL_ARGS_ASSERT_MORE_SV
@@ -9062,6 +9299,12 @@ S_sv_display(pTHX_ SV * const sv, char *tmpbuf, STRLEN tmpbuf_size);
 # define PERL_ARGS_ASSERT_SV_DISPLAY            \
         assert(sv); assert(tmpbuf)
 
+STATIC Size_t
+S_sv_heap_size(pTHX_ const SV * const sv)
+        __attribute__warn_unused_result__;
+# define PERL_ARGS_ASSERT_SV_HEAP_SIZE          \
+        assert(sv)
+
 STATIC STRLEN
 S_sv_pos_b2u_midway(pTHX_ const U8 * const s, const U8 * const target, const U8 *end, STRLEN endu);
 # define PERL_ARGS_ASSERT_SV_POS_B2U_MIDWAY     \
@@ -9403,13 +9646,33 @@ S_utf16_textfilter(pTHX_ int idx, SV *sv, int maxlen);
 # endif /* !defined(PERL_NO_UTF16_FILTER) */
 #endif /* defined(PERL_IN_TOKE_C) */
 #if defined(PERL_IN_UNIVERSAL_C)
+STATIC bool
+S_copy_direct(pTHX_ PerlIO *f);
+# define PERL_ARGS_ASSERT_COPY_DIRECT           \
+        assert(f)
+
+STATIC IO *
+S_copy_io(pTHX_ SV *sv, GV **gvp);
+# define PERL_ARGS_ASSERT_COPY_IO               \
+        assert(sv); assert(gvp)
+
+STATIC int
+S_copy_kernel(pTHX_ int infd, int outfd, Off_t max, Off_t *copied);
+# define PERL_ARGS_ASSERT_COPY_KERNEL           \
+        assert(copied)
+
+STATIC bool
+S_copy_loop(pTHX_ PerlIO *in, PerlIO *out, Off_t max, Off_t *copied);
+# define PERL_ARGS_ASSERT_COPY_LOOP             \
+        assert(in); assert(out); assert(copied)
+
 STATIC bool
 S_isa_lookup(pTHX_ HV *stash, SV *namesv, const char *name, STRLEN len, U32 flags);
 
 STATIC bool
 S_sv_derived_from_svpvn(pTHX_ SV *sv, SV *namesv, const char *name, const STRLEN len, U32 flags);
 
-#endif
+#endif /* defined(PERL_IN_UNIVERSAL_C) */
 #if defined(PERL_IN_UTF8_C)
 STATIC UV
 S__to_utf8_case(pTHX_ const UV original, const U8 *p, U8 *ustrp, STRLEN *lenp, SV *invlist, const I32 * const invmap, const U32 * const * const aux_tables, const U8 * const aux_table_lengths, const char * const normal);
@@ -9530,6 +9793,14 @@ STATIC void
 S_pidgone(pTHX_ Pid_t pid, int status);
 #   define PERL_ARGS_ASSERT_PIDGONE
 
+# endif
+# if defined(PERL_USE_SSE2)
+STATIC char *
+S_first_last_instr(const U8 *big, const U8 *bigend, const U8 *little, const STRLEN littlelen)
+        __attribute__warn_unused_result__;
+#   define PERL_ARGS_ASSERT_FIRST_LAST_INSTR    \
+        assert(big); assert(bigend); assert(little)
+
 # endif
 #endif /* defined(PERL_IN_UTIL_C) */
 #if defined(PERL_MEM_LOG)
@@ -1308,6 +1308,1141 @@ S_is_ssc_worth_it(const RExC_state_t * pRExC_state, const regnode_ssc * ssc)
     return TRUE;
 }
 
+/* The flags a run-time pattern is cached under by re_cache_fetch() and
+ * re_cache_store(): its compile flags, plus whether it is in UTF-8,
+ * whether 'use re "strict"' or 'use re "linear"' is in effect, and whether
+ * -w is on, which decides which warnings get raised when no lexical
+ * warnings are in effect. */
+#define RE_CACHE_LINEAR (1U<<28)
+#define RE_CACHE_UTF8   (1U<<29)
+#define RE_CACHE_STRICT (1U<<30)
+#define RE_CACHE_DOWARN (1U<<31)
+#define RE_CACHE_FLAGS(rx_flags, utf8, pm_flags)                        \
+    (   ((rx_flags) & RXf_PMf_FLAGCOPYMASK)                             \
+     | ((utf8) ? RE_CACHE_UTF8 : 0)                                     \
+     | (((pm_flags) & RXf_PMf_STRICT) ? RE_CACHE_STRICT : 0)            \
+     | (linear_hint() ? RE_CACHE_LINEAR : 0)                            \
+     | ((PL_dowarn & G_WARN_ON) ? RE_CACHE_DOWARN : 0))
+
+/* Return whether "use re 'linear'" is in effect, under which patterns must
+ * be matched by the linear-time matcher */
+STATIC bool
+S_linear_hint(pTHX)
+{
+    if (IN_PERL_COMPILETIME) {
+        HV * const table = GvHV(PL_hintgv);
+        SV **ptr;
+
+        if (!table || !(PL_hints & HINT_LOCALIZE_HH))
+            return FALSE;
+        ptr = hv_fetchs(table, "re_linear", FALSE);
+        return cBOOL(ptr && SvTRUE(*ptr));
+    }
+    else {
+        SV *ptr;
+        if (!PL_curcop->cop_hints_hash)
+            return FALSE;
+        ptr = cop_hints_fetch_pvs(PL_curcop, "re_linear", 0);
+        return cBOOL(ptr && SvTRUE(ptr));
+    }
+}
+
+#define LINEAR_IS_LOCALE(op)                                            \
+    (   (op) == EXACTL || (op) == EXACTFL || (op) == EXACTFLU8          \
+     || (op) == ANYOFL || (op) == ANYOFPOSIXL                           \
+     || (op) == POSIXL || (op) == NPOSIXL                               \
+     || (op) == BOUNDL || (op) == NBOUNDL)
+
+/* What a case-insensitive EXACTish node needs of the target string to be
+ * matched correctly by comparing ASCII chars; see reg_linear_prog */
+#define LINEAR_FOLD_NEED(op)                                            \
+    (  ((op) == EXACTFAA || (op) == EXACTFAA_NO_TRIE) ? LINEAR_FOLD_ANY \
+     : ((op) == EXACTF) ? LINEAR_FOLD_NATIVE                            \
+     : LINEAR_FOLD_ASCII)
+
+/* The most states the program may have given how much each thread of the
+ * matcher has to remember, so that its thread lists stay of modest size */
+#define LINEAR_MAX_WORDS (1 << 18)
+
+/*
+ * S_linear_compile - translate the final program of a pattern into one for
+ * the linear-time matcher (see reg_linear_prog in regcomp.h), and store it
+ * in a 'V' data slot.
+ *
+ * This is only possible when the pattern uses nothing which needs
+ * backtracking to find out whether it matches, like backreferences or
+ * lookaround, and when a quantified subpattern can't match the empty
+ * string.  Otherwise no program is stored, unless 'required' is set, by
+ * "use re 'linear'", when the pattern is an error.  Nor is one stored for a
+ * pattern without any quantifier or alternation, which never backtracks
+ * much anyway.
+ *
+ * The regnodes are translated one at a time from a work list, each
+ * becoming one or more instructions whose successors are filled in once
+ * the regnodes they lead to have been translated.  The instruction each
+ * regnode became is remembered in 'memo', so that the tails of the
+ * branches of an alternation all lead to the same instructions.
+ */
+STATIC void
+S_linear_compile(pTHX_ RExC_state_t *pRExC_state, const bool required)
+{
+    struct linear_todo {
+        U32 inst;           /* the instruction which leads to 'node' */
+        bool alt;           /* ... by its 'alt' field, rather than 'next' */
+        U16 loop;           /* the loop 'node' is in, plus 1 */
+        regnode *node;
+    } *todo;
+    regnode * const program = RExC_rxi->program;
+    reg_linear_inst *inst;
+    reg_linear_loop *loops;
+    U32 *heads;             /* the LOOP instruction of each loop */
+    U32 *memo;              /* the instruction each regnode became, plus 1 */
+    U32 ninst = 0;
+    U32 maxinst = 64;
+    U32 nloops = 0;
+    U32 maxloops = 8;
+    Size_t ntodo = 0;
+    Size_t maxtodo = 16;
+    UV nstates = 0;
+    U8 fold = LINEAR_FOLD_ANY;
+    bool branches = FALSE;
+    const char *why = NULL;
+    U32 i;
+    DECLARE_AND_GET_RE_DEBUG_FLAGS;
+
+    PERL_ARGS_ASSERT_LINEAR_COMPILE;
+
+#define LINEAR_NEW(o, a, lp)                                            \
+    STMT_START {                                                        \
+        if (ninst >= maxinst) {                                         \
+            maxinst *= 2;                                               \
+            Renew(inst, maxinst, reg_linear_inst);                      \
+        }                                                               \
+        Zero(inst + ninst, 1, reg_linear_inst);                         \
+        inst[ninst].op = (o);                                           \
+        inst[ninst].arg = (a);                                          \
+        inst[ninst].loop = (lp);                                        \
+        ninst++;                                                        \
+    } STMT_END
+
+#define LINEAR_TODO(i, a, n, lp)                                        \
+    STMT_START {                                                        \
+        if (ntodo >= maxtodo) {                                         \
+            maxtodo *= 2;                                               \
+            Renew(todo, maxtodo, struct linear_todo);                   \
+        }                                                               \
+        todo[ntodo].inst = (i);                                         \
+        todo[ntodo].alt = (a);                                          \
+        todo[ntodo].node = (n);                                         \
+        todo[ntodo].loop = (lp);                                        \
+        ntodo++;                                                        \
+    } STMT_END
+
+#define LINEAR_POINT(i, a, to)                                          \
+    STMT_START {                                                        \
+        if (a)                                                          \
+            inst[i].alt = (to);                                         \
+        else                                                            \
+            inst[i].next = (to);                                        \
+    } STMT_END
+
+    if (RExC_contains_locale)
+        why = "locale rules";
+    else if (RExC_rx->intflags & PREGf_GPOS_SEEN)
+        why = "\\G";
+
+    Newx(inst, maxinst, reg_linear_inst);
+    Newx(loops, maxloops, reg_linear_loop);
+    Newx(heads, maxloops, U32);
+    Newxz(memo, RExC_size + 1, U32);
+    Newx(todo, maxtodo, struct linear_todo);
+
+    /* the program starts with a JUMP to the first regnode */
+    LINEAR_NEW(LINEAR_JUMP, 0, 0);
+    LINEAR_TODO(0, FALSE, program + 1, 0);
+
+    while (ntodo && ! why) {
+        const struct linear_todo t = todo[--ntodo];
+        regnode *node = t.node;
+        const U16 loop = t.loop;
+        U8 minmod = 0;
+        U32 entry;
+
+        /* Skip the regnodes which only lead on to the next one */
+        while (node && (   REGNODE_TYPE(OP(node)) == NOTHING
+                        || OP(node) == LONGJMP
+                        || OP(node) == MINMOD))
+        {
+            if (OP(node) == MINMOD)
+                minmod = LINEAR_MINMOD;
+            node = regnext(node);
+        }
+        if (! node) {
+            why = "unsupported construct";
+            break;
+        }
+        if (ninst > PERL_RE_LINEAR_MAX_STATES) {
+            why = "too many states";
+            break;
+        }
+
+        if (memo[node - program]) {
+            entry = memo[node - program] - 1;
+            if (inst[entry].loop != loop)
+                why = "unsupported construct";
+            LINEAR_POINT(t.inst, t.alt, entry);
+            continue;
+        }
+
+        entry = ninst;
+        switch (OP(node)) {
+          case END:
+            LINEAR_NEW(LINEAR_MATCH, 0, loop);
+            break;
+
+          case OPEN:
+          case CLOSE:
+            LINEAR_NEW(OP(node) == OPEN ? LINEAR_OPEN : LINEAR_CLOSE,
+                       PARNO(node), loop);
+            LINEAR_TODO(entry, FALSE, regnext(node), loop);
+            break;
+
+          case BOUND:
+          case BOUNDU:
+          case BOUNDA:
+          case NBOUND:
+          case NBOUNDU:
+          case NBOUNDA:
+            if (FLAGS(node) != TRADITIONAL_BOUND) {
+                why = "\\b{...}";
+                break;
+            }
+            /* FALLTHROUGH */
+          case SBOL:
+          case MBOL:
+          case SEOL:
+          case MEOL:
+          case EOS:
+            LINEAR_NEW(LINEAR_ASSERT, node - program, loop);
+            LINEAR_TODO(entry, FALSE, regnext(node), loop);
+            break;
+
+          case BRANCH:
+          case BRANCHJ:
+          {
+            /* A SPLIT for each branch but the last, whose 'alt' leads to
+             * the next branch, unsetting on the way the capture groups in
+             * the one which failed, as BRANCH_next_fail does */
+            regnode *b = node;
+            U32 from = entry;
+            bool from_alt = FALSE;
+
+            branches = TRUE;
+            LINEAR_NEW(LINEAR_JUMP, 0, loop);
+            for (;;) {
+                regnode * const nb = regnext(b);
+                regnode * const body = REGNODE_AFTER_opcode(b, OP(b));
+                U32 split;
+                U16 before;
+                U16 after;
+
+                if (! nb || (OP(nb) != BRANCH && OP(nb) != BRANCHJ)) {
+                    LINEAR_TODO(from, from_alt, body, loop);
+                    break;
+                }
+                split = ninst;
+                LINEAR_NEW(LINEAR_SPLIT, 0, loop);
+                LINEAR_POINT(from, from_alt, split);
+                LINEAR_TODO(split, FALSE, body, loop);
+                if (OP(b) == BRANCH) {
+                    before = ARG1a(b);
+                    after = ARG1b(b);
+                }
+                else {
+                    before = ARG2a(b);
+                    after = ARG2b(b);
+                }
+                if (after > before) {
+                    from = ninst;
+                    from_alt = FALSE;
+                    LINEAR_NEW(LINEAR_CLEAR, before + 1, loop);
+                    inst[from].alt = after;
+                    inst[split].alt = from;
+                }
+                else {
+                    from = split;
+                    from_alt = TRUE;
+                }
+                b = nb;
+            }
+            break;
+          }
+
+          case TRIE:
+          case TRIEC:
+          {
+            /* Like an alternation of the words in the trie, each becoming
+             * a sequence of CHAR or CHARF instructions. The chars of each
+             * word are found by walking up the trie from its accept state,
+             * which needs the parent of each state, and the charid which
+             * leads to it. */
+            const U32 slot = ARG1u(node);
+            const reg_trie_data * const trie
+                            = (reg_trie_data *) RExC_rxi->data->data[slot];
+            HV * const widecharmap
+                            = MUTABLE_HV(RExC_rxi->data->data[slot + 1]);
+            const U8 type = FLAGS(node);
+            regnode * const tail = node + NEXT_OFF(node);
+            U32 from = entry;
+            bool from_alt = FALSE;
+            U16 before = trie->before_paren;
+            U16 after = trie->after_paren;
+            U32 *parent;
+            U16 *edge;
+            UV *cps;
+            U8 op = LINEAR_CHARF;
+            U32 w;
+
+            if (type == EXACT)
+                op = LINEAR_CHAR;
+            else if (type == EXACTFAA)
+                ;
+            else if (   type == EXACTF || type == EXACTFU
+                     || type == EXACTFUP || type == EXACTFU_REQ8)
+            {
+                /* These are folded by Unicode rules at run time */
+                fold = MAX(fold, LINEAR_FOLD_ASCII);
+            }
+            else {
+                why = LINEAR_IS_LOCALE(type)
+                      ? "locale rules"
+                      : "unsupported construct";
+                break;
+            }
+
+            branches = TRUE;
+            Newxz(parent, trie->statecount, U32);
+            Newxz(edge, trie->statecount, U16);
+            Newx(cps, trie->uniquecharcount + 1, UV);
+            for (i = 0; i <= trie->uniquecharcount; i++)
+                cps[i] = UV_MAX;
+            for (i = 0; i < 256; i++) {
+                if (trie->charmap[i])
+                    cps[trie->charmap[i]] = i;
+            }
+            if (widecharmap) {
+                HE *he;
+                (void) hv_iterinit(widecharmap);
+                while ((he = hv_iternext(widecharmap))) {
+                    I32 klen;
+                    const char * const key = hv_iterkey(he, &klen);
+                    const UV charid = SvUV(HeVAL(he));
+                    if (klen == sizeof(UV)
+                        && charid <= trie->uniquecharcount)
+                    {
+                        Copy(key, cps + charid, 1, UV);
+                    }
+                }
+            }
+            for (i = 1; i < trie->statecount; i++) {
+                const U32 base = trie->states[i].trans.base;
+                U32 ofs;
+
+                if (! base)
+                    continue;
+                for (ofs = 0; ofs < trie->uniquecharcount; ofs++) {
+                    const U32 idx = base + ofs;
+                    if (   idx >= trie->uniquecharcount
+                        && idx - trie->uniquecharcount < trie->lasttrans
+                        && trie->trans[idx - trie->uniquecharcount].check == i)
+                    {
+                        const U32 child
+                                = trie->trans[idx - trie->uniquecharcount].next;
+                        if (child < trie->statecount) {
+                            parent[child] = i;
+                            edge[child] = (U16) (ofs + 1);
+                        }
+                    }
+                }
+            }
+
+            LINEAR_NEW(LINEAR_JUMP, 0, loop);
+            for (w = 1; w <= trie->wordcount && ! why; w++) {
+                regnode * const next = (trie->jump && trie->jump[w])
+                                       ? node + trie->jump[w]
+                                       : tail;
+                U32 len = 0;
+                U32 first;
+                U32 st;
+
+                for (st = trie->wordinfo[w].accept;
+                     st != trie->startstate;
+                     st = parent[st])
+                {
+                    if (! parent[st] || ++len >= trie->statecount) {
+                        why = "unsupported construct";
+                        break;
+                    }
+                }
+                if (why)
+                    break;
+
+                if (w < trie->wordcount) {
+                    const U32 split = ninst;
+                    LINEAR_NEW(LINEAR_SPLIT, 0, loop);
+                    LINEAR_POINT(from, from_alt, split);
+                    from = split;
+                    from_alt = FALSE;
+                }
+
+                /* the chars of the word, filled in from its end */
+                first = ninst;
+                for (i = 0; i < len; i++) {
+                    LINEAR_NEW(op, 0, loop);
+                    inst[ninst - 1].next = ninst;
+                }
+                for (st = trie->wordinfo[w].accept, i = len;
+                     st != trie->startstate;
+                     st = parent[st])
+                {
+                    const UV cp = cps[edge[st]];
+                    if (op == LINEAR_CHARF ? ! isASCII(cp) : cp > U32_MAX) {
+                        why = op == LINEAR_CHARF
+                              ? "case-insensitive non-ASCII characters"
+                              : "unsupported construct";
+                        break;
+                    }
+                    inst[first + --i].arg = (U32) (op == LINEAR_CHARF
+                                                   ? toFOLD(cp)
+                                                   : cp);
+                }
+                if (len) {
+                    LINEAR_POINT(from, from_alt, first);
+                    LINEAR_TODO(first + len - 1, FALSE, next, loop);
+                }
+                else
+                    LINEAR_TODO(from, from_alt, next, loop);
+
+                if (w < trie->wordcount) {
+                    /* on to the next word, unsetting the capture groups in
+                     * the branch that failed, as TRIE_next_fail does */
+                    if (trie->jump && trie->jump[w]) {
+                        before = trie->j_before_paren[w];
+                        after = trie->j_after_paren[w];
+                    }
+                    if (trie->jump && after > before) {
+                        const U32 clear = ninst;
+                        LINEAR_NEW(LINEAR_CLEAR, before + 1, loop);
+                        inst[clear].alt = after;
+                        inst[from].alt = clear;
+                        from = clear;
+                        from_alt = FALSE;
+                    }
+                    else
+                        from_alt = TRUE;
+                }
+            }
+            Safefree(parent);
+            Safefree(edge);
+            Safefree(cps);
+            break;
+          }
+
+          case STAR:
+          case PLUS:
+          case CURLY:
+          case CURLYN:
+          case CURLYM:
+          case CURLYX:
+          {
+            /* A LOOP, the body, and a REPEAT which loops back to the body
+             * or leaves by an EXIT, depending on the count of iterations
+             * kept in the loop's counter.  The body of CURLYM and CURLYX
+             * ends with the SUCCEED or WHILEM regnode, which becomes the
+             * REPEAT. */
+            regnode *next = regnext(node);
+            regnode *body;
+            regnode *end = NULL;
+            U8 op = LINEAR_NODE;
+            U32 arg = 0;
+            I32 min = 0;
+            I32 max = REG_INFTY;
+            U16 paren = 0;
+            U32 cap;
+            U32 l;
+            U32 start;
+            U32 repeat;
+            U32 exit;
+
+            switch (OP(node)) {
+              case STAR:
+                body = REGNODE_AFTER_type(node, tregnode_STAR);
+                break;
+              case PLUS:
+                min = 1;
+                body = REGNODE_AFTER_type(node, tregnode_PLUS);
+                break;
+              case CURLY:
+                min = ARG1i(node);
+                max = ARG2i(node);
+                body = REGNODE_AFTER_type(node, tregnode_CURLY);
+                break;
+              case CURLYN:
+                min = ARG1i(node);
+                max = ARG2i(node);
+                paren = FLAGS(node);
+                body = regnext(REGNODE_AFTER_type(node, tregnode_CURLYN));
+                break;
+              case CURLYM:
+                min = ARG1i(node);
+                max = ARG2i(node);
+                paren = FLAGS(node);
+                body = REGNODE_AFTER_type(node, tregnode_CURLYM);
+                for (end = body; end && OP(end) != SUCCEED; end = regnext(end))
+                    ;
+                if (paren)
+                    body += NEXT_OFF(body);   /* skip the former OPEN */
+                break;
+              default: /* CURLYX */
+                min = ARG1i(node);
+                max = ARG2i(node);
+                body = REGNODE_AFTER(node);
+                if (OP(REGNODE_BEFORE(next)) == NOTHING)   /* LONGJMP */
+                    next += ARG1u(next);
+                end = REGNODE_BEFORE(next);
+                if (OP(end) != WHILEM)
+                    end = NULL;
+                break;
+            }
+
+            if (OP(node) == CURLYM || OP(node) == CURLYX) {
+                if (! end) {
+                    why = "unsupported construct";
+                    break;
+                }
+            }
+            else if (LINEAR_IS_LOCALE(OP(body))) {
+                why = "locale rules";
+                break;
+            }
+            else if (REGNODE_TYPE(OP(body)) == EXACT) {
+                /* a single char, which is matched like any other */
+                const U8 *s = (U8 *) STRING(body);
+                STRLEN len = 1;
+                const UV cp = (UTF && STR_LEN(body))
+                              ? valid_utf8_to_uvchr(s, &len)
+                              : *s;
+
+                if (len != STR_LEN(body) || cp > U32_MAX) {
+                    why = "unsupported construct";
+                    break;
+                }
+                if (isEXACTFish(OP(body))) {
+                    if (! isASCII(cp)) {
+                        why = "case-insensitive non-ASCII characters";
+                        break;
+                    }
+                    fold = MAX(fold, LINEAR_FOLD_NEED(OP(body)));
+                    op = LINEAR_CHARF;
+                    arg = toFOLD(cp);
+                }
+                else {
+                    op = LINEAR_CHAR;
+                    arg = (U32) cp;
+                }
+            }
+            else if (REGNODE_SIMPLE(OP(body)))
+                arg = body - program;
+            else {
+                why = "unsupported construct";
+                break;
+            }
+            if (nloops >= U16_MAX - 1) {
+                why = "too many states";
+                break;
+            }
+
+            /* The counter only needs to count up to the maximum, or if
+             * there's none, the minimum, and for a capture group set by
+             * the loop, whether there has been an iteration at all */
+            cap = (max != REG_INFTY) ? (U32) max : (U32) MAX(min, paren ? 1 : 0);
+            if (cap >= PERL_RE_LINEAR_MAX_STATES) {
+                why = "too many states";
+                break;
+            }
+
+            if (nloops >= maxloops) {
+                maxloops *= 2;
+                Renew(loops, maxloops, reg_linear_loop);
+                Renew(heads, maxloops, U32);
+            }
+            l = nloops++;
+            loops[l].min = min;
+            loops[l].max = max;
+            loops[l].radix = cap + 1;
+            loops[l].parent = loop;
+            loops[l].paren = paren;
+            heads[l] = entry;
+
+            LINEAR_NEW(LINEAR_LOOP, l, loop);
+            inst[entry].flags = minmod;
+            start = ninst;
+            if (paren)
+                LINEAR_NEW(LINEAR_OPEN, paren, l + 1);
+            if (! end) {
+                LINEAR_NEW(op, arg, l + 1);
+                inst[ninst - 1].next = ninst;
+            }
+            else if (paren)
+                LINEAR_TODO(start, FALSE, body, l + 1);
+            else {
+                LINEAR_TODO(entry, FALSE, body, l + 1);
+                LINEAR_TODO(ninst, FALSE, body, l + 1);   /* the REPEAT */
+            }
+            if (paren && ! end)
+                inst[start].next = start + 1;
+
+            repeat = ninst;
+            LINEAR_NEW(LINEAR_REPEAT, l, l + 1);
+            inst[repeat].flags = minmod;
+            exit = ninst;
+            LINEAR_NEW(LINEAR_EXIT, l, l + 1);
+            if (end)
+                memo[end - program] = repeat + 1;
+            if (! end || paren) {
+                inst[entry].next = start;
+                inst[repeat].next = start;
+            }
+            inst[entry].alt = exit;
+            inst[repeat].alt = exit;
+            LINEAR_TODO(exit, FALSE, next, loop);
+            break;
+          }
+
+          case REF:    case REFF:    case REFFL:  case REFFU:  case REFFA:
+          case REFN:   case REFFN:   case REFFLN: case REFFUN: case REFFAN:
+            why = "backreferences";
+            break;
+          case IFMATCH:
+          case UNLESSM:
+            why = "lookaround assertions";
+            break;
+          case SUSPEND:
+            why = "atomic subpatterns";
+            break;
+          case IFTHEN:
+          case LOGICAL:
+          case GROUPP:
+          case GROUPPN:
+          case INSUBP:
+          case DEFINEP:
+            why = "conditionals";
+            break;
+          case EVAL:
+            why = "code blocks";
+            break;
+          case GOSUB:
+            why = "recursion";
+            break;
+          case GPOS:
+            why = "\\G";
+            break;
+          case KEEPS:
+            why = "\\K";
+            break;
+          case SROPEN:
+          case SRCLOSE:
+            why = "script runs";
+            break;
+          case LNBREAK:
+            why = "\\R";
+            break;
+          case CLUMP:
+            why = "\\X";
+            break;
+
+          default:
+            if (LINEAR_IS_LOCALE(OP(node))) {
+                why = "locale rules";
+            }
+            else if (REGNODE_TYPE(OP(node)) == EXACT) {
+                /* A CHAR or CHARF for each char of the string */
+                const U8 op = OP(node);
+                const bool folded = cBOOL(isEXACTFish(op));
+                const U8 *s = (U8 *) STRING(node);
+                const U8 * const e = s + STR_LEN(node);
+
+                if (folded) {
+                    if (! is_utf8_invariant_string(s, e - s)) {
+                        why = "case-insensitive non-ASCII characters";
+                        break;
+                    }
+                    fold = MAX(fold, LINEAR_FOLD_NEED(op));
+                }
+                if (s == e)
+                    LINEAR_NEW(LINEAR_JUMP, 0, loop);
+                while (s < e) {
+                    STRLEN len = 1;
+                    const UV cp = UTF ? valid_utf8_to_uvchr(s, &len) : *s;
+
+                    if (cp > U32_MAX) {
+                        why = "unsupported construct";
+                        break;
+                    }
+                    if (folded)
+                        LINEAR_NEW(LINEAR_CHARF, toFOLD(cp), loop);
+                    else
+                        LINEAR_NEW(LINEAR_CHAR, (U32) cp, loop);
+                    inst[ninst - 1].next = ninst;
+                    s += len;
+                }
+                LINEAR_TODO(ninst - 1, FALSE, regnext(node), loop);
+            }
+            else if (REGNODE_SIMPLE(OP(node))) {
+                LINEAR_NEW(LINEAR_NODE, node - program, loop);
+                LINEAR_TODO(entry, FALSE, regnext(node), loop);
+            }
+            else if (   REGNODE_TYPE(OP(node)) == VERB
+                     || REGNODE_TYPE(OP(node)) == ENDLIKE)
+            {
+                why = "backtracking control verbs";
+            }
+            else
+                why = "unsupported construct";
+            break;
+        }
+
+        memo[node - program] = entry + 1;
+        LINEAR_POINT(t.inst, t.alt, entry);
+    }
+
+    /* The body of a loop mustn't be able to match the empty string, as
+     * that would need the special handling it gets from WHILEM, so look
+     * for a path from the start of each body to its REPEAT which doesn't
+     * consume anything */
+    if (! why && nloops) {
+        U32 *stack;
+        U8 *seen;
+        U32 l;
+
+        Newx(stack, 2 * ninst + 1, U32);
+        Newx(seen, ninst, U8);
+        for (l = 0; l < nloops && ! why; l++) {
+            U32 sp = 0;
+
+            Zero(seen, ninst, U8);
+            stack[sp++] = inst[heads[l]].next;
+            while (sp) {
+                const reg_linear_inst * const in = inst + stack[--sp];
+
+                if (seen[in - inst])
+                    continue;
+                seen[in - inst] = 1;
+                switch (in->op) {
+                  case LINEAR_REPEAT:
+                    if (in->arg == l)
+                        why = "a quantified subpattern which can match the empty string";
+                    break;
+                  case LINEAR_LOOP:
+                    if (loops[in->arg].min == 0)
+                        stack[sp++] = in->alt;
+                    break;
+                  case LINEAR_SPLIT:
+                    stack[sp++] = in->alt;
+                    /* FALLTHROUGH */
+                  case LINEAR_JUMP:
+                  case LINEAR_ASSERT:
+                  case LINEAR_OPEN:
+                  case LINEAR_CLOSE:
+                  case LINEAR_CLEAR:
+                  case LINEAR_EXIT:
+                    stack[sp++] = in->next;
+                    break;
+                  default:
+                    break;
+                }
+            }
+        }
+        Safefree(stack);
+        Safefree(seen);
+    }
+
+    /* Number the states: each instruction has one for every combination
+     * of the counters of the loops it's in */
+    if (! why) {
+        const UV width = 3 + nloops + 3 * (UV) (RExC_total_parens - 1);
+        UV *span;
+
+        Newx(span, nloops + 1, UV);
+        span[0] = 1;
+        for (i = 0; i < nloops; i++) {
+            /* a loop's parent comes before it */
+            span[i + 1] = span[loops[i].parent] * loops[i].radix;
+            if (span[i + 1] > PERL_RE_LINEAR_MAX_STATES)
+                span[i + 1] = PERL_RE_LINEAR_MAX_STATES + 1;
+        }
+        for (i = 0; i < ninst && ! why; i++) {
+            inst[i].state = (U32) nstates;
+            nstates += span[inst[i].loop];
+            if (   nstates > PERL_RE_LINEAR_MAX_STATES
+                || nstates * width > LINEAR_MAX_WORDS)
+            {
+                why = "too many states";
+            }
+        }
+        Safefree(span);
+    }
+
+    if (! why && (nloops || branches || required)) {
+        reg_linear_prog * const lp = (reg_linear_prog *)
+            PerlMemShared_malloc(  sizeof(reg_linear_prog)
+                                 + (ninst - 1) * sizeof(reg_linear_inst)
+                                 + nloops * sizeof(reg_linear_loop));
+        U32 n;
+
+        lp->refcount = 1;
+        lp->ninst = ninst;
+        lp->nloops = nloops;
+        lp->nstates = (U32) nstates;
+        lp->fold = fold;
+        Copy(inst, lp->inst, ninst, reg_linear_inst);
+        lp->loops = (reg_linear_loop *) (lp->inst + ninst);
+        Copy(loops, lp->loops, nloops, reg_linear_loop);
+
+        n = reg_add_data(pRExC_state, STR_WITH_LEN("V"));
+        RExC_rxi->data->data[n] = (void *) lp;
+        RExC_rxi->linear_idx = n;
+        RExC_rx->intflags |= PREGf_LINEAR_OK;
+        if (required)
+            RExC_rx->intflags |= PREGf_LINEAR;
+        DEBUG_OPTIMISE_r(Perl_re_printf( aTHX_
+            "Linear-time program: %" UVuf " instructions, %" UVuf " states\n",
+            (UV) ninst, nstates));
+    }
+
+    Safefree(inst);
+    Safefree(loops);
+    Safefree(heads);
+    Safefree(memo);
+    Safefree(todo);
+
+#undef LINEAR_NEW
+#undef LINEAR_TODO
+#undef LINEAR_POINT
+
+    if (why) {
+        DEBUG_OPTIMISE_r(Perl_re_printf( aTHX_
+            "No linear-time program: %s\n", why));
+        if (required)
+            FAIL2("Pattern cannot be matched in linear time (%s)", why);
+    }
+}
+
+/* If which bytes of a non-UTF-8 target the start class matches can be given
+ * as a few ranges, or as the bytes outside a few ranges, store them in
+ * RExC_rxi->stclass_ranges, for find_byclass() to use.  This mirrors what
+ * find_byclass() and reginclass() would do with each byte. */
+
+STATIC void
+S_set_stclass_ranges(pTHX_ RExC_state_t *pRExC_state)
+{
+    const regnode * const c = RExC_rxi->regstclass;
+    reg_stclass_ranges * const r = &RExC_rxi->stclass_ranges;
+    bool in[256];
+    bool utf8_ok = FALSE;
+    bool variants_in = FALSE;   /* what UTF-8 variant bytes must be for
+                                   utf8_ok */
+    unsigned int runs[2] = { 0, 0 };
+    unsigned int b;
+    bool negated;
+    DECLARE_AND_GET_RE_DEBUG_FLAGS;
+
+    PERL_ARGS_ASSERT_SET_STCLASS_RANGES;
+
+    r->count = 0;
+    if (! c) {
+        return;
+    }
+
+    switch (OP(c)) {
+      case ANYOF:
+      case ANYOFD:
+      {
+        const U8 flags = ANYOF_FLAGS(c);
+
+        if (   (flags & ANYOF_LOCALE_FLAGS)
+            || ((flags & ANYOF_HAS_EXTRA_RUNTIME_MATCHES) && OP(c) != ANYOFD))
+        {
+            return;
+        }
+
+        for (b = 0; b < 256; b++) {
+            in[b] = cBOOL(flags & ANYOF_INVERT)
+                  ^ (   ANYOF_BITMAP_TEST(c, b)
+                     || (   OP(c) == ANYOFD
+                         && (flags & ANYOFD_NON_UTF8_MATCHES_ALL_NON_ASCII__shared)
+                         && ! isASCII(b)));
+        }
+
+        /* With nothing outside the bitmap, a class only matching invariants
+         * matches the same bytes in a UTF-8 target */
+        utf8_ok = ! flags && ANYOF_MATCHES_NONE_OUTSIDE_BITMAP(c);
+        break;
+      }
+
+      case POSIXA:
+        utf8_ok = TRUE;
+        /* FALLTHROUGH */
+      case POSIXD:
+        for (b = 0; b < 256; b++) {
+            in[b] = generic_isCC_A_(b, FLAGS(c));
+        }
+        break;
+
+      case NPOSIXA:
+        /* In a UTF-8 target, this matches all the variant characters, whose
+         * start bytes are all in the complement */
+        utf8_ok = TRUE;
+        variants_in = TRUE;
+        /* FALLTHROUGH */
+      case NPOSIXD:
+        for (b = 0; b < 256; b++) {
+            in[b] = ! generic_isCC_A_(b, FLAGS(c));
+        }
+        break;
+
+      case POSIXU:
+      case NPOSIXU:
+        for (b = 0; b < 256; b++) {
+            in[b] = cBOOL(OP(c) == NPOSIXU) ^ generic_isCC_(b, FLAGS(c));
+        }
+        break;
+
+      default:
+        return;
+    }
+
+#ifdef EBCDIC
+    utf8_ok = FALSE;
+#endif
+
+    for (b = 0; b < 256; b++) {
+        if (b == 0 || in[b] != in[b-1]) {
+            runs[in[b]]++;
+        }
+        if (utf8_ok && ! UVCHR_IS_INVARIANT(b) && in[b] != variants_in) {
+            utf8_ok = FALSE;
+        }
+    }
+
+    negated = runs[0] < runs[1];
+    if (runs[! negated] == 0 || runs[! negated] > REG_STCLASS_MAX_RANGES) {
+        return;
+    }
+
+    for (b = 0; b < 256; b++) {
+        if (in[b] != negated && (b == 0 || in[b-1] == negated)) {
+            r->lo[r->count] = (U8) b;
+            r->count++;
+        }
+        if (in[b] != negated) {
+            r->span[r->count - 1] = (U8) (b - r->lo[r->count - 1]);
+        }
+    }
+    r->negated = negated;
+    r->utf8_ok = utf8_ok;
+
+    DEBUG_OPTIMISE_r(Perl_re_printf( aTHX_
+        "Start class as byte ranges: %u%s%s\n", (unsigned) r->count,
+        negated ? ", negated" : "", utf8_ok ? ", also for UTF-8" : ""));
+}
+
+/*
+ * S_straight_compile - translate the final program of a pattern into one
+ * for the straight-line matcher (see reg_straight_prog in regcomp.h), and
+ * store it in a 'P' data slot.
+ *
+ * This is only possible when the regnodes follow each other without any
+ * alternation, and each is one that the matcher knows; a quantifier must
+ * be a STAR, PLUS or CURLY, whose operand is always a single char.
+ */
+STATIC void
+S_straight_compile(pTHX_ RExC_state_t *pRExC_state)
+{
+    regnode * const program = RExC_rxi->program;
+    regnode *node = program + 1;
+    reg_straight_inst *inst;
+    U32 ninst = 0;
+    U32 maxinst = 16;
+    U32 nrepeats = 0;
+    U8 minmod = 0;
+    bool invariant = TRUE;
+    const char *why = NULL;
+    U32 i;
+    DECLARE_AND_GET_RE_DEBUG_FLAGS;
+
+    PERL_ARGS_ASSERT_STRAIGHT_COMPILE;
+
+#define STRAIGHT_NEW(o, n)                                              \
+    STMT_START {                                                        \
+        if (ninst >= maxinst) {                                         \
+            maxinst *= 2;                                               \
+            Renew(inst, maxinst, reg_straight_inst);                    \
+        }                                                               \
+        Zero(inst + ninst, 1, reg_straight_inst);                       \
+        inst[ninst].op = (o);                                           \
+        inst[ninst].node = (n) - program;                               \
+        ninst++;                                                        \
+    } STMT_END
+
+    Newx(inst, maxinst, reg_straight_inst);
+
+    while (! why) {
+        if (! node) {
+            why = "unsupported construct";
+            break;
+        }
+
+        /* Skip the regnodes which only lead on to the next one */
+        if (   REGNODE_TYPE(OP(node)) == NOTHING
+            || OP(node) == LONGJMP
+            || OP(node) == MINMOD)
+        {
+            if (OP(node) == MINMOD)
+                minmod = STRAIGHT_MINMOD;
+            node = regnext(node);
+            continue;
+        }
+
+        switch (OP(node)) {
+          case END:
+            STRAIGHT_NEW(STRAIGHT_MATCH, node);
+            break;
+
+          case OPEN:
+          case CLOSE:
+            STRAIGHT_NEW(OP(node) == OPEN ? STRAIGHT_OPEN : STRAIGHT_CLOSE,
+                         node);
+            inst[ninst - 1].paren = (U16) PARNO(node);
+            break;
+
+          case BOUND:
+          case BOUNDU:
+          case BOUNDA:
+          case NBOUND:
+          case NBOUNDU:
+          case NBOUNDA:
+            if (FLAGS(node) != TRADITIONAL_BOUND) {
+                why = "\\b{...}";
+                break;
+            }
+            /* FALLTHROUGH */
+          case SBOL:
+          case MBOL:
+          case SEOL:
+          case MEOL:
+          case EOS:
+            STRAIGHT_NEW(STRAIGHT_ASSERT, node);
+            break;
+
+          case EXACT:
+          case LEXACT:
+          {
+            const U8 * const str = (U8 *) (OP(node) == EXACT
+                                           ? STRINGs(node)
+                                           : STRINGl(node));
+            const STRLEN len = OP(node) == EXACT
+                               ? STR_LENs(node)
+                               : STR_LENl(node);
+
+            if (! is_utf8_invariant_string(str, len))
+                invariant = FALSE;
+            STRAIGHT_NEW(STRAIGHT_EXACT, node);
+            break;
+          }
+
+          case STAR:
+          case PLUS:
+          case CURLY:
+            if (++nrepeats > STRAIGHT_MAX_REPEATS) {
+                why = "too many quantifiers";
+                break;
+            }
+            STRAIGHT_NEW(STRAIGHT_REPEAT,
+                         REGNODE_AFTER_opcode(node, OP(node)));
+            inst[ninst - 1].flags = minmod;
+            inst[ninst - 1].min = (OP(node) == CURLY) ? ARG1i(node)
+                                : (OP(node) == PLUS)  ? 1
+                                :                       0;
+            inst[ninst - 1].max = (OP(node) == CURLY) ? ARG2i(node)
+                                                      : REG_INFTY;
+            minmod = 0;
+            break;
+
+          default:
+            if (REGNODE_SIMPLE(OP(node)))
+                STRAIGHT_NEW(STRAIGHT_ONE, node);
+            else
+                why = "unsupported construct";
+            break;
+        }
+
+        if (why || inst[ninst - 1].op == STRAIGHT_MATCH)
+            break;
+        node = regnext(node);
+    }
+
+    /* A quantifier can stop short of wherever the literal after it
+     * couldn't begin, unless its first byte might be in the other
+     * encoding in the target. */
+    for (i = 0; ! why && i < ninst; i++) {
+        U32 j = i + 1;
+
+        if (inst[i].op != STRAIGHT_REPEAT)
+            continue;
+        while (   inst[j].op == STRAIGHT_OPEN
+               || inst[j].op == STRAIGHT_CLOSE)
+        {
+            j++;
+        }
+        if (inst[j].op == STRAIGHT_EXACT) {
+            const regnode * const text = program + inst[j].node;
+            const U8 first = (U8) (OP(text) == EXACT ? *STRINGs(text)
+                                                     : *STRINGl(text));
+            if (UTF8_IS_INVARIANT(first)) {
+                inst[i].flags |= STRAIGHT_FIRST;
+                inst[i].first = first;
+            }
+        }
+    }
+
+    if (! why) {
+        reg_straight_prog * const sp = (reg_straight_prog *)
+            PerlMemShared_malloc(  sizeof(reg_straight_prog)
+                                 + (ninst - 1) * sizeof(reg_straight_inst));
+        U32 n;
+
+        sp->refcount = 1;
+        sp->ninst = ninst;
+        sp->invariant = invariant;
+        Copy(inst, sp->inst, ninst, reg_straight_inst);
+
+        n = reg_add_data(pRExC_state, STR_WITH_LEN("P"));
+        RExC_rxi->data->data[n] = (void *) sp;
+        RExC_rxi->straight_idx = n;
+        DEBUG_OPTIMISE_r(Perl_re_printf( aTHX_
+            "Straight-line program: %" UVuf " instructions\n", (UV) ninst));
+    }
+    else {
+        DEBUG_OPTIMISE_r(Perl_re_printf( aTHX_
+            "No straight-line program: %s\n", why));
+    }
+
+    Safefree(inst);
+
+#undef STRAIGHT_NEW
+}
+
 /*
  * Perl_re_op_compile - the perl internal RE engine's function to compile a
  * regular expression into internal code.
@@ -1322,7 +2457,9 @@ S_is_ssc_worth_it(const RExC_state_t * pRExC_state, const regnode_ssc * ssc)
  * case).
  *
  * If the pattern hasn't changed from old_re, then old_re will be
- * returned.
+ * returned.  Otherwise, at run time, an earlier compilation of the same
+ * pattern may be returned from the interpreter's cache of compiled patterns
+ * (see re_cache_fetch()), as a bare regex.
  *
  * eng is the current engine. If that engine has an op_comp method, then
  * handle directly (i.e. we assume that op_comp was us); otherwise, just
@@ -1331,7 +2468,9 @@ S_is_ssc_worth_it(const RExC_state_t * pRExC_state, const regnode_ssc * ssc)
  *
  * If is_bare_re is not null, set it to a boolean indicating whether the
  * arg list reduced (after overloading) to a single bare regex which has
- * been returned (i.e. /$qr/).
+ * been returned (i.e. /$qr/), or the returned regex is in the cache of
+ * compiled patterns; either way the caller must copy it before matching
+ * against it.
  *
  * orig_rx_flags contains RXf_* flags. See perlreapi.pod for more details.
  *
@@ -1388,6 +2527,9 @@ Perl_re_op_compile(pTHX_ SV ** const patternp, int pat_count,
     regex_charset initial_charset = get_regex_charset(orig_rx_flags);
     bool recompile = 0;
     bool runtime_code = 0;
+    bool use_cache = 0;
+    U32 cache_hash = 0;
+    U32 cache_flags = 0;
     scan_data_t data;
     RExC_state_t RExC_state;
     RExC_state_t * const pRExC_state = &RExC_state;
@@ -1572,6 +2714,58 @@ Perl_re_op_compile(pTHX_ SV ** const patternp, int pat_count,
         return old_re;
     }
 
+    /* Otherwise look for the same pattern compiled elsewhere.  Only
+     * patterns whose meaning can't depend on where they are compiled are
+     * cached: not those with code blocks, or under /l, whose compilation
+     * can depend on the locale.  \p{} and \P{} can name user-defined
+     * properties looked up in the current package, and \N{} names
+     * characters using the charnames in scope, so patterns containing those
+     * aren't cached either.  Nor is the empty pattern, which pp_match()
+     * treats specially unless it is a bare regexp, nor are ?? patterns,
+     * whose used flag is kept on their REGEXP under ithreads.  Callers
+     * which don't handle bare regexps (is_bare_re is NULL) don't use the
+     * cache. */
+    if (   is_bare_re
+        && plen
+        && ! IN_PERL_COMPILETIME
+        && ! recompile
+        && ! runtime_code
+        && ! pRExC_state->code_blocks
+        && ! (pm_flags & (PMf_HAS_CV|PMf_WILDCARD|PMf_ONCE))
+        && initial_charset != REGEX_LOCALE_CHARSET
+        && (PL_re_cache ? PL_re_cache->size : PERL_RE_CACHE_SIZE) > 0)
+    {
+        const char *s = exp;
+        const char * const e = exp + plen;
+
+        use_cache = 1;
+        while ((s = (const char *) memchr(s, '\\', e - s)) && ++s < e) {
+            if (   *s == 'p' || *s == 'P'
+                || (*s == 'N' && s + 1 < e && s[1] == '{'))
+            {
+                use_cache = 0;
+                break;
+            }
+            s++;
+        }
+    }
+    if (use_cache) {
+        if (! PL_re_cache)
+            re_cache_resize(PERL_RE_CACHE_SIZE);
+        cache_flags = RE_CACHE_FLAGS(orig_rx_flags, RExC_utf8, pm_flags);
+        PERL_HASH(cache_hash, exp, plen);
+        Rx = re_cache_fetch(eng, exp, plen, cache_hash, cache_flags);
+        if (Rx) {
+            DEBUG_COMPILE_r({
+                RE_PV_QUOTED_DECL(s, RExC_utf8, RExC_mysv, exp, plen, PL_dump_re_max_len);
+                Perl_re_printf( aTHX_  "%sUsing cached compilation of REx%s %s\n",
+                              PL_colors[4], PL_colors[5], s);
+            });
+            *is_bare_re = TRUE;
+            return Rx;
+        }
+    }
+
     /* Allocate the pattern's SV */
     RExC_rx_sv = Rx = (REGEXP*) newSV_type(SVt_REGEXP);
     RExC_rx = ReANY(Rx);
@@ -2257,6 +3451,9 @@ Perl_re_op_compile(pTHX_ SV ** const patternp, int pat_count,
     if (RExC_seen & REG_GPOS_SEEN)
         RExC_rx->intflags |= PREGf_GPOS_SEEN;
 
+    if (RExC_seen & REG_LOOKAHEAD_SEEN)
+        RExC_rx->intflags |= PREGf_LOOKAHEAD_SEEN;
+
     if (RExC_seen & REG_PESSIMIZE_SEEN)
         RExC_rx->intflags |= PREGf_PESSIMIZE_SEEN;
 
@@ -2392,6 +3589,10 @@ Perl_re_op_compile(pTHX_ SV ** const patternp, int pat_count,
         regdump(RExC_rx);
     });
 
+    linear_compile(pRExC_state, linear_hint());
+    set_stclass_ranges(pRExC_state);
+    straight_compile(pRExC_state);
+
     if (RExC_open_parens) {
         Safefree(RExC_open_parens);
         RExC_open_parens = NULL;
@@ -2409,6 +3610,19 @@ Perl_re_op_compile(pTHX_ SV ** const patternp, int pat_count,
         RExC_parno_to_logical = NULL;
     }
 
+    /* Patterns which raised warnings aren't cached, so that they raise
+     * them each time they're compiled, as they always have.  Nor are those
+     * which turned out to need locale rules, or which had to be upgraded
+     * to UTF-8 and so no longer match the string they were looked up by */
+    if (   use_cache
+        && ! RExC_contains_locale
+        && ! RExC_latest_warn_offset
+        && cBOOL(RX_UTF8(Rx)) == cBOOL(cache_flags & RE_CACHE_UTF8))
+    {
+        re_cache_store(Rx, cache_hash, cache_flags);
+        *is_bare_re = TRUE;
+    }
+
 #ifdef USE_ITHREADS
     /* under ithreads the ?pat? PMf_USED flag on the pmop is simulated
      * by setting the regexp SV to readonly-only instead. If the
@@ -4419,6 +5633,9 @@ S_reg(pTHX_ RExC_state_t *pRExC_state, I32 paren, I32 *flagp, U32 depth)
             if (paren == '>' || paren == 't') {
                 node = SUSPEND, flag = 0;
             }
+            else if (! flag) {
+                RExC_seen |= REG_LOOKAHEAD_SEEN;
+            }
 
             reginsert(pRExC_state, node, ret, depth+1);
             FLAGS(REGNODE_p(ret)) = flag;
@@ -5805,6 +7022,9 @@ S_regatom(pTHX_ RExC_state_t *pRExC_state, I32 *flagp, U32 depth)
                 RExC_parse_set(endbrace);
                 REQUIRE_UNI_RULES(flagp, 0);
 
+                /* These may need to see several characters either side */
+                RExC_seen |= REG_LOOKAHEAD_SEEN;
+
                 if (op == BOUND) {
                     op = BOUNDU;
                 }
@@ -13382,6 +14602,149 @@ Perl_reg_temp_copy(pTHX_ REGEXP *dsv, REGEXP *ssv)
 
     return dsv;
 }
+
+/* The cache of compiled run-time patterns.  Entries are looked up by a
+ * linear scan of their hashes, which is cheap next to compiling a pattern
+ * for the sizes the cache is meant to have.  The REGEXPs in the cache are
+ * never matched against directly: re_op_compile() returns them as bare
+ * regexps, like the REGEXP of a qr// object, so that pp_regcomp() gives
+ * each op its own copy made with reg_temp_copy().  That way each op has its
+ * own capture buffers, and nothing done to its copy (tainting it, marking
+ * it as a used ?? pattern) affects the cache.
+ */
+
+#define RE_CACHE_SAME_WARNINGS(a, b)                                    \
+    (   (a) == (b)                                                      \
+     || (   ! specialWARN(a) && ! specialWARN(b)                        \
+         && RCPV_LEN(a) == RCPV_LEN(b) && memEQ(a, b, RCPV_LEN(a))))
+
+/*
+=for apidoc re_cache_fetch
+
+Looks up the pattern C<pat>, of length C<plen>, compiled by C<eng> with the
+C<RE_CACHE_FLAGS> C<flags>, in the interpreter's cache of compiled run-time
+patterns.  C<hash> is the C<PERL_HASH> of the pattern.  Returns a new
+reference to the cached pattern, or NULL if it isn't in the cache.  The
+lexical warnings in effect must be the same as when the pattern was stored.
+
+=cut
+*/
+
+REGEXP *
+Perl_re_cache_fetch(pTHX_ const regexp_engine *eng, const char *pat,
+                          STRLEN plen, U32 hash, U32 flags)
+{
+    re_cache * const cache = PL_re_cache;
+    struct re_cache_entry *ent;
+    struct re_cache_entry *end;
+    char * const warnings = PL_curcop->cop_warnings;
+
+    PERL_ARGS_ASSERT_RE_CACHE_FETCH;
+    assert(cache);
+
+    cache->clock++;
+    for (ent = cache->entries, end = ent + cache->count; ent < end; ent++) {
+        if (   ent->hash == hash
+            && ent->flags == flags
+            && RX_PRELEN(ent->rx) == plen
+            && RX_ENGINE(ent->rx) == eng
+            && memEQ(RX_PRECOMP(ent->rx), pat, plen)
+            && RE_CACHE_SAME_WARNINGS(ent->warnings, warnings))
+        {
+            ent->used = cache->clock;
+            cache->hits++;
+            return ReREFCNT_inc(ent->rx);
+        }
+    }
+
+    cache->misses++;
+    return NULL;
+}
+
+/*
+=for apidoc re_cache_store
+
+Adds the newly compiled C<rx> to the interpreter's cache of compiled
+run-time patterns, with the C<hash> and C<flags> it was looked up with by
+L</re_cache_fetch>, evicting the least recently used entry if the cache
+is full.  The cache takes a new reference to C<rx>.
+
+=cut
+*/
+
+void
+Perl_re_cache_store(pTHX_ REGEXP *rx, U32 hash, U32 flags)
+{
+    re_cache * const cache = PL_re_cache;
+    struct re_cache_entry *ent;
+
+    PERL_ARGS_ASSERT_RE_CACHE_STORE;
+    assert(cache);
+
+    if (cache->size == 0)
+        return;
+
+    if (cache->count < cache->size)
+        ent = cache->entries + cache->count++;
+    else {
+        struct re_cache_entry *e;
+        struct re_cache_entry * const end = cache->entries + cache->count;
+
+        ent = cache->entries;
+        for (e = ent + 1; e < end; e++) {
+            if (e->used < ent->used)
+                ent = e;
+        }
+        SvREFCNT_dec_NN(ent->rx);
+        if (! specialWARN(ent->warnings))
+            rcpv_free(ent->warnings);
+    }
+
+    ent->rx = ReREFCNT_inc(rx);
+    ent->warnings = DUP_WARNINGS(PL_curcop->cop_warnings);
+    ent->hash = hash;
+    ent->flags = flags;
+    ent->used = cache->clock;
+}
+
+/*
+=for apidoc re_cache_resize
+
+Empties the interpreter's cache of compiled run-time patterns, and sets the
+maximum number of patterns it will hold to C<size>.  A size of 0 disables
+the cache.  The hit and miss counts are kept.
+
+=cut
+*/
+
+void
+Perl_re_cache_resize(pTHX_ Size_t size)
+{
+    re_cache *cache = PL_re_cache;
+
+    if (! cache)
+        Newxz(PL_re_cache, 1, re_cache);
+    else {
+        struct re_cache_entry *ent = cache->entries;
+        struct re_cache_entry * const end = ent + cache->count;
+
+        for (; ent < end; ent++) {
+            SvREFCNT_dec_NN(ent->rx);
+            if (! specialWARN(ent->warnings))
+                rcpv_free(ent->warnings);
+        }
+        Safefree(cache->entries);
+    }
+    cache = PL_re_cache;
+
+    cache->size = (U32) MIN(size, U32_MAX);
+    cache->count = 0;
+    cache->clock = 0;
+    cache->entries = NULL;
+    if (cache->size)
+        Newx(cache->entries, cache->size, struct re_cache_entry);
+}
+
 #endif
 
 
@@ -13496,6 +14859,31 @@ Perl_regfree_internal(pTHX_ REGEXP * const rx)
                     }
                 }
                 break;
+            case 'V':
+                {
+                    /* program for the linear-time matcher */
+                    U32 refcount;
+                    reg_linear_prog *lp = (reg_linear_prog*)ri->data->data[n];
+                    OP_REFCNT_LOCK;
+                    refcount = --lp->refcount;
+                    OP_REFCNT_UNLOCK;
+                    if ( !refcount )
+                        PerlMemShared_free(lp);
+                }
+                break;
+            case 'P':
+                {
+                    /* program for the straight-line matcher */
+                    U32 refcount;
+                    reg_straight_prog *sp =
+                                    (reg_straight_prog*)ri->data->data[n];
+                    OP_REFCNT_LOCK;
+                    refcount = --sp->refcount;
+                    OP_REFCNT_UNLOCK;
+                    if ( !refcount )
+                        PerlMemShared_free(sp);
+                }
+                break;
             case '%':
                 /* NO-OP a '%' data contains a null pointer, so that reg_add_data
                  * always returns non-zero, this should only ever happen in the
@@ -13721,6 +15109,21 @@ Perl_regdupe_internal(pTHX_ REGEXP * const rx, CLONE_PARAMS *param)
                 StructCopy(ri->data->data[i], d->data[i], regnode_ssc);
                 reti->regstclass = (regnode*)d->data[i];
                 break;
+            case 'V':
+                /* program for the linear-time matcher; read-only, so it
+                 * can be shared like a trie */
+                OP_REFCNT_LOCK;
+                ((reg_linear_prog*)ri->data->data[i])->refcount++;
+                OP_REFCNT_UNLOCK;
+                d->data[i] = ri->data->data[i];
+                break;
+            case 'P':
+                /* program for the straight-line matcher, likewise */
+                OP_REFCNT_LOCK;
+                ((reg_straight_prog*)ri->data->data[i])->refcount++;
+                OP_REFCNT_UNLOCK;
+                d->data[i] = ri->data->data[i];
+                break;
             case 'T':
                 /* AHO-CORASICK fail table */
                 /* Trie stclasses are readonly and can thus be shared
@@ -13768,6 +15171,10 @@ Perl_regdupe_internal(pTHX_ REGEXP * const rx, CLONE_PARAMS *param)
 
 
     reti->name_list_idx = ri->name_list_idx;
+    reti->linear_idx = ri->linear_idx;
+    reti->straight_idx = ri->straight_idx;
+    StructCopy(&ri->stclass_ranges, &reti->stclass_ranges,
+               reg_stclass_ranges);
 
     SetProgLen(reti, len);
 
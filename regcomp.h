@@ -114,6 +114,21 @@
  * boundary, and reads the offset directly as a short.]
  */
 
+/* The start class, when which bytes of a non-UTF-8 target it matches can be
+ * described by a few ranges.  find_byclass() can then look for the next of
+ * them many bytes at a time (see S_find_next_in_ranges() in regexec.c).
+ * 'count' is 0 when the start class can't be described this way. */
+
+#define REG_STCLASS_MAX_RANGES  8
+
+struct reg_stclass_ranges {
+    U8 count;
+    bool negated;       /* It matches the bytes outside the ranges */
+    bool utf8_ok;       /* The ranges also work for UTF-8 targets */
+    U8 lo[REG_STCLASS_MAX_RANGES];      /* The first byte of each range */
+    U8 span[REG_STCLASS_MAX_RANGES];    /* The last byte minus the first */
+};
+
 /* This is the stuff that used to live in regexp.h that was truly
    private to the engine itself. It now lives here. */
 
@@ -132,6 +147,12 @@ typedef struct regexp_internal {
                                    only valid when RXp_PAREN_NAMES(prog) is true,
                                    0 means "no value" like any other index into the
                                    data array.*/
+        U32 linear_idx;         /* Optional data index of the program for
+                                   the linear-time matcher, 0 if none */
+        U32 straight_idx;       /* Optional data index of the program for
+                                   the straight-line matcher, 0 if none */
+        struct reg_stclass_ranges stclass_ranges; /* regstclass as byte
+                                                     ranges, if it can be */
         regnode program[1];	/* Unwarranted chumminess with compiler. */
 } regexp_internal;
 
@@ -156,7 +177,7 @@ typedef struct regexp_internal {
 #define PREGf_USE_RE_EVAL	0x00000020 /* compiled with "use re 'eval'" */
 /* these used to be extflags, but are now intflags */
 #define PREGf_NOSCAN            0x00000040
-                                /* spare */
+#define PREGf_LOOKAHEAD_SEEN    0x00000080 /* may look past the end of $& */
 #define PREGf_GPOS_SEEN         0x00000100
 #define PREGf_GPOS_FLOAT        0x00000200
 
@@ -165,6 +186,8 @@ typedef struct regexp_internal {
 #define PREGf_ANCH_GPOS         0x00001000
 #define PREGf_RECURSE_SEEN      0x00002000
 #define PREGf_PESSIMIZE_SEEN    0x00004000
+#define PREGf_LINEAR_OK         0x00008000 /* has a linear-time program */
+#define PREGf_LINEAR            0x00010000 /* compiled with "use re 'linear'" */
 
 #define PREGf_ANCH              \
     ( PREGf_ANCH_SBOL | PREGf_ANCH_GPOS | PREGf_ANCH_MBOL )
@@ -1084,7 +1107,7 @@ ARGp_SET_inline(struct regnode *node, SV *ptr) {
 /* add a short form alias to keep the line length police happy */
 #define REG_LB_SEEN                         REG_LOOKBEHIND_SEEN
 #define REG_GPOS_SEEN                       0x00000004
-/* spare */
+#define REG_LOOKAHEAD_SEEN                  0x00000008
 #define REG_RECURSE_SEEN                    0x00000020
 #define REG_TOP_LEVEL_BRANCHES_SEEN         0x00000040
 #define REG_VERBARG_SEEN                    0x00000080
@@ -1147,6 +1170,8 @@ END_EXTERN_C
  *       also used for revcharmap and words under DEBUGGING
  *   T - aho-trie struct
  *   S - sv for named capture lookup
+ *   V - program for the linear-time matcher
+ *   P - program for the straight-line matcher
  * 20010712 mjd@plover.com
  * (Remember to update re_dup() and pregfree() if you add any items.)
  */
@@ -1286,6 +1311,121 @@ struct _reg_ac_data {
 };
 typedef struct _reg_ac_data reg_ac_data;
 
+/* The program run by the linear-time matcher, S_linear_exec() in
+ * regexec.c.  It is translated from the regnode program by
+ * S_linear_compile() in regcomp.c when the pattern uses no feature
+ * which needs backtracking, and is a Thompson NFA whose loops carry
+ * bounded counters, so that each thread is identified by an instruction
+ * and the counters of the loops enclosing it.  Every such combination is
+ * given a state number, of which there are 'nstates' in all; a match
+ * never runs more than that many threads at once.  Execution starts at
+ * inst[0].  Like a trie, it is
+ * read-only once built and is shared between threads. */
+
+#ifndef PERL_RE_LINEAR_MAX_STATES
+#  define PERL_RE_LINEAR_MAX_STATES 4096
+#endif
+
+enum {
+    LINEAR_MATCH,       /* the END of the pattern */
+    LINEAR_CHAR,        /* consume the code point 'arg' */
+    LINEAR_CHARF,       /* consume 'arg', an ASCII char, ignoring case */
+    LINEAR_NODE,        /* consume a char matched by the simple regnode
+                           at offset 'arg' */
+    LINEAR_ASSERT,      /* zero-width assertion regnode at offset 'arg' */
+    LINEAR_JUMP,        /* continue at 'next' */
+    LINEAR_SPLIT,       /* try 'next', then 'alt' */
+    LINEAR_OPEN,        /* note the start of capture group 'arg' */
+    LINEAR_CLOSE,       /* capture group 'arg' ends here */
+    LINEAR_CLEAR,       /* unset capture groups 'arg' to 'alt', as a failed
+                           BRANCH does */
+    LINEAR_LOOP,        /* head of loop 'arg': 'next' is the body, 'alt'
+                           the way out */
+    LINEAR_REPEAT,      /* end of an iteration of loop 'arg' */
+    LINEAR_EXIT         /* leave loop 'arg' */
+};
+
+#define LINEAR_MINMOD   0x01    /* flag on LINEAR_LOOP and LINEAR_REPEAT: a
+                                   non-greedy loop */
+
+/* what the target string must be for the matcher to handle the
+ * case-insensitive parts of a pattern */
+#define LINEAR_FOLD_ANY     0   /* anything */
+#define LINEAR_FOLD_NATIVE  1   /* not UTF-8, or ASCII-only (EXACTF) */
+#define LINEAR_FOLD_ASCII   2   /* ASCII-only */
+
+typedef struct {
+    U8  op;         /* LINEAR_xxx */
+    U8  flags;
+    U16 loop;       /* innermost loop enclosing this instruction, plus 1 */
+    U32 next;
+    U32 alt;
+    U32 arg;
+    U32 state;      /* first state number of this instruction */
+} reg_linear_inst;
+
+typedef struct {
+    I32 min;
+    I32 max;        /* REG_INFTY if unbounded */
+    U32 radix;      /* number of distinct values of the loop's counter */
+    U16 parent;     /* enclosing loop, plus 1 */
+    U16 paren;      /* capture group set by CURLYN or CURLYM, or 0 */
+} reg_linear_loop;
+
+typedef struct {
+    U32 refcount;
+    U32 ninst;
+    U32 nloops;
+    U32 nstates;
+    U8  fold;       /* LINEAR_FOLD_xxx */
+    reg_linear_loop *loops;     /* points into the same allocation */
+    reg_linear_inst inst[1];
+} reg_linear_prog;
+
+/* The program run by the straight-line matcher, S_straight_exec() in
+ * regexec.c, in place of regmatch().  It is translated from the regnode
+ * program by S_straight_compile() in regcomp.c when the pattern is a
+ * plain sequence of literals, single-char nodes, quantifiers of those,
+ * capture groups and simple assertions, with no alternation.  Such a
+ * pattern can only backtrack into its quantifiers, each of which needs
+ * just a counter and a position to be resumed, so the matcher keeps a
+ * small stack of those instead of regmatch()'s states, and never needs
+ * to save or restore the capture groups.  Like the linear-time program,
+ * it is read-only once built and is shared between threads. */
+
+#define STRAIGHT_MAX_REPEATS 32 /* the most quantifiers in a program */
+
+enum {
+    STRAIGHT_MATCH,     /* the END of the pattern */
+    STRAIGHT_EXACT,     /* the literal of the EXACT or LEXACT at 'node' */
+    STRAIGHT_ONE,       /* one char matched by the simple regnode 'node' */
+    STRAIGHT_REPEAT,    /* 'min' to 'max' chars matched by it */
+    STRAIGHT_ASSERT,    /* zero-width assertion regnode at 'node' */
+    STRAIGHT_OPEN,      /* note the start of capture group 'paren' */
+    STRAIGHT_CLOSE      /* capture group 'paren' ends here */
+};
+
+#define STRAIGHT_MINMOD 0x01    /* flag on STRAIGHT_REPEAT: non-greedy */
+#define STRAIGHT_FIRST  0x02    /* flag on STRAIGHT_REPEAT: what follows
+                                   can only match where the byte is 'first' */
+
+typedef struct {
+    U8  op;         /* STRAIGHT_xxx */
+    U8  flags;
+    U8  first;
+    U16 paren;
+    U32 node;       /* offset of the regnode in the program */
+    I32 min;
+    I32 max;        /* REG_INFTY if unbounded */
+} reg_straight_inst;
+
+typedef struct {
+    U32 refcount;
+    U32 ninst;
+    bool invariant; /* its literals are the same in UTF-8 as not */
+    reg_straight_inst inst[1];
+} reg_straight_prog;
+
 /* ANY_BIT doesn't use the structure, so we can borrow it here.
    This is simpler than refactoring all of it as wed end up with
    three different sets... */
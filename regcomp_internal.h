@@ -1181,6 +1181,9 @@ static const scan_data_t zero_scan_data = {
             if (RExC_seen & REG_GPOS_SEEN)                                  \
                 Perl_re_printf( aTHX_ "REG_GPOS_SEEN ");                    \
                                                                             \
+            if (RExC_seen & REG_LOOKAHEAD_SEEN)                             \
+                Perl_re_printf( aTHX_ "REG_LOOKAHEAD_SEEN ");               \
+                                                                            \
             if (RExC_seen & REG_RECURSE_SEEN)                               \
                 Perl_re_printf( aTHX_ "REG_RECURSE_SEEN ");                 \
                                                                             \
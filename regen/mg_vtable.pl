@@ -189,6 +189,8 @@ my %mg =
               desc => 'vec() lvalue' },
      vstring => { char => 'V', value_magic => 1,
                   desc => 'SV was vstring literal' },
+     view => { char => 'W', value_magic => 1,
+               desc => "SV's string is in another SV's buffer" },
      utf8 => { char => 'w', vtable => 'utf8', value_magic => 1,
                desc => 'Cached UTF-8 information' },
      substr => { char => 'x', vtable => 'substr',  value_magic => 1,
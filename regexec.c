@@ -773,6 +773,82 @@ S_find_next_masked(U8 * s, const U8 * send, const U8 byte, const U8 mask)
     return s;
 }
 
+STATIC U8 *
+S_find_next_in_ranges(U8 * s, const U8 * send,
+                      const reg_stclass_ranges * ranges)
+{
+    /* Returns the position of the first byte in the sequence between 's' and
+     * 'send-1' inclusive that is in one of 'ranges' (or in none of them if
+     * they are negated); returns 'send' if none found.  Where available, it
+     * uses SSE2 to test 16 bytes at a time against all the ranges */
+
+    const unsigned int count = ranges->count;
+    const bool negated = ranges->negated;
+    unsigned int i;
+
+    PERL_ARGS_ASSERT_FIND_NEXT_IN_RANGES;
+
+    assert(send >= s);
+    assert(count <= REG_STCLASS_MAX_RANGES);
+
+#ifdef PERL_USE_SSE2
+
+    if (send - s >= 16) {
+        __m128i lo[REG_STCLASS_MAX_RANGES];
+        __m128i span[REG_STCLASS_MAX_RANGES];
+        const __m128i zero = _mm_setzero_si128();
+        const int flip = negated ? 0xFFFF : 0;
+
+        for (i = 0; i < count; i++) {
+            lo[i]   = _mm_set1_epi8((char) ranges->lo[i]);
+            span[i] = _mm_set1_epi8((char) ranges->span[i]);
+        }
+
+        do {
+            const __m128i bytes = _mm_loadu_si128((const __m128i *) s);
+            __m128i in = zero;
+            int hits;
+
+            /* A byte is in a range if subtracting the range's first byte
+             * leaves at most its span, in which case subtracting the span
+             * with unsigned saturation leaves 0 */
+            for (i = 0; i < count; i++) {
+                in = _mm_or_si128(in,
+                        _mm_cmpeq_epi8(zero,
+                                       _mm_subs_epu8(_mm_sub_epi8(bytes, lo[i]),
+                                                     span[i])));
+            }
+
+            hits = _mm_movemask_epi8(in) ^ flip;
+            if (hits) {
+                return s + lsbit_pos32((U32) hits);
+            }
+
+            s += 16;
+        } while (send - s >= 16);
+    }
+
+#endif
+
+    while (s < send) {
+        bool in = FALSE;
+
+        for (i = 0; i < count; i++) {
+            if ((U8) (*s - ranges->lo[i]) <= ranges->span[i]) {
+                in = TRUE;
+                break;
+            }
+        }
+
+        if (in != negated) {
+            return s;
+        }
+        s++;
+    }
+
+    return s;
+}
+
 STATIC U8 *
 S_find_span_end_mask(U8 * s, const U8 * send, const U8 span_byte, const U8 mask)
 {
@@ -1936,6 +2012,17 @@ STMT_START {
 
 #define LAST_REGTRY_SKIPPED_FORWARD(reginfo) (reginfo->cutpoint)
 
+/* Whether the start class has been described as byte ranges at compile time
+ * (see S_set_stclass_ranges() in regcomp.c) that can be used on this target.
+ * If so, REXEC_FBC_FIND_NEXT_IN_RANGES finds the next byte it matches */
+#define REXEC_FBC_HAS_RANGES(utf8)                                      \
+    (   c == progi->regstclass                                          \
+     && progi->stclass_ranges.count                                     \
+     && (! (utf8) || progi->stclass_ranges.utf8_ok))
+
+#define REXEC_FBC_FIND_NEXT_IN_RANGES                                   \
+    find_next_in_ranges((U8 *) s, (U8 *) strend, &progi->stclass_ranges)
+
 /* We keep track of where the next character should start after an occurrence
  * of the one we're looking for.  Knowing that, we can see right away if the
  * next occurrence is adjacent to the previous.  When 'doevery' is FALSE, we
@@ -2317,8 +2404,13 @@ S_find_byclass(pTHX_ regexp * prog, const regnode *c, char *s,
       case ANYOFD_t8_p8:
       case ANYOF_t8_pb:
       case ANYOF_t8_p8:
-        REXEC_FBC_UTF8_CLASS_SCAN(
+        if (REXEC_FBC_HAS_RANGES(TRUE)) {
+            REXEC_FBC_UTF8_FIND_NEXT_SCAN(REXEC_FBC_FIND_NEXT_IN_RANGES);
+        }
+        else {
+            REXEC_FBC_UTF8_CLASS_SCAN(
                 reginclass(prog, c, (U8*)s, (U8*) strend, 1 /* is utf8 */));
+        }
         break;
 
       case ANYOFPOSIXL_tb_pb:
@@ -2334,7 +2426,10 @@ S_find_byclass(pTHX_ regexp * prog, const regnode *c, char *s,
       case ANYOFD_tb_p8:
       case ANYOF_tb_pb:
       case ANYOF_tb_p8:
-        if (! ANYOF_FLAGS(c) && ANYOF_MATCHES_NONE_OUTSIDE_BITMAP(c)) {
+        if (REXEC_FBC_HAS_RANGES(FALSE)) {
+            REXEC_FBC_NON_UTF8_FIND_NEXT_SCAN(REXEC_FBC_FIND_NEXT_IN_RANGES);
+        }
+        else if (! ANYOF_FLAGS(c) && ANYOF_MATCHES_NONE_OUTSIDE_BITMAP(c)) {
             /* We know that s is in the bitmap range since the target isn't
              * UTF-8, so what happens for out-of-range values is not relevant,
              * so exclude that from the flags */
@@ -3146,8 +3241,13 @@ S_find_byclass(pTHX_ regexp * prog, const regnode *c, char *s,
       case NPOSIXA_t8_p8:
         /* The complement of something that matches only ASCII matches all
          * non-ASCII, plus everything in ASCII that isn't in the class. */
-        REXEC_FBC_UTF8_CLASS_SCAN(   ! isASCII_utf8_safe(s, strend)
-                                  || ! generic_isCC_A_(*s, FLAGS(c)));
+        if (REXEC_FBC_HAS_RANGES(TRUE)) {
+            REXEC_FBC_UTF8_FIND_NEXT_SCAN(REXEC_FBC_FIND_NEXT_IN_RANGES);
+        }
+        else {
+            REXEC_FBC_UTF8_CLASS_SCAN(   ! isASCII_utf8_safe(s, strend)
+                                      || ! generic_isCC_A_(*s, FLAGS(c)));
+        }
         break;
 
       case POSIXA_t8_pb:
@@ -3156,7 +3256,12 @@ S_find_byclass(pTHX_ regexp * prog, const regnode *c, char *s,
          * byte invariant character.  But we do anyway for performance reasons,
          * as otherwise we would have to examine all the continuation
          * characters */
-        REXEC_FBC_UTF8_CLASS_SCAN(generic_isCC_A_(*s, FLAGS(c)));
+        if (REXEC_FBC_HAS_RANGES(TRUE)) {
+            REXEC_FBC_UTF8_FIND_NEXT_SCAN(REXEC_FBC_FIND_NEXT_IN_RANGES);
+        }
+        else {
+            REXEC_FBC_UTF8_CLASS_SCAN(generic_isCC_A_(*s, FLAGS(c)));
+        }
         break;
 
       case NPOSIXD_tb_pb:
@@ -3170,8 +3275,13 @@ S_find_byclass(pTHX_ regexp * prog, const regnode *c, char *s,
       case POSIXD_tb_p8:
       case POSIXA_tb_pb:
       case POSIXA_tb_p8:
-        REXEC_FBC_NON_UTF8_CLASS_SCAN(
+        if (REXEC_FBC_HAS_RANGES(FALSE)) {
+            REXEC_FBC_NON_UTF8_FIND_NEXT_SCAN(REXEC_FBC_FIND_NEXT_IN_RANGES);
+        }
+        else {
+            REXEC_FBC_NON_UTF8_CLASS_SCAN(
                         to_complement ^ cBOOL(generic_isCC_A_(*s, FLAGS(c))));
+        }
         break;
 
       case NPOSIXU_tb_pb:
@@ -3181,9 +3291,14 @@ S_find_byclass(pTHX_ regexp * prog, const regnode *c, char *s,
 
       case POSIXU_tb_pb:
       case POSIXU_tb_p8:
+        if (REXEC_FBC_HAS_RANGES(FALSE)) {
+            REXEC_FBC_NON_UTF8_FIND_NEXT_SCAN(REXEC_FBC_FIND_NEXT_IN_RANGES);
+        }
+        else {
             REXEC_FBC_NON_UTF8_CLASS_SCAN(
                                  to_complement ^ cBOOL(generic_isCC_(*s,
                                                                     FLAGS(c))));
+        }
         break;
 
       case NPOSIXD_t8_pb:
@@ -3541,6 +3656,20 @@ S_reg_set_capture_string(pTHX_ REGEXP * const rx,
             RXp_SUBLEN(prog)  = strend - strbeg;
             RXp_SUBOFFSET(prog) = 0;
             RXp_SUBCOFFSET(prog) = 0;
+        }
+        else if (SvVIEW_mg(sv) && SvCANCOW(SvVIEW_mg(sv)->mg_obj)) {
+            /* sv is the end of a COW buffer: share that buffer instead */
+            const SV * const owner = SvVIEW_mg(sv)->mg_obj;
+            DEBUG_C(Perl_re_printf( aTHX_
+                              "Copy on write: regexp capture of a view\n"));
+            RXp_MATCH_COPY_FREE(prog);
+            RXp_SAVED_COPY(prog) = sv_setsv_cow(RXp_SAVED_COPY(prog),
+                                                (SV *)owner);
+            RXp_SUBBEG(prog) = (char *)SvPVX_const(RXp_SAVED_COPY(prog))
+                             + (SvPVX_const(sv) - SvPVX_const(owner));
+            RXp_SUBLEN(prog)  = strend - strbeg;
+            RXp_SUBOFFSET(prog) = 0;
+            RXp_SUBCOFFSET(prog) = 0;
         } else
 #endif
         {
@@ -3705,6 +3834,17 @@ Perl_regexec_flags(pTHX_ REGEXP * const rx, char *stringarg, char *strend,
     reginfo->strbeg = strbeg;
     reginfo->strend = strend;
     reginfo->is_utf8_target = cBOOL(utf8_target);
+    reginfo->linear_budget = 0;
+
+    /* The straight-line matcher compares literals byte for byte, so can't
+     * when they're different in the target's encoding; and it leaves it to
+     * regmatch() to show what it does under "use re 'debug'" */
+    reginfo->straight_ok =
+           progi->straight_idx
+        && (   cBOOL(utf8_target) == cBOOL(RX_UTF8(rx))
+            || ((reg_straight_prog *)
+                    progi->data->data[progi->straight_idx])->invariant);
+    DEBUG_EXECUTE_r(reginfo->straight_ok = FALSE);
 
     if (prog->intflags & PREGf_GPOS_SEEN) {
         MAGIC *mg;
@@ -3926,6 +4066,29 @@ Perl_regexec_flags(pTHX_ REGEXP * const rx, char *stringarg, char *strend,
     if (prog->recurse_locinput)
         Zero(prog->recurse_locinput,prog->nparens + 1, char *);
 
+    /* A pattern with a linear-time program is matched by it straight away
+     * under "use re 'linear'", unless the target is one it can't match
+     * case-insensitively; otherwise only once backtracking has taken much
+     * longer than it would, which it doesn't for most patterns and
+     * targets. */
+    if (prog->intflags & PREGf_LINEAR) {
+        const I32 matched = linear_exec(reginfo, s);
+        if (matched > 0)
+            goto got_it;
+        if (matched == 0)
+            goto phooey;
+    }
+    else if (prog->intflags & PREGf_LINEAR_OK) {
+        const SSize_t per_char = 4 * (SSize_t)
+            ((reg_linear_prog *) progi->data->data[progi->linear_idx])->nstates;
+        const SSize_t len = strend - s + 1;
+
+        reginfo->linear_budget = (len > (SSize_t_MAX - 1024) / per_char)
+                                 ? SSize_t_MAX
+                                 : len * per_char + 1024;
+        reginfo->linear_start = s;
+    }
+
     /* Simplest case: anchored match (but not \G) need be tried only once,
      * or with MBOL, only at the beginning of each line.
      *
@@ -4317,6 +4480,15 @@ Perl_regexec_flags(pTHX_ REGEXP * const rx, char *stringarg, char *strend,
     return 1;
 
   phooey:
+    if (reginfo->linear_budget < 0) {
+        /* regmatch() gave up: there may yet be a match */
+        DEBUG_EXECUTE_r(Perl_re_printf( aTHX_
+            "Too much backtracking, switching to the linear-time matcher\n"));
+        reginfo->linear_budget = 0;
+        if (linear_exec(reginfo, reginfo->linear_start) > 0)
+            goto got_it;
+    }
+
     DEBUG_EXECUTE_r(Perl_re_printf( aTHX_  "%sMatch failed%s\n",
                           PL_colors[4], PL_colors[5]));
 
@@ -4381,6 +4553,10 @@ S_regtry(pTHX_ regmatch_info *reginfo, char **startposp)
 
     PERL_ARGS_ASSERT_REGTRY;
 
+    /* regmatch() has given up, for the linear-time matcher to take over */
+    if (reginfo->linear_budget < 0)
+        return 0;
+
     reginfo->cutpoint=NULL;
 
     RXp_OFFSp(prog)[0].start = *startposp - reginfo->strbeg;
@@ -4420,7 +4596,9 @@ S_regtry(pTHX_ regmatch_info *reginfo, char **startposp)
     }
 #endif
     REGCP_SET(lastcp);
-    result = regmatch(reginfo, *startposp, progi->program + 1);
+    result = reginfo->straight_ok
+             ? straight_exec(reginfo, *startposp)
+             : regmatch(reginfo, *startposp, progi->program + 1);
     if (result != -1) {
         RXp_OFFSp(prog)[0].end = result;
         return 1;
@@ -4431,6 +4609,697 @@ S_regtry(pTHX_ regmatch_info *reginfo, char **startposp)
     return 0;
 }
 
+/* Whether linear_exec() can match from where the budget for backtracking
+ * was set, rather than abandon it as it needs Unicode case-folding.  As that
+ * can't be known for sure without running it, the target is checked for
+ * any char it might. */
+
+static bool
+S_linear_target_ok(const regmatch_info *reginfo)
+{
+    const regexp * const prog = ReANY(reginfo->prog);
+    RXi_GET_DECL(prog, progi);
+    const reg_linear_prog * const lp =
+                    (reg_linear_prog *) progi->data->data[progi->linear_idx];
+
+    return    lp->fold == LINEAR_FOLD_ANY
+           || (lp->fold == LINEAR_FOLD_NATIVE && ! reginfo->is_utf8_target)
+           || is_utf8_invariant_string((U8 *) reginfo->linear_start,
+                                    reginfo->strend - reginfo->linear_start);
+}
+
+/*
+ - straight_exec - match the straight-line program of a pattern (see
+ * reg_straight_prog in regcomp.h) at 'startpos', as regmatch() would its
+ * regnodes, returning the same: the offset of the end of the match, or -1.
+ *
+ * Only a quantifier can be backtracked into, and as there's no
+ * alternation, each of them has at most one entry on the stack, saying
+ * how many chars it has matched and where that left it; the instructions
+ * after it are all run again whenever it gives up or takes another char,
+ * so the capture groups never need restoring.
+ */
+STATIC SSize_t
+S_straight_exec(pTHX_ regmatch_info *reginfo, char *startpos)
+{
+    regexp * const prog = ReANY(reginfo->prog);
+    RXi_GET_DECL(prog, progi);
+    const reg_straight_prog * const sp =
+                (reg_straight_prog *) progi->data->data[progi->straight_idx];
+    const reg_straight_inst * const inst = sp->inst;
+    const regnode * const program = progi->program;
+    const char * const strbeg = reginfo->strbeg;
+    char * const strend = reginfo->strend;
+    struct {
+        U32 inst;       /* the REPEAT instruction */
+        I32 count;      /* how many chars it has matched */
+        char *pos;      /* where that left it */
+    } stack[STRAIGHT_MAX_REPEATS], *top;
+    U32 ntop = 0;
+    const reg_straight_inst *rep;   /* the instruction of 'top' */
+    char *locinput = startpos;
+    U32 i = 0;
+#ifdef DEBUGGING
+    U32 depth = 0; /* used by regrepeat() and CLOSE_CAPTURE */
+#endif
+    DECLARE_AND_GET_RE_DEBUG_FLAGS;
+
+    PERL_ARGS_ASSERT_STRAIGHT_EXEC;
+
+    for (;;) {
+        const reg_straight_inst * const in = inst + i;
+        const regnode * const scan = program + in->node;
+
+        switch (in->op) {
+          case STRAIGHT_MATCH:
+            if (locinput < reginfo->till)
+                goto fail;
+            return locinput - strbeg;
+
+          case STRAIGHT_EXACT:
+          {
+            /* the literal is the same in either encoding, or in the one
+             * the target is in */
+            const char * const s = OP(scan) == EXACT ? STRINGs(scan)
+                                                     : STRINGl(scan);
+            const STRLEN ln = OP(scan) == EXACT ? STR_LENs(scan)
+                                                : STR_LENl(scan);
+            if (   (STRLEN) (strend - locinput) < ln
+                || *s != *locinput
+                || memNE(s, locinput, ln))
+            {
+                goto fail;
+            }
+            locinput += ln;
+            break;
+          }
+
+          case STRAIGHT_ONE:
+          {
+            char *li = locinput;
+            if (locinput >= strend
+                || ! regrepeat(prog, &li, scan, strend, reginfo, 1))
+            {
+                goto fail;
+            }
+            locinput = li;
+            break;
+          }
+
+          case STRAIGHT_ASSERT:
+            if (! linear_assert(scan, locinput, reginfo))
+                goto fail;
+            break;
+
+          case STRAIGHT_OPEN:
+            RXp_OFFSp(prog)[in->paren].start_tmp = locinput - strbeg;
+            break;
+
+          case STRAIGHT_CLOSE:
+            CLOSE_CAPTURE(prog, in->paren,
+                          RXp_OFFSp(prog)[in->paren].start_tmp,
+                          locinput - strbeg);
+            break;
+
+          case STRAIGHT_REPEAT:
+          {
+            char *li = locinput;
+            I32 count;
+
+            rep = in;
+
+            if (in->flags & STRAIGHT_MINMOD) {
+                if (   in->min
+                    && regrepeat(prog, &li, scan, strend, reginfo, in->min)
+                                                                    < in->min)
+                {
+                    goto fail;
+                }
+                count = in->min;
+                if (count == in->max) {
+                    locinput = li;
+                    break;
+                }
+            }
+            else {
+                count = in->max
+                        ? regrepeat(prog, &li, scan, strend, reginfo, in->max)
+                        : 0;
+                if (count < in->min)
+                    goto fail;
+                if (count == in->min) {
+                    locinput = li;
+                    break;
+                }
+            }
+            top = stack + ntop++;
+            top->inst = i;
+            top->count = count;
+            top->pos = li;
+            goto resume;
+          }
+
+          default:
+            Perl_croak(aTHX_ "panic: straight_exec unexpected op %d",
+                       (int) in->op);
+        }
+        i++;
+        continue;
+
+      fail:
+        if (! ntop)
+            return -1;
+
+        /* give up if the linear-time matcher would do better */
+        if (   reginfo->linear_budget > 0
+            && --reginfo->linear_budget == 0
+            && S_linear_target_ok(reginfo))
+        {
+            reginfo->linear_budget = -1;
+            return -1;
+        }
+        top = stack + ntop - 1;
+        rep = inst + top->inst;
+
+      step:
+        /* Have the quantifier on top of the stack take another char, or
+         * give one up */
+        if (rep->flags & STRAIGHT_MINMOD) {
+            char *li = top->pos;
+            I32 n = 1;
+
+            /* If the literal after it has to start with a given byte,
+             * which can't be inside a UTF-8 char, take all the chars up to
+             * the next one at once */
+            if ((rep->flags & STRAIGHT_FIRST) && top->pos < strend) {
+                const char * const from = top->pos
+                                + (reginfo->is_utf8_target
+                                   ? UTF8SKIP(top->pos) : 1);
+                const char * const to = (from < strend)
+                                        ? (char *) memchr(from, rep->first,
+                                                          strend - from)
+                                        : NULL;
+                if (! to) {
+                    ntop--;
+                    goto fail;
+                }
+                if (to - top->pos < I32_MAX)
+                    n = reginfo->is_utf8_target
+                        ? (I32) utf8_length((U8 *) top->pos, (U8 *) to)
+                        : (I32) (to - top->pos);
+            }
+            if (   (rep->max != REG_INFTY && rep->max - top->count < n)
+                || top->pos >= strend
+                || regrepeat(prog, &li, program + rep->node, strend,
+                             reginfo, n) < n)
+            {
+                ntop--;
+                goto fail;
+            }
+            top->count += n;
+            top->pos = li;
+        }
+        else {
+            if (top->count <= rep->min) {
+                ntop--;
+                goto fail;
+            }
+            top->count--;
+            top->pos = HOPc(top->pos, -1);
+        }
+
+      resume:
+        /* Carry on from there, unless it's somewhere the literal after the
+         * quantifier can't start */
+        if (   (rep->flags & STRAIGHT_FIRST)
+            && (top->pos >= strend || *top->pos != (char) rep->first))
+        {
+            goto step;
+        }
+        locinput = top->pos;
+        i = top->inst + 1;
+        if (top->count == ((rep->flags & STRAIGHT_MINMOD) ? rep->max
+                                                          : rep->min))
+        {
+            ntop--;
+        }
+    }
+    NOT_REACHED; /* NOTREACHED */
+}
+
+/*
+ - linear_assert - does the zero-width assertion 'scan' hold at 'locinput'?
+ *
+ * This is the part of regmatch() for the assertions which may appear in a
+ * program for linear_exec()
+ */
+STATIC bool
+S_linear_assert(pTHX_ const regnode *scan, const char *locinput,
+                      const regmatch_info *reginfo)
+{
+    const bool utf8_target = reginfo->is_utf8_target;
+    const bool at_end = (locinput >= reginfo->strend);
+    bool to_complement = FALSE;
+    bool b1, b2;
+
+    PERL_ARGS_ASSERT_LINEAR_ASSERT;
+
+    switch (OP(scan)) {
+      case SBOL:
+        return locinput == reginfo->strbeg;
+      case MBOL:
+        return locinput == reginfo->strbeg
+            || (! at_end && locinput[-1] == '\n');
+      case SEOL:
+        if (reginfo->strend - locinput > 1)
+            return FALSE;
+        /* FALLTHROUGH */
+      case MEOL:
+        return at_end || *locinput == '\n';
+      case EOS:
+        return at_end;
+
+      case NBOUND:
+        to_complement = TRUE;
+        /* FALLTHROUGH */
+      case BOUND:
+        if (utf8_target)
+            goto bound_utf8;
+        goto bound_ascii;
+
+      case NBOUNDA:
+        to_complement = TRUE;
+        /* FALLTHROUGH */
+      case BOUNDA:
+      bound_ascii:
+        b1 = (locinput == reginfo->strbeg)
+             ? isWORDCHAR_A('\n')
+             : isWORDCHAR_A(UCHARAT(locinput - 1));
+        b2 = at_end
+             ? isWORDCHAR_A('\n')
+             : isWORDCHAR_A(UCHARAT(locinput));
+        return cBOOL(to_complement ^ (b1 != b2));
+
+      case NBOUNDU:
+        to_complement = TRUE;
+        /* FALLTHROUGH */
+      case BOUNDU:
+        if (UNLIKELY(reginfo->strbeg >= reginfo->strend))
+            return to_complement;
+        if (utf8_target) {
+          bound_utf8:
+            b1 = (locinput == reginfo->strbeg)
+                 ? 0
+                 : isWORDCHAR_utf8_safe(reghop3((U8*)locinput, -1,
+                                                (U8*)(reginfo->strbeg)),
+                                        (U8*) reginfo->strend);
+            b2 = at_end
+                 ? 0
+                 : isWORDCHAR_utf8_safe((U8*)locinput,
+                                        (U8*) reginfo->strend);
+        }
+        else {
+            b1 = (locinput == reginfo->strbeg)
+                 ? 0
+                 : isWORDCHAR_L1(UCHARAT(locinput - 1));
+            b2 = at_end
+                 ? 0
+                 : isWORDCHAR_L1(UCHARAT(locinput));
+        }
+        return cBOOL(to_complement ^ (b1 != b2));
+
+      default:
+        Perl_croak(aTHX_ "panic: linear_assert unexpected regnode %d",
+                   (int) OP(scan));
+    }
+    NOT_REACHED; /* NOTREACHED */
+}
+
+/* The threads of linear_exec().  A thread is an instruction of the
+ * linear-time program plus these words: */
+#define LT_LASTPAREN        0
+#define LT_LASTCLOSEPAREN   1
+#define LT_START            2   /* where the match began */
+#define LT_COUNT(l)         (3 + (l))   /* counter of loop 'l' */
+#define LT_PAREN(vm, p)     (3 + (vm)->lp->nloops + 3 * ((p) - 1))
+                                /* start, end and start_tmp of group 'p' */
+
+typedef struct {
+    U32 *pcs;
+    SSize_t *words;
+    U32 count;
+} linear_list;
+
+typedef struct {
+    const reg_linear_prog *lp;
+    const regmatch_info *reginfo;
+    const regnode *program;
+    Size_t width;               /* words per thread */
+    linear_list stack;          /* threads yet to be followed by add */
+    U32 *seen;                  /* the 'gen' each state was last added in */
+    U32 gen;
+} linear_vm;
+
+/* Add the threads which can be reached from the one at instruction 'pc'
+ * with the words at 't', at position 'at' in the target string, without
+ * consuming anything, to 'list'.  They are added in the order regmatch()
+ * would try them in, and only the first to get to any state in this
+ * generation counts; the others could only ever do as it does. */
+
+static void
+S_linear_add(pTHX_ linear_vm *vm, linear_list *list, U32 pc,
+                   const SSize_t *t, const char *at)
+{
+    const reg_linear_inst * const inst = vm->lp->inst;
+    const reg_linear_loop * const loops = vm->lp->loops;
+    const Size_t width = vm->width;
+    const SSize_t offset = at - vm->reginfo->strbeg;
+    U32 sp = 0;
+    SSize_t *w;
+    SSize_t *pp;
+    U32 i;
+
+    /* the thread being followed is always the one in stack slot 'sp' */
+    vm->stack.pcs[0] = pc;
+    Copy(t, vm->stack.words, width, SSize_t);
+
+    for (;;) {
+        const reg_linear_inst *in;
+        U32 sid;
+        U32 mult = 1;
+        U16 l;
+
+        w = vm->stack.words + sp * width;
+        pc = vm->stack.pcs[sp];
+        in = inst + pc;
+
+        sid = in->state;
+        for (l = in->loop; l; l = loops[l - 1].parent) {
+            sid += (U32) w[LT_COUNT(l - 1)] * mult;
+            mult *= loops[l - 1].radix;
+        }
+        assert(sid < vm->lp->nstates);
+        if (vm->seen[sid] == vm->gen)
+            goto follow_next;
+        vm->seen[sid] = vm->gen;
+
+        switch (in->op) {
+          case LINEAR_MATCH:
+          case LINEAR_CHAR:
+          case LINEAR_CHARF:
+          case LINEAR_NODE:
+            list->pcs[list->count] = pc;
+            Copy(w, list->words + list->count * width, width, SSize_t);
+            list->count++;
+            goto follow_next;
+
+          case LINEAR_ASSERT:
+            if (! linear_assert(vm->program + in->arg, at, vm->reginfo))
+                goto follow_next;
+            /* FALLTHROUGH */
+          case LINEAR_JUMP:
+            vm->stack.pcs[sp] = in->next;
+            continue;
+
+          case LINEAR_OPEN:
+            w[LT_PAREN(vm, in->arg) + 2] = offset;
+            vm->stack.pcs[sp] = in->next;
+            continue;
+
+          case LINEAR_CLOSE:
+            pp = w + LT_PAREN(vm, in->arg);
+            pp[0] = pp[2];
+            pp[1] = offset;
+            if ((SSize_t) in->arg > w[LT_LASTPAREN])
+                w[LT_LASTPAREN] = in->arg;
+            w[LT_LASTCLOSEPAREN] = in->arg;
+            vm->stack.pcs[sp] = in->next;
+            continue;
+
+          case LINEAR_CLEAR:
+            for (i = in->arg; i <= in->alt; i++) {
+                pp = w + LT_PAREN(vm, i);
+                pp[0] = pp[1] = pp[2] = -1;
+            }
+            vm->stack.pcs[sp] = in->next;
+            continue;
+
+          case LINEAR_SPLIT:
+            /* leave a copy to follow 'alt' later */
+            vm->stack.pcs[sp] = in->alt;
+            Copy(w, w + width, width, SSize_t);
+            vm->stack.pcs[++sp] = in->next;
+            continue;
+
+          case LINEAR_EXIT:
+          {
+            const U16 paren = loops[in->arg].paren;
+            if (paren) {
+                pp = w + LT_PAREN(vm, paren);
+                if (w[LT_COUNT(in->arg)]) {
+                    pp[0] = pp[2];
+                    pp[1] = offset;
+                    if ((SSize_t) paren > w[LT_LASTPAREN])
+                        w[LT_LASTPAREN] = paren;
+                    w[LT_LASTCLOSEPAREN] = paren;
+                }
+                else
+                    pp[1] = -1;
+            }
+            vm->stack.pcs[sp] = in->next;
+            continue;
+          }
+
+          case LINEAR_LOOP:
+          case LINEAR_REPEAT:
+          {
+            /* decide between another iteration and leaving, by the count
+             * of those done so far */
+            const reg_linear_loop * const loop = loops + in->arg;
+            SSize_t count = 0;
+            bool more;
+            bool done;
+
+            if (in->op == LINEAR_REPEAT) {
+                count = w[LT_COUNT(in->arg)];
+                if ((U32) count < loop->radix - 1)
+                    count++;
+            }
+            w[LT_COUNT(in->arg)] = count;
+            more = loop->max == REG_INFTY || count < loop->max;
+            done = count >= loop->min;
+            if (more && done) {
+                const bool minmod = cBOOL(in->flags & LINEAR_MINMOD);
+                vm->stack.pcs[sp] = minmod ? in->next : in->alt;
+                Copy(w, w + width, width, SSize_t);
+                vm->stack.pcs[++sp] = minmod ? in->alt : in->next;
+            }
+            else if (more)
+                vm->stack.pcs[sp] = in->next;
+            else if (done)
+                vm->stack.pcs[sp] = in->alt;
+            else
+                goto follow_next;
+            continue;
+          }
+
+          default:
+            Perl_croak(aTHX_ "panic: linear_add unknown op %d", (int) in->op);
+        }
+
+      follow_next:
+        if (! sp)
+            return;
+        sp--;
+    }
+}
+
+/*
+ - linear_exec - find the leftmost match at or after 'startpos' by running
+ * the pattern's linear-time program
+ *
+ * All the ways regmatch() could proceed are simulated at once, one
+ * character of the target at a time, as a list of threads kept in the
+ * order regmatch() would try them in, so that the first to match is the
+ * match regmatch() would have found.  As there can be no more threads than
+ * states of the program, the time taken is linear in the length of the
+ * target string.
+ *
+ * On success, sets the offsets of the match and its captures, as regtry()
+ * would, and returns 1.  Returns 0 if there is no match, and -1 if the
+ * target has a character which a case-insensitive part of the pattern
+ * would have to be compared with by Unicode rules (see reg_linear_prog),
+ * for the match to be left to backtracking.
+ */
+STATIC I32
+S_linear_exec(pTHX_ regmatch_info *reginfo, char *startpos)
+{
+    REGEXP *const rx = reginfo->prog;
+    regexp *const prog = ReANY(rx);
+    RXi_GET_DECL(prog, progi);
+    const reg_linear_prog * const lp =
+                    (reg_linear_prog *) progi->data->data[progi->linear_idx];
+    const bool utf8_target = reginfo->is_utf8_target;
+    const char * const strbeg = reginfo->strbeg;
+    char * const strend = reginfo->strend;
+    const U32 nparens = prog->nparens;
+    const Size_t nthreads = (Size_t) lp->nstates + 2;
+    linear_vm vm;
+    linear_list lists[2];
+    linear_list *clist = lists;
+    linear_list *nlist = lists + 1;
+    SSize_t *start;     /* the words of a thread starting a match */
+    SSize_t *words;
+    U32 *pcs;
+    bool matched = FALSE;
+    char *pos = startpos;
+    U32 paren;
+    U32 i;
+#ifdef DEBUGGING
+    U32 depth = 0; /* used by regrepeat() */
+#endif
+    DECLARE_AND_GET_RE_DEBUG_FLAGS;
+
+    PERL_ARGS_ASSERT_LINEAR_EXEC;
+
+    vm.lp = lp;
+    vm.reginfo = reginfo;
+    vm.program = progi->program;
+    vm.width = 3 + lp->nloops + 3 * (Size_t) nparens;
+    vm.gen = 1;
+
+    /* one allocation for everything, freed when the match is done */
+    Newx(words, (3 * nthreads + 1) * vm.width, SSize_t);
+    SAVEFREEPV(words);
+    Newxz(pcs, 4 * nthreads, U32);
+    SAVEFREEPV(pcs);
+    for (i = 0; i < 3; i++) {
+        linear_list * const l = i == 2 ? &vm.stack : lists + i;
+        l->words = words + i * nthreads * vm.width;
+        l->pcs = pcs + i * nthreads;
+        l->count = 0;
+    }
+    vm.seen = pcs + 3 * nthreads;
+    start = words + 3 * nthreads * vm.width;
+
+    start[LT_LASTPAREN] = 0;
+    start[LT_LASTCLOSEPAREN] = 0;
+    for (i = 1; i <= nparens; i++) {
+        SSize_t * const pp = start + LT_PAREN(&vm, i);
+        pp[0] = pp[1] = pp[2] = -1;
+    }
+
+    DEBUG_EXECUTE_r(Perl_re_printf( aTHX_
+        "Matching in linear time from offset %" IVdf ", %" UVuf " states\n",
+        (IV) (startpos - strbeg), (UV) lp->nstates));
+
+    for (;;) {
+        STRLEN charlen = 1;
+        UV c = 0;
+        linear_list *tmp;
+
+        /* a match may start here, less preferably than one started earlier */
+        if (   ! matched
+            && (   ! (prog->intflags & PREGf_ANCH_SBOL) || pos == startpos)
+            && (   ! (prog->intflags & PREGf_ANCH_MBOL)
+                || pos == startpos || pos[-1] == '\n'))
+        {
+            start[LT_START] = pos - strbeg;
+            S_linear_add(aTHX_ &vm, clist, 0, start, pos);
+        }
+        /* with no threads left, a match could only start further on */
+        if (   ! clist->count
+            && (   matched || pos >= strend
+                || (prog->intflags & PREGf_ANCH_SBOL)))
+        {
+            break;
+        }
+
+        if (pos < strend) {
+            if (utf8_target)
+                c = utf8_to_uvchr_buf((U8 *) pos, (U8 *) strend, &charlen);
+            else
+                c = (U8) *pos;
+        }
+
+        if (UNLIKELY(++vm.gen == 0)) {
+            Zero(vm.seen, lp->nstates, U32);
+            vm.gen = 1;
+        }
+        nlist->count = 0;
+        for (i = 0; i < clist->count; i++) {
+            const reg_linear_inst * const in = lp->inst + clist->pcs[i];
+            SSize_t * const t = clist->words + i * vm.width;
+            bool ok;
+
+            if (in->op == LINEAR_MATCH) {
+                if (pos < reginfo->till)
+                    continue;
+
+                /* the less preferred threads don't matter now */
+                RXp_OFFSp(prog)[0].start = t[LT_START];
+                RXp_OFFSp(prog)[0].end = pos - strbeg;
+                RXp_LASTPAREN(prog) = t[LT_LASTPAREN];
+                RXp_LASTCLOSEPAREN(prog) = t[LT_LASTCLOSEPAREN];
+                for (paren = 1; paren <= nparens; paren++) {
+                    const SSize_t * const pp = t + LT_PAREN(&vm, paren);
+                    RXp_OFFSp(prog)[paren].start = pp[0];
+                    RXp_OFFSp(prog)[paren].end = pp[1];
+                    RXp_OFFSp(prog)[paren].start_tmp = pp[2];
+                }
+                matched = TRUE;
+                break;
+            }
+            if (pos >= strend)
+                continue;
+
+            switch (in->op) {
+              case LINEAR_CHAR:
+                ok = (c == in->arg);
+                break;
+              case LINEAR_CHARF:
+                if (   c >= 128
+                    && (   lp->fold == LINEAR_FOLD_ASCII
+                        || (lp->fold == LINEAR_FOLD_NATIVE && utf8_target)))
+                {
+                    DEBUG_EXECUTE_r(Perl_re_printf( aTHX_
+                        "Linear-time match abandoned at offset %" IVdf "\n",
+                        (IV) (pos - strbeg)));
+                    return -1;
+                }
+                ok = (c < 128 && toFOLD(c) == in->arg);
+                break;
+              default: /* LINEAR_NODE */
+              {
+                char *p = pos;
+                ok = (regrepeat(prog, &p, progi->program + in->arg,
+                                strend, reginfo, 1) == 1);
+                break;
+              }
+            }
+            if (ok)
+                S_linear_add(aTHX_ &vm, nlist, in->next, t, pos + charlen);
+        }
+
+        if (pos >= strend)
+            break;
+        pos += charlen;
+        tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+    }
+
+    DEBUG_EXECUTE_r(Perl_re_printf( aTHX_
+        "Linear-time match %s\n", matched ? "succeeded" : "failed"));
+    return matched ? 1 : 0;
+}
+
+#undef LT_LASTPAREN
+#undef LT_LASTCLOSEPAREN
+#undef LT_START
+#undef LT_COUNT
+#undef LT_PAREN
+
 /* this is used to determine how far from the left messages like
    'failed...' are printed in regexec.c. It should be set such that
    messages are inline with the regop output that created them.
@@ -6512,6 +7381,8 @@ S_regmatch(pTHX_ regmatch_info *reginfo, char *startpos, regnode *prog)
     I32 orig_savestack_ix = PL_savestack_ix;
     U8 * script_run_begin = NULL;
     char *match_end= NULL; /* where a match MUST end to be considered successful */
+    regmatch_slab  *orig_slab = PL_regmatch_slab;   /* to give up from */
+    regmatch_state *orig_state = PL_regmatch_state;
     bool is_accepted = FALSE; /* have we hit an ACCEPT opcode? */
     re_fold_t folder = NULL;  /* used by various EXACTish regops */
     const U8 * fold_array = NULL; /* used by various EXACTish regops */
@@ -10152,6 +11023,18 @@ NULL
         }
     }
     if (depth) {
+        /* give up if the linear-time matcher would do better */
+        if (   reginfo->linear_budget > 0
+            && --reginfo->linear_budget == 0
+            && S_linear_target_ok(reginfo))
+        {
+            reginfo->linear_budget = -1;
+            PL_regmatch_slab = orig_slab;
+            PL_regmatch_state = orig_state;
+            result = 0;
+            goto final_exit;
+        }
+
         /* there's a previous state to backtrack to */
         st--;
         if (st < SLAB_FIRST(PL_regmatch_slab)) {
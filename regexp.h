@@ -825,10 +825,14 @@ typedef struct {
     I32  poscache_maxiter; /* how many whilems todo before S-L cache kicks in */
     I32  poscache_iter;    /* current countdown from _maxiter to zero */
     STRLEN poscache_size;  /* size of regmatch_info_aux.poscache */
+    SSize_t linear_budget; /* backtracks left before switching to the
+                              linear-time matcher; -1 once it's run out */
+    char *linear_start;    /* where the linear-time matcher would start */
     bool intuit;    /* re_intuit_start() is the top-level caller */
     bool is_utf8_pat;    /* regex is utf8 */
     bool is_utf8_target; /* string being matched is utf8 */
     bool warned; /* we have issued a recursion warning; no need for more */
+    bool straight_ok; /* regtry() may use the straight-line matcher */
 } regmatch_info;
 
 
@@ -1090,6 +1094,31 @@ typedef struct regmatch_slab {
     struct regmatch_slab *prev, *next;
 } regmatch_slab;
 
+/* The interpreter's cache of compiled run-time patterns, which lets a
+ * pattern interpolated at one call site reuse a compilation of the same
+ * pattern string done at another, or by the same op a few iterations
+ * earlier.  See Perl_re_cache_fetch() in regcomp.c. */
+
+#ifndef PERL_RE_CACHE_SIZE
+#  define PERL_RE_CACHE_SIZE 64
+#endif
+
+struct re_cache_entry {
+    REGEXP *    rx;         /* holds the pattern string, NULL if unused */
+    char *      warnings;   /* lexical warnings in force when compiled */
+    U32         hash;       /* hash of the pattern string */
+    U32         flags;      /* compile flags, see RE_CACHE_FLAGS */
+    UV          used;       /* value of the clock when last looked up */
+};
+
+typedef struct re_cache {
+    struct re_cache_entry *entries;
+    U32         size;       /* maximum number of entries, 0 if disabled */
+    U32         count;      /* number of entries in use */
+    UV          clock;      /* counts lookups, to find the LRU entry */
+    UV          hits;
+    UV          misses;
+} re_cache;
 
 #define REG_FETCH_ABSOLUTE 1
 
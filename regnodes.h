@@ -2901,7 +2901,7 @@ EXTCONST char * const PL_reg_intflags_name[] = {
 	"CUTGROUP_SEEN",              /* (1<< 4) - 0x00000010 - PREGf_CUTGROUP_SEEN */
 	"USE_RE_EVAL",                /* (1<< 5) - 0x00000020 - PREGf_USE_RE_EVAL -  compiled with "use re 'eval'"  */
 	"NOSCAN",                     /* (1<< 6) - 0x00000040 - PREGf_NOSCAN */
-	"",                           /* (1<< 7) - 0x00000080 - *UNUSED* */
+	"LOOKAHEAD_SEEN",             /* (1<< 7) - 0x00000080 - PREGf_LOOKAHEAD_SEEN -  may look past the end of $&  */
 	"GPOS_SEEN",                  /* (1<< 8) - 0x00000100 - PREGf_GPOS_SEEN */
 	"GPOS_FLOAT",                 /* (1<< 9) - 0x00000200 - PREGf_GPOS_FLOAT */
 	"ANCH_MBOL",                  /* (1<<10) - 0x00000400 - PREGf_ANCH_MBOL */
@@ -2909,11 +2909,13 @@ EXTCONST char * const PL_reg_intflags_name[] = {
 	"ANCH_GPOS",                  /* (1<<12) - 0x00001000 - PREGf_ANCH_GPOS */
 	"RECURSE_SEEN",               /* (1<<13) - 0x00002000 - PREGf_RECURSE_SEEN */
 	"PESSIMIZE_SEEN",             /* (1<<14) - 0x00004000 - PREGf_PESSIMIZE_SEEN */
+	"LINEAR_OK",                  /* (1<<15) - 0x00008000 - PREGf_LINEAR_OK -  has a linear-time program  */
+	"LINEAR",                     /* (1<<16) - 0x00010000 - PREGf_LINEAR -  compiled with "use re 'linear'"  */
 };
 #endif /* DOINIT */
 
 #ifdef DEBUGGING
-#  define REG_INTFLAGS_NAME_SIZE 15
+#  define REG_INTFLAGS_NAME_SIZE 17
 #endif
 
 /* The following have no fixed length. U8 so we can do strchr() on it. */
@@ -33,6 +33,111 @@
  *     [p.600 of _The Lord of the Rings_, III/xi: "The Palantír"]
  */
 
+#if defined(PERL_RUNOPS_COMPUTED_GOTO) && !defined(__GNUC__)
+#  error PERL_RUNOPS_COMPUTED_GOTO needs a compiler which supports "labels as values"
+#endif
+
+#ifdef PERL_RUNOPS_COMPUTED_GOTO
+
+/* With -DPERL_RUNOPS_COMPUTED_GOTO, the loop below dispatches through a
+ * table of label addresses indexed by op type, rather than through a
+ * single indirect call.  Each of the ops listed here gets a copy of the
+ * dispatch code of its own, which calls its pp function directly, so
+ * that the CPU can learn which op tends to follow which (e.g. a padsv
+ * after a nextstate) rather than having to predict the target of one
+ * shared indirect branch.  Everything else goes through the generic
+ * slot, which behaves exactly like the plain loop.
+ *
+ * op_ppaddr is still checked before each direct call, so ops whose
+ * ppaddr has been changed, for instance by an extension wrapping
+ * PL_ppaddr[], still do the right thing.
+ */
+
+#  define PERL_RUNOPS_HOT_OPS(X)                                        \
+    X(NEXTSTATE, Perl_pp_nextstate)                                     \
+    X(CONST, Perl_pp_const)                                             \
+    X(GVSV, Perl_pp_gvsv)                                               \
+    X(PADSV, Perl_pp_padsv)                                             \
+    X(PADSV_STORE, Perl_pp_padsv_store)                                 \
+    X(PADAV, Perl_pp_padav)                                             \
+    X(PUSHMARK, Perl_pp_pushmark)                                       \
+    X(SASSIGN, Perl_pp_sassign)                                         \
+    X(AND, Perl_pp_and)                                                 \
+    X(OR, Perl_pp_or)                                                   \
+    X(COND_EXPR, Perl_pp_cond_expr)                                     \
+    X(UNSTACK, Perl_pp_unstack)                                         \
+    X(ADD, Perl_pp_add)                                                 \
+    X(SUBTRACT, Perl_pp_subtract)                                       \
+    X(LT, Perl_pp_lt)                                                   \
+    X(EQ, Perl_pp_eq)                                                   \
+    X(PREINC, Perl_pp_preinc)                                           \
+    X(CONCAT, Perl_pp_concat)                                           \
+    X(MULTICONCAT, Perl_pp_multiconcat)                                 \
+    X(HELEM, Perl_pp_helem)                                             \
+    X(AELEM, Perl_pp_aelem)                                             \
+    X(AELEMFAST, Perl_pp_aelemfast)                                     \
+    X(AELEMFAST_LEX, Perl_pp_aelemfast)                                 \
+    X(MULTIDEREF, Perl_pp_multideref)                                   \
+    X(RV2AV, Perl_pp_rv2av)                                             \
+    X(ENTER, Perl_pp_enter)                                             \
+    X(LEAVE, Perl_pp_leave)                                             \
+    X(ENTERITER, Perl_pp_enteriter)                                     \
+    X(ITER, Perl_pp_iter)                                               \
+    X(LEAVELOOP, Perl_pp_leaveloop)                                     \
+    X(ENTERSUB, Perl_pp_entersub)                                       \
+    X(LEAVESUB, Perl_pp_leavesub)                                       \
+    X(RETURN, Perl_pp_return)                                           \
+    X(METHOD_NAMED, Perl_pp_method_named)
+
+#  define RUNOPS_DISPATCH_INIT(type, pp)                                \
+            dispatch[OP_##type] = &&op_##type;
+
+/* run the op, then jump straight to the code for the next one */
+#  define RUNOPS_DISPATCH_OP(type, pp)                                  \
+  op_##type:                                                            \
+    PL_op = op = LIKELY(op->op_ppaddr == pp)                            \
+                    ? pp(aTHX)                                          \
+                    : op->op_ppaddr(aTHX);                              \
+    if (UNLIKELY(!op))                                                  \
+        goto done;                                                      \
+    PERL_DTRACE_PROBE_OP(op);                                           \
+    goto *dispatch[op->op_type];
+
+int
+Perl_runops_standard(pTHX)
+{
+    /* filled in on first use; any races write the same values */
+    static void *dispatch[MAXO];
+    OP *op = PL_op;
+
+    if (UNLIKELY(!dispatch[OP_NULL])) {
+        unsigned i;
+        for (i = 0; i < MAXO; i++)
+            dispatch[i] = &&generic;
+        PERL_RUNOPS_HOT_OPS(RUNOPS_DISPATCH_INIT)
+    }
+
+    PERL_DTRACE_PROBE_OP(op);
+    goto *dispatch[op->op_type];
+
+    PERL_RUNOPS_HOT_OPS(RUNOPS_DISPATCH_OP)
+
+  generic:
+    PL_op = op = op->op_ppaddr(aTHX);
+    if (UNLIKELY(!op))
+        goto done;
+    PERL_DTRACE_PROBE_OP(op);
+    goto *dispatch[op->op_type];
+
+  done:
+    PERL_ASYNC_CHECK();
+
+    TAINT_NOT;
+    return 0;
+}
+
+#else /* !PERL_RUNOPS_COMPUTED_GOTO */
+
 int
 Perl_runops_standard(pTHX)
 {
@@ -47,6 +152,273 @@ Perl_runops_standard(pTHX)
     return 0;
 }
 
+#endif /* PERL_RUNOPS_COMPUTED_GOTO */
+
+/* A cheap sampling profiler.
+ *
+ * Perl_runops_profile() is a drop-in replacement for
+ * Perl_runops_standard() which counts every op executed by type, and
+ * which, whenever the profiling timer has fired since the last op,
+ * records a sample of the current perl-level call stack, the file and
+ * line of the current COP, and the type of the op that was running.
+ *
+ * Samples are kept in PL_op_profile_samples, keyed on the sample
+ * rendered in "collapsed stack" format (frames separated by ';'), which
+ * is what flame graph tools consume.  The op type counts are kept in
+ * PL_op_profile_counts.
+ *
+ * It is normally switched on by setting $ENV{PERL_OP_PROFILE} to the
+ * name of the file the results should be written to; see perlrun.
+ */
+
+#if defined(HAS_SETITIMER) && defined(HAS_SIGACTION) && defined(SIGPROF)
+#  define PERL_OP_PROFILE_TIMER
+#endif
+
+#ifdef PERL_OP_PROFILE_TIMER
+
+/* the default sampling interval in microseconds */
+#  ifndef PERL_OP_PROFILE_INTERVAL
+#    define PERL_OP_PROFILE_INTERVAL 1000
+#  endif
+
+STATIC Signal_t
+S_op_profile_sighandler(int sig)
+{
+    PERL_UNUSED_ARG(sig);
+    PL_op_profile_tick = 1;
+}
+
+#endif /* PERL_OP_PROFILE_TIMER */
+
+/* Append a sample for an op of type C<type> to PL_op_profile_samples */
+
+STATIC void
+S_op_profile_sample(pTHX_ OPCODE type)
+{
+    SV * const key = newSVpvs("");
+    SV *name = NULL;
+    const PERL_SI *si = PL_curstackinfo;
+    const char *file;
+    HE *he;
+    SV *count;
+
+    /* walk every context of every stackinfo, outermost first */
+    while (si->si_prev)
+        si = si->si_prev;
+
+    for (;;) {
+        I32 i;
+        for (i = 0; i <= si->si_cxix; i++) {
+            const PERL_CONTEXT * const cx = &si->si_cxstack[i];
+            CV *cv;
+
+            switch (CxTYPE(cx)) {
+            case CXt_SUB:
+                cv = cx->blk_sub.cv;
+                goto add_cv;
+            case CXt_FORMAT:
+                cv = cx->blk_format.cv;
+              add_cv:
+                if (!cv)
+                    continue;
+                if (!name)
+                    name = newSV(0);
+                cv_name(cv, name, 0);
+                sv_catsv(key, name);
+                break;
+            case CXt_EVAL:
+                if (CxOLD_OP_TYPE(cx) == OP_REQUIRE)
+                    sv_catpvs(key, "(require)");
+                else
+                    sv_catpvs(key, "(eval)");
+                break;
+            default:
+                continue;
+            }
+            sv_catpvs(key, ";");
+        }
+        if (si == PL_curstackinfo || !si->si_next)
+            break;
+        si = si->si_next;
+    }
+
+    file = CopFILE(PL_curcop);
+    Perl_sv_catpvf(aTHX_ key, "%s:%" LINE_Tf ";%s",
+                   file ? file : "?", CopLINE(PL_curcop),
+                   PL_op_name[type]);
+
+    he = hv_fetch_ent(PL_op_profile_samples, key, TRUE, 0);
+    count = HeVAL(he);
+    sv_setuv(count, SvIOK(count) ? SvUVX(count) + 1 : 1);
+
+    SvREFCNT_dec(name);
+    SvREFCNT_dec_NN(key);
+}
+
+int
+Perl_runops_profile(pTHX)
+{
+    OP *op = PL_op;
+    UV * const counts = PL_op_profile_counts;
+
+    PERL_DTRACE_PROBE_OP(op);
+    for (;;) {
+        /* grab the type now: the op may be freed by the time it returns */
+        const OPCODE type = op->op_type;
+
+        counts[type]++;
+        PL_op = op = op->op_ppaddr(aTHX);
+        if (UNLIKELY(PL_op_profile_tick)) {
+            PL_op_profile_tick = 0;
+            S_op_profile_sample(aTHX_ type);
+        }
+        if (!op)
+            break;
+        PERL_DTRACE_PROBE_OP(op);
+    }
+    PERL_ASYNC_CHECK();
+
+    TAINT_NOT;
+    return 0;
+}
+
+/*
+=for apidoc_section $debugging
+=for apidoc op_profile_start
+
+Starts the sampling op profiler.  If C<file> is not NULL, the results
+are written to it when L</op_profile_stop> is called; perl does this
+itself during interpreter destruction.  The profiler replaces
+C<PL_runops>, so it does nothing if that has already been changed
+from the default, for example by a debugger or another profiler.
+
+C<interval> is the sampling interval in microseconds of CPU time; zero
+selects the default of 1000.  On platforms without C<setitimer()> the op
+type counts are still collected, but no stack samples are taken.
+
+=for apidoc op_profile_stop
+
+Stops the op profiler and writes out its results, if a file was given
+to L</op_profile_start>.  The sampled stacks are written to that file
+one per line, in the "collapsed stack" format understood by flame graph
+tools, for example
+
+    main::parse;main::parse_line;lib/Parser.pm:42;match 17
+
+The number of times each type of op was executed is written to a
+second file with the same name plus a F<.ops> suffix.
+
+This should only be called when no ops are running.
+
+=cut
+*/
+
+void
+Perl_op_profile_start(pTHX_ const char *file, UV interval)
+{
+    PERL_ARGS_ASSERT_OP_PROFILE_START;
+
+    if (PL_runops != RUNOPS_DEFAULT)
+        return;
+
+    Newxz(PL_op_profile_counts, MAXO, UV);
+    PL_op_profile_samples = newHV();
+    PL_op_profile_file = savepv(file);
+    PL_runops = Perl_runops_profile;
+
+#ifdef PERL_OP_PROFILE_TIMER
+#  ifdef USE_ITHREADS
+    /* only the "parent" interpreter can diddle signals */
+    if (PL_curinterp == aTHX)
+#  endif
+    {
+        struct sigaction act;
+        struct itimerval it;
+
+        if (!interval)
+            interval = PERL_OP_PROFILE_INTERVAL;
+
+        act.sa_handler = S_op_profile_sighandler;
+        sigemptyset(&act.sa_mask);
+        act.sa_flags = 0;
+#  ifdef SA_RESTART
+        /* the timer mustn't make the program's own syscalls fail */
+        act.sa_flags |= SA_RESTART;
+#  endif
+        if (sigaction(SIGPROF, &act, NULL) == 0) {
+            it.it_interval.tv_sec  = interval / 1000000;
+            it.it_interval.tv_usec = interval % 1000000;
+            it.it_value = it.it_interval;
+            setitimer(ITIMER_PROF, &it, NULL);
+        }
+    }
+#else
+    PERL_UNUSED_ARG(interval);
+#endif
+}
+
+void
+Perl_op_profile_stop(pTHX)
+{
+    if (PL_runops != Perl_runops_profile)
+        return;
+
+#ifdef PERL_OP_PROFILE_TIMER
+#  ifdef USE_ITHREADS
+    if (PL_curinterp == aTHX)
+#  endif
+    {
+        struct itimerval it;
+        Zero(&it, 1, struct itimerval);
+        setitimer(ITIMER_PROF, &it, NULL);
+        /* ignoring it first discards any signal still pending */
+        (void) rsignal(SIGPROF, (Sighandler_t) SIG_IGN);
+        (void) rsignal(SIGPROF, (Sighandler_t) SIG_DFL);
+    }
+#endif
+
+    PL_runops = RUNOPS_DEFAULT;
+
+    if (PL_op_profile_file) {
+        PerlIO *fp = PerlIO_open(PL_op_profile_file, "w");
+        if (fp) {
+            HE *he;
+
+            (void) hv_iterinit(PL_op_profile_samples);
+            while ((he = hv_iternext(PL_op_profile_samples)))
+                PerlIO_printf(fp, "%" SVf " %" UVuf "\n",
+                              SVfARG(hv_iterkeysv(he)),
+                              SvUV(HeVAL(he)));
+            PerlIO_close(fp);
+        }
+
+        {
+            SV * const opsfile = Perl_newSVpvf(aTHX_ "%s.ops",
+                                               PL_op_profile_file);
+            fp = PerlIO_open(SvPVX(opsfile), "w");
+            if (fp) {
+                unsigned i;
+                for (i = 0; i < MAXO; i++) {
+                    if (PL_op_profile_counts[i])
+                        PerlIO_printf(fp, "%s %" UVuf "\n",
+                                      PL_op_name[i],
+                                      PL_op_profile_counts[i]);
+                }
+                PerlIO_close(fp);
+            }
+            SvREFCNT_dec_NN(opsfile);
+        }
+    }
+
+    Safefree(PL_op_profile_file);
+    PL_op_profile_file = NULL;
+    Safefree(PL_op_profile_counts);
+    PL_op_profile_counts = NULL;
+    SvREFCNT_dec(PL_op_profile_samples);
+    PL_op_profile_samples = NULL;
+}
+
 
 #ifdef PERL_RC_STACK
 
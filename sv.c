@@ -667,6 +667,7 @@ struct arena_desc {
     char       *arena;		/* the raw storage, allocated aligned */
     size_t      size;		/* its size ~4k typ */
     svtype	utype;		/* bodytype stored in arena */
+    U32		body_size;	/* size of each body carved from it */
 };
 
 struct arena_set;
@@ -737,6 +738,585 @@ Perl_sv_free_arenas(pTHX)
     PL_sv_root = 0;
 }
 
+/* Names of the SV types, as reported by sv_arena_stats() and
+ * sv_heap_usage() */
+
+static const char * const sv_type_names[SVt_LAST] = {
+    "NULL", "IV", "NV", "PV", "INVLIST", "PVIV", "PVNV", "PVMG",
+    "REGEXP", "PVGV", "PVLV", "PVAV", "PVHV", "PVCV", "PVFM", "PVIO",
+    "PVOBJ"
+};
+
+/*
+=for apidoc sv_arena_stats
+
+Describe the occupancy of the SV head and body arenas in C<hv>.  One
+entry is stored for each kind of arena in use, keyed by C<"SV"> for SV
+heads, C<"HE"> for hash entries, C<"HVAUX"> for hash bodies with iterator
+state, or by the short name of the SV type (C<"PV">, C<"PVHV"> ...) whose
+bodies it holds.  Each value is a reference to a hash with the keys
+C<arenas> (the number of arenas), C<slots> (the number of heads or bodies
+they hold), C<used>, C<free> (the number on the free list) and C<bytes>
+(the memory allocated for the arenas).
+
+The counts are taken before any of the entries are created, so they do not
+include the SVs used to report them.
+
+=cut
+*/
+
+void
+Perl_sv_arena_stats(pTHX_ HV *hv)
+{
+    UV arenas[PERL_ARENA_ROOTS_SIZE + 1];
+    UV slots[PERL_ARENA_ROOTS_SIZE + 1];
+    UV nfree[PERL_ARENA_ROOTS_SIZE + 1];
+    UV bytes[PERL_ARENA_ROOTS_SIZE + 1];
+    const unsigned int heads = PERL_ARENA_ROOTS_SIZE;
+    const struct arena_set *aroot;
+    const SV *sva;
+    unsigned int i;
+
+    PERL_ARGS_ASSERT_SV_ARENA_STATS;
+
+    Zero(arenas, PERL_ARENA_ROOTS_SIZE + 1, UV);
+    Zero(slots, PERL_ARENA_ROOTS_SIZE + 1, UV);
+    Zero(nfree, PERL_ARENA_ROOTS_SIZE + 1, UV);
+    Zero(bytes, PERL_ARENA_ROOTS_SIZE + 1, UV);
+
+    for (sva = PL_sv_arenaroot; sva; sva = MUTABLE_SV(SvANY(sva))) {
+        arenas[heads]++;
+        slots[heads] += SvREFCNT(sva) - 1;
+        if (!SvFAKE(sva))
+            bytes[heads] += SvREFCNT(sva) * sizeof(SV);
+    }
+    for (sva = PL_sv_root; sva; sva = (const SV *)SvARENA_CHAIN(sva))
+        nfree[heads]++;
+
+    for (aroot = (const struct arena_set *)PL_body_arenas; aroot;
+         aroot = aroot->next)
+    {
+        for (i = 0; i < aroot->curr; i++) {
+            const struct arena_desc * const adesc = &aroot->set[i];
+            arenas[adesc->utype]++;
+            slots[adesc->utype] += adesc->size / adesc->body_size;
+            bytes[adesc->utype] += adesc->size;
+        }
+    }
+    for (i = 0; i < PERL_ARENA_ROOTS_SIZE; i++) {
+        const void *body;
+        for (body = PL_body_roots[i]; body; body = *(const void * const *)body)
+            nfree[i]++;
+    }
+
+    for (i = 0; i <= PERL_ARENA_ROOTS_SIZE; i++) {
+        const char * const name = i == heads ? "SV"
+                                : i == HE_ARENA_ROOT_IX ? "HE"
+                                : i == HVAUX_ARENA_ROOT_IX ? "HVAUX"
+                                : sv_type_names[i];
+        HV *stat;
+
+        if (!arenas[i])
+            continue;
+
+        stat = newHV();
+        (void)hv_stores(stat, "arenas", newSVuv(arenas[i]));
+        (void)hv_stores(stat, "slots", newSVuv(slots[i]));
+        (void)hv_stores(stat, "used", newSVuv(slots[i] - nfree[i]));
+        (void)hv_stores(stat, "free", newSVuv(nfree[i]));
+        (void)hv_stores(stat, "bytes", newSVuv(bytes[i]));
+        (void)hv_store(hv, name, strlen(name), newRV_noinc(MUTABLE_SV(stat)), 0);
+    }
+}
+
+/* Release the SV head arenas in which every slot is on the free list,
+ * returning the number of bytes freed.  A slot that is freed but not on
+ * the list (see plant_SV()) must not be handed out again, so the list
+ * itself is the authority: SvREFCNT() of a freed head is unused, and is
+ * borrowed here to mark heads as listed (1) or doomed (2). */
+
+STATIC Size_t
+S_compact_head_arenas(pTHX)
+{
+    SV *prev = NULL;
+    SV *doomed = NULL;
+    SV *sva;
+    SV *svanext;
+    SV *sv;
+    SV *svnext;
+    Size_t released = 0;
+
+    PERL_ARGS_ASSERT_COMPACT_HEAD_ARENAS;
+
+    for (sva = PL_sv_arenaroot; sva; sva = MUTABLE_SV(SvANY(sva))) {
+        const SV * const svend = &sva[SvREFCNT(sva)];
+        for (sv = sva + 1; sv < svend; ++sv) {
+            if (SvIS_FREED(sv))
+                SvREFCNT(sv) = 0;
+        }
+    }
+    for (sv = PL_sv_root; sv; sv = MUTABLE_SV(SvARENA_CHAIN(sv)))
+        SvREFCNT(sv) = 1;
+
+    for (sva = PL_sv_arenaroot; sva; sva = svanext) {
+        const SV * const svend = &sva[SvREFCNT(sva)];
+
+        svanext = MUTABLE_SV(SvANY(sva));
+        for (sv = sva + 1; sv < svend; ++sv) {
+            if (!SvIS_FREED(sv) || SvREFCNT(sv) != 1)
+                break;
+        }
+        if (sv < svend || SvFAKE(sva)) {
+            prev = sva;
+            continue;
+        }
+
+        for (sv = sva + 1; sv < svend; ++sv)
+            SvREFCNT(sv) = 2;
+        if (prev)
+            SvANY(prev) = (void *)svanext;
+        else
+            PL_sv_arenaroot = svanext;
+        SvANY(sva) = (void *)doomed;
+        doomed = sva;
+    }
+
+    /* Rebuild the free list in its original order, less the doomed heads */
+    prev = NULL;
+    for (sv = PL_sv_root; sv; sv = svnext) {
+        svnext = MUTABLE_SV(SvARENA_CHAIN(sv));
+        if (SvREFCNT(sv) == 2)
+            continue;
+        SvREFCNT(sv) = 0;
+        if (prev)
+            SvARENA_CHAIN_SET(prev, sv);
+        else
+            PL_sv_root = sv;
+        prev = sv;
+    }
+    if (prev)
+        SvARENA_CHAIN_SET(prev, NULL);
+    else
+        PL_sv_root = NULL;
+
+    while ((sva = doomed)) {
+        doomed = MUTABLE_SV(SvANY(sva));
+        released += SvREFCNT(sva) * sizeof(SV);
+        Safefree(sva);
+    }
+    return released;
+}
+
+/* Release the body arenas in which every body is on its free list,
+ * returning the number of bytes freed.  Free bodies carry no marks of
+ * their own, so the arenas are sorted by address and each free body is
+ * located by binary search to count the free bodies in every arena. */
+
+STATIC Size_t
+S_compact_body_arenas(pTHX)
+{
+    struct arena_set *aroot;
+    struct arena_set **setp;
+    struct arena_desc **descs;
+    U32 *nfree;
+    Size_t ndescs = 0;
+    Size_t gap;
+    Size_t i;
+    Size_t released = 0;
+    bool any_doomed = FALSE;
+    unsigned int type;
+
+    PERL_ARGS_ASSERT_COMPACT_BODY_ARENAS;
+
+    for (aroot = (struct arena_set *)PL_body_arenas; aroot; aroot = aroot->next)
+        ndescs += aroot->curr;
+    if (!ndescs)
+        return 0;
+
+    Newx(descs, ndescs, struct arena_desc *);
+    Newxz(nfree, ndescs, U32);
+    i = 0;
+    for (aroot = (struct arena_set *)PL_body_arenas; aroot; aroot = aroot->next) {
+        unsigned int j;
+        for (j = 0; j < aroot->curr; j++)
+            descs[i++] = &aroot->set[j];
+    }
+
+    for (gap = ndescs / 2; gap; gap /= 2) {
+        for (i = gap; i < ndescs; i++) {
+            struct arena_desc * const adesc = descs[i];
+            Size_t j = i;
+            while (j >= gap
+                   && PTR2UV(descs[j - gap]->arena) > PTR2UV(adesc->arena)) {
+                descs[j] = descs[j - gap];
+                j -= gap;
+            }
+            descs[j] = adesc;
+        }
+    }
+
+#define FIND_BODY_ARENA(body, ix) STMT_START {                          \
+        Size_t lo_ = 0, hi_ = ndescs;                                   \
+        while (hi_ - lo_ > 1) {                                         \
+            const Size_t mid_ = (lo_ + hi_) / 2;                        \
+            if (PTR2UV(descs[mid_]->arena) <= PTR2UV(body))             \
+                lo_ = mid_;                                             \
+            else                                                        \
+                hi_ = mid_;                                             \
+        }                                                               \
+        (ix) = lo_;                                                     \
+        assert(PTR2UV(body) >= PTR2UV(descs[ix]->arena));               \
+        assert(PTR2UV(body) < PTR2UV(descs[ix]->arena) + descs[ix]->size); \
+    } STMT_END
+
+    for (type = 0; type < PERL_ARENA_ROOTS_SIZE; type++) {
+        void *body;
+        for (body = PL_body_roots[type]; body; body = *(void **)body) {
+            Size_t ix;
+            FIND_BODY_ARENA(body, ix);
+            assert(descs[ix]->utype == type);
+            nfree[ix]++;
+        }
+    }
+
+    for (i = 0; i < ndescs; i++) {
+        if (nfree[i] == descs[i]->size / descs[i]->body_size)
+            any_doomed = TRUE;
+        else
+            nfree[i] = 0;
+    }
+
+    if (any_doomed) {
+        for (type = 0; type < PERL_ARENA_ROOTS_SIZE; type++) {
+            void **link = &PL_body_roots[type];
+            void *body = *link;
+            while (body) {
+                void * const next = *(void **)body;
+                Size_t ix;
+                FIND_BODY_ARENA(body, ix);
+                if (!nfree[ix]) {
+                    *link = body;
+                    link = (void **)body;
+                }
+                body = next;
+            }
+            *link = NULL;
+        }
+
+        for (i = 0; i < ndescs; i++) {
+            if (nfree[i]) {
+                released += descs[i]->size;
+                Safefree(descs[i]->arena);
+                descs[i]->arena = NULL;
+            }
+        }
+
+        /* Close up the gaps in each arena set, and free the sets left
+           empty.  Only the first set is ever appended to, so gaps in the
+           others are merely unused until they are freed. */
+        setp = (struct arena_set **)&PL_body_arenas;
+        while ((aroot = *setp)) {
+            unsigned int from;
+            unsigned int to = 0;
+            for (from = 0; from < aroot->curr; from++) {
+                if (aroot->set[from].arena)
+                    aroot->set[to++] = aroot->set[from];
+            }
+            for (from = to; from < aroot->curr; from++)
+                aroot->set[from].arena = NULL;
+            aroot->curr = to;
+            if (to) {
+                setp = &aroot->next;
+            }
+            else {
+                *setp = aroot->next;
+                Safefree(aroot);
+            }
+        }
+    }
+
+#undef FIND_BODY_ARENA
+
+    Safefree(nfree);
+    Safefree(descs);
+    return released;
+}
+
+/*
+=for apidoc sv_compact_arenas
+
+Return to the system the SV head and body arenas that no longer hold any
+live SV heads, bodies or hash entries, and return the number of bytes
+released.  The arenas grow to fit the peak number of SVs a program has
+held at once, and are otherwise only freed by C<sv_free_arenas()> at
+interpreter destruction, so a long-running process can call this after a
+transient spike in memory use.
+
+The time taken is proportional to the number of arenas and free slots.
+The free lists are rebuilt in their original order, less the slots in the
+released arenas.  Nothing is done during global destruction, when freed SV
+heads may still be referenced.
+
+=cut
+*/
+
+Size_t
+Perl_sv_compact_arenas(pTHX)
+{
+    PERL_ARGS_ASSERT_SV_COMPACT_ARENAS;
+
+    if (PL_phase == PERL_PHASE_DESTRUCT)
+        return 0;
+
+    return compact_head_arenas() + compact_body_arenas();
+}
+
+/* The memory held by a single SV: its head, its body, and the buffer or
+ * array that it owns, but nothing that it merely refers to.  A buffer
+ * shared by copy-on-write is counted in full for each SV sharing it. */
+
+STATIC Size_t
+S_sv_heap_size(pTHX_ const SV * const sv)
+{
+    const svtype type = SvTYPE(sv);
+    Size_t size = sizeof(SV);
+
+    PERL_ARGS_ASSERT_SV_HEAP_SIZE;
+
+    if (type == SVt_PVHV && HvHasAUX(sv))
+        size += fake_hv_with_aux.body_size;
+    else
+        size += bodies_by_type[type].body_size;
+
+    switch (type) {
+    case SVt_PVAV:
+        if (AvALLOC(sv))
+            size += (AvMAX(sv) + 1 + (AvARRAY(sv) - AvALLOC(sv)))
+                    * sizeof(SV *);
+        break;
+    case SVt_PVHV:
+        if (HvARRAY(sv))
+            size += (HvMAX(sv) + 1) * sizeof(HE *)
+                    + HvTOTALKEYS(sv) * sizeof(HE);
+        break;
+    case SVt_PVOBJ:
+        if (ObjectFIELDS(sv))
+            size += (ObjectMAXFIELD(sv) + 1) * sizeof(SV *);
+        break;
+    case SVt_REGEXP:
+    case SVt_PVIO:
+        break;
+    case SVt_PVGV:
+    case SVt_PVLV:
+        if (isGV_with_GP(sv))
+            break;
+        /* FALLTHROUGH */
+    default:
+        if (type >= SVt_PV && !SvROK(sv))
+            size += SvLEN(sv);
+        break;
+    }
+    return size;
+}
+
+/*
+=for apidoc sv_heap_usage
+
+Account for the memory held by every live SV, by scanning the SV arenas.
+Each of the hashes passed in that is not C<NULL> is filled with entries
+whose values are references to hashes with the keys C<count> and C<bytes>:
+
+C<by_type> is keyed by SV type (C<"PV">, C<"PVHV"> ...), and covers every
+SV.
+
+C<by_package> is keyed by package name, and covers the objects blessed
+into each package.
+
+C<by_pad> is keyed by subroutine name, and covers the pads of each
+subroutine at every recursion depth: the pads themselves and the lexicals,
+temporaries and constants in them.  C<count> is the number of pad entries.
+Anonymous subroutines of the same package share a name, so their pads are
+added together, and so are the pads of the main program under C<"(main)">
+and of string C<eval>s under C<"(eval)">.
+
+The bytes of an SV are those of its head and body, and of the string
+buffer, array or bucket array it owns.  Memory that is only referred to by
+an SV, such as the elements of an array, the compiled form of a subroutine
+or regular expression, or shared hash keys, is not included.  A string
+buffer shared by copy-on-write is counted for each SV sharing it.  Entries
+are added to any already present in the hashes, and the SVs created to
+report the results are not counted.
+
+=cut
+*/
+
+void
+Perl_sv_heap_usage(pTHX_ HV *by_type, HV *by_package, HV *by_pad)
+{
+    struct heap_usage {
+        const SV *owner;        /* stash or CV */
+        UV count;
+        UV bytes;
+    };
+    UV type_count[SVt_LAST];
+    UV type_bytes[SVt_LAST];
+    PTR_TBL_t * const owners = ptr_table_new();
+    struct heap_usage *usage = NULL;
+    Size_t nusage = 0;
+    Size_t maxusage = 0;
+    const SV *sva;
+    Size_t i;
+
+    PERL_ARGS_ASSERT_SV_HEAP_USAGE;
+
+    Zero(type_count, SVt_LAST, UV);
+    Zero(type_bytes, SVt_LAST, UV);
+
+    /* Find or add the totals for a stash or CV.  Their index is stored
+       in the table offset by one, to tell it apart from a missing entry. */
+#define HEAP_USAGE_ADD(own, cnt, size) STMT_START {                     \
+        Size_t ix_ = PTR2nat(ptr_table_fetch(owners, (own)));           \
+        if (!ix_) {                                                     \
+            if (nusage == maxusage) {                                   \
+                maxusage = maxusage ? maxusage * 2 : 64;                \
+                Renew(usage, maxusage, struct heap_usage);              \
+            }                                                           \
+            usage[nusage].owner = (own);                                \
+            usage[nusage].count = 0;                                    \
+            usage[nusage].bytes = 0;                                    \
+            ix_ = ++nusage;                                             \
+            ptr_table_store(owners, (own), INT2PTR(void *, ix_));       \
+        }                                                               \
+        usage[ix_ - 1].count += (cnt);                                  \
+        usage[ix_ - 1].bytes += (size);                                 \
+    } STMT_END
+
+    for (sva = PL_sv_arenaroot; sva; sva = MUTABLE_SV(SvANY(sva))) {
+        const SV * const svend = &sva[SvREFCNT(sva)];
+        const SV *sv;
+
+        for (sv = sva + 1; sv < svend; ++sv) {
+            const svtype type = SvTYPE(sv);
+            Size_t size;
+
+            if (SvIS_FREED(sv) || !SvREFCNT(sv))
+                continue;
+
+            size = sv_heap_size(sv);
+            type_count[type]++;
+            type_bytes[type] += size;
+
+            if (by_package && SvOBJECT(sv))
+                HEAP_USAGE_ADD((const SV *)SvSTASH(sv), 1, size);
+
+            if (by_pad && type == SVt_PVCV && !CvISXSUB(sv) && CvPADLIST(sv)) {
+                const PADLIST * const padlist = CvPADLIST(sv);
+                UV count = 0;
+                UV bytes = 0;
+                SSize_t depth;
+
+                for (depth = 1; depth <= PadlistMAX(padlist); depth++) {
+                    const PAD * const pad = PadlistARRAY(padlist)[depth];
+                    SSize_t ix;
+
+                    if (!pad)
+                        continue;
+                    bytes += sv_heap_size((const SV *)pad);
+                    for (ix = 0; ix <= PadMAX(pad); ix++) {
+                        const SV * const padsv = PadARRAY(pad)[ix];
+                        if (padsv && !SvIS_FREED(padsv)) {
+                            count++;
+                            bytes += sv_heap_size(padsv);
+                        }
+                    }
+                }
+                HEAP_USAGE_ADD(sv, count, bytes);
+            }
+        }
+    }
+
+#undef HEAP_USAGE_ADD
+
+    if (by_type) {
+        for (i = 0; i < SVt_LAST; i++) {
+            if (type_count[i])
+                heap_usage_store(by_type, sv_type_names[i],
+                                 strlen(sv_type_names[i]), FALSE,
+                                 type_count[i], type_bytes[i]);
+        }
+    }
+
+    for (i = 0; i < nusage; i++) {
+        const SV * const owner = usage[i].owner;
+        const char *name;
+        STRLEN len;
+        bool utf8 = FALSE;
+
+        if (SvTYPE(owner) == SVt_PVHV) {
+            HV * const stash = (HV *)owner;
+            if (HvNAME_get(stash)) {
+                name = HvNAME_get(stash);
+                len = HvNAMELEN_get(stash);
+                utf8 = cBOOL(HvNAMEUTF8(stash));
+            }
+            else {
+                name = "__ANON__";
+                len = STRLENs("__ANON__");
+            }
+            heap_usage_store(by_package, name, len, utf8,
+                             usage[i].count, usage[i].bytes);
+        }
+        else {
+            CV * const cv = (CV *)owner;
+            if (cv == PL_main_cv) {
+                name = "(main)";
+                len = STRLENs("(main)");
+            }
+            else if (CvEVAL(cv) || (!CvNAMED(cv) && !CvGV(cv))) {
+                name = "(eval)";
+                len = STRLENs("(eval)");
+            }
+            else {
+                SV * const namesv = cv_name(cv, NULL, 0);
+                name = SvPVX(namesv);
+                len = SvCUR(namesv);
+                utf8 = cBOOL(SvUTF8(namesv));
+            }
+            heap_usage_store(by_pad, name, len, utf8,
+                             usage[i].count, usage[i].bytes);
+        }
+    }
+
+    Safefree(usage);
+    ptr_table_free(owners);
+}
+
+/* Add a count and a number of bytes to the entry for name in hv, as
+ * reported by sv_heap_usage() */
+
+STATIC void
+S_heap_usage_store(pTHX_ HV *hv, const char *name, STRLEN len, bool utf8,
+                   UV count, UV bytes)
+{
+    SV ** const svp = hv_fetch(hv, name, utf8 ? -(I32)len : (I32)len, 1);
+    HV *entry;
+    SV **fieldp;
+
+    PERL_ARGS_ASSERT_HEAP_USAGE_STORE;
+
+    if (SvROK(*svp) && SvTYPE(SvRV(*svp)) == SVt_PVHV)
+        entry = MUTABLE_HV(SvRV(*svp));
+    else {
+        entry = newHV();
+        sv_setrv_noinc(*svp, MUTABLE_SV(entry));
+    }
+
+    fieldp = hv_fetchs(entry, "count", 1);
+    sv_setuv(*fieldp, (SvOK(*fieldp) ? SvUV(*fieldp) : 0) + count);
+    fieldp = hv_fetchs(entry, "bytes", 1);
+    sv_setuv(*fieldp, (SvOK(*fieldp) ? SvUV(*fieldp) : 0) + bytes);
+}
+
 /*
   Historically, here were mid-level routines that manage the
   allocation of bodies out of the various arenas. Some of these
@@ -900,6 +1480,7 @@ Perl_more_bodies (pTHX_ const svtype sv_type, const size_t body_size,
     Newx(adesc->arena, good_arena_size, char);
     adesc->size = good_arena_size;
     adesc->utype = sv_type;
+    adesc->body_size = (U32)body_size;
     DEBUG_m(PerlIO_printf(Perl_debug_log, "arena %d added: %p size %" UVuf "\n",
                           curr, (void*)adesc->arena, (UV)good_arena_size));
 
@@ -1349,8 +1930,9 @@ Perl_sv_backoff(SV *const sv)
 }
 
 
-/* forward declaration */
+/* forward declarations */
 static void S_sv_uncow(pTHX_ SV * const sv, const U32 flags);
+static void S_sv_unview(pTHX_ SV *const sv, const U32 flags);
 
 
 /*
@@ -1386,6 +1968,7 @@ Perl_sv_grow(pTHX_ SV *const sv, STRLEN newlen)
     else
     {
         if (SvIsCOW(sv)) S_sv_uncow(aTHX_ sv, 0);
+        else if (SvVIEW_mg(sv)) S_sv_unview(aTHX_ sv, 0);
         s = SvPVX_mutable(sv);
     }
 
@@ -3626,6 +4209,9 @@ Perl_sv_utf8_downgrade_flags(pTHX_ SV *const sv, const bool fail_ok, const U32 f
             if (SvIsCOW(sv)) {
                 S_sv_uncow(aTHX_ sv, 0);
             }
+            else if (SvVIEW_mg(sv)) {
+                S_sv_unview(aTHX_ sv, 0);
+            }
             if (SvTYPE(sv) >= SVt_PVMG && SvMAGIC(sv)) {
                 /* update pos */
                 MAGIC * mg = mg_find(sv, PERL_MAGIC_regex_global);
@@ -4534,6 +5120,7 @@ Perl_sv_setsv_flags(pTHX_ SV *dsv, SV* ssv, const I32 flags)
     else if (sflags & SVp_POK) {
         const STRLEN cur = SvCUR(ssv);
         const STRLEN len = SvLEN(ssv);
+        const MAGIC *vmg;
 
         /*
          * We have three basic ways to copy the string:
@@ -4692,6 +5279,18 @@ Perl_sv_setsv_flags(pTHX_ SV *dsv, SV* ssv, const I32 flags)
             SvLEN_set(dsv, len);
             SvCUR_set(dsv, cur);
             SvIsCOW_on(dsv);
+        }
+        else if (flags & SV_COW_SHARED_HASH_KEYS && !len
+                 && SvTYPE(dsv) <= SVt_PVMG
+                 && (vmg = SvVIEW_mg(ssv))) {
+            /* Share the buffer ssv is a view of */
+            if (SvPVX_const(dsv)) {     /* we know that dtype >= SVt_PV */
+                SvPV_free(dsv);
+            }
+            SvPV_set(dsv, SvPVX(ssv));
+            SvLEN_set(dsv, 0);
+            SvCUR_set(dsv, cur);
+            sv_magicext(dsv, vmg->mg_obj, PERL_MAGIC_view, NULL, NULL, 0);
         } else {
             /* Failed the swipe test, and we cannot do copy-on-write either.
                Have to copy the string.  */
@@ -5140,6 +5739,101 @@ Perl_sv_setpv_mg(pTHX_ SV *const sv, const char *const ptr)
     SvSETMAGIC(sv);
 }
 
+/*
+=for apidoc sv_setpv_view
+
+Sets C<dsv> to the end of the string in C<ssv>, from byte C<offset>
+onwards, like C<sv_setpvn(dsv, SvPVX(ssv) + offset, SvCUR(ssv) - offset)>.
+C<ssv> must be C<SvPOK>.
+
+If that is long enough, and at least half of the buffer holding it, the
+bytes aren't copied: C<dsv> becomes a view of them, with C<PERL_MAGIC_view>
+magic holding a copy-on-write copy of C<ssv> that keeps the buffer alive.
+Writing to C<dsv> gives it a copy of its own, as with any copy-on-write
+string, through C<sv_force_normal_flags>; copying it with C<sv_setsv>
+shares the buffer again.  A view still ends with the C<NUL> of the whole
+buffer, which is why only the end of a string can be shared.
+
+As with C<sv_setpvn>, the UTF-8 flag is not changed, and no 'set' magic is
+called.
+
+=cut
+*/
+
+#ifndef PERL_VIEW_THRESHOLD
+#  define PERL_VIEW_THRESHOLD 4096  /* share iff len >= K */
+#endif
+
+void
+Perl_sv_setpv_view(pTHX_ SV *const dsv, SV *const ssv, const STRLEN offset)
+{
+    const STRLEN len = SvCUR(ssv) - offset;
+
+    PERL_ARGS_ASSERT_SV_SETPV_VIEW;
+    assert(SvPOK(ssv));
+    assert(offset <= SvCUR(ssv));
+
+#ifdef PERL_ANY_COW
+    if (len >= PERL_VIEW_THRESHOLD && dsv != ssv
+        && SvTYPE(dsv) <= SVt_PVMG && !SvREADONLY(dsv))
+    {
+        const char * const pv = SvPVX_const(ssv) + offset;
+        const MAGIC * const mg = SvVIEW_mg(ssv);
+        SV *owner = NULL;
+
+        /* a view of a view shares the buffer of the first one */
+        if (mg) {
+            if (len * 2 >= SvCUR(mg->mg_obj))
+                owner = SvREFCNT_inc_simple_NN(mg->mg_obj);
+        }
+        else if (len * 2 >= SvCUR(ssv) && SvCANCOW(ssv))
+            owner = sv_setsv_cow(NULL, ssv);
+
+        if (owner) {
+            SV_CHECK_THINKFIRST_COW_DROP(dsv);
+            SvUPGRADE(dsv, SVt_PVMG);
+            SvPV_free(dsv);
+            SvPV_set(dsv, (char *)pv);
+            SvCUR_set(dsv, len);
+            SvLEN_set(dsv, 0);
+            (void)SvPOK_only_UTF8(dsv);
+            sv_magicext(dsv, owner, PERL_MAGIC_view, NULL, NULL, 0);
+            SvREFCNT_dec_NN(owner);
+            SvTAINT(dsv);
+            return;
+        }
+    }
+#endif
+    sv_setpvn(dsv, SvPVX_const(ssv) + offset, len);
+}
+
+/* Give a view made by sv_setpv_view() a copy of its string, or with
+ * SV_COW_DROP_PV, no string, and let go of the buffer it shared */
+
+static void
+S_sv_unview(pTHX_ SV *const sv, const U32 flags)
+{
+    MAGIC * const mg = mg_find(sv, PERL_MAGIC_view);
+    SV * const owner = SvREFCNT_inc_simple_NN(mg->mg_obj);
+    const char * const pvx = SvPVX_const(sv);
+    const STRLEN cur = SvCUR(sv);
+
+    /* the magic must be gone before growing sv, or sv_grow() would
+     * come back here */
+    sv_unmagic(sv, PERL_MAGIC_view);
+    SvPV_set(sv, NULL);
+    SvCUR_set(sv, 0);
+    if (flags & SV_COW_DROP_PV)
+        SvPOK_off(sv);
+    else {
+        SvGROW(sv, cur + 1);
+        Move(pvx, SvPVX(sv), cur, char);
+        SvCUR_set(sv, cur);
+        *SvEND(sv) = '\0';
+    }
+    SvREFCNT_dec_NN(owner);
+}
+
 void
 Perl_sv_sethek(pTHX_ SV *const sv, const HEK *const hek)
 {
@@ -5469,6 +6163,7 @@ Perl_sv_force_normal_flags(pTHX_ SV *const sv, const U32 flags)
         SvREFCNT_dec_NN(temp);
     }
     else if (SvVOK(sv)) sv_unmagic(sv, PERL_MAGIC_vstring);
+    else if (SvVIEW_mg(sv)) S_sv_unview(aTHX_ sv, flags);
 }
 
 /*
@@ -8622,6 +9317,40 @@ S_sv_gets_append_to_utf8(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
     return (SvCUR(sv) - append) ? SvPVX(sv) : NULL;
 }
 
+/* In paragraph mode, skip the newlines before or after a paragraph,
+ * straight from the read-ahead buffer if the layer allows it, rather than
+ * with a getc() and ungetc() for each.  Returns false at end of file. */
+
+static bool
+S_sv_gets_skip_newlines(pTHX_ PerlIO *const fp)
+{
+    for (;;) {
+        int i;
+
+        if (PerlIO_fast_gets(fp)) {
+            const SSize_t cnt = PerlIO_get_cnt(fp);
+            if (cnt > 0) {
+                STDCHAR *ptr = (STDCHAR*)PerlIO_get_ptr(fp);
+                STDCHAR * const end = ptr + cnt;
+                while (ptr < end && *ptr == '\n')
+                    ptr++;
+                PerlIO_set_ptrcnt(fp, ptr, end - ptr);
+                if (ptr < end)
+                    return TRUE;
+            }
+        }
+        if (PerlIO_eof(fp))
+            return FALSE;
+        i = PerlIO_getc(fp);
+        if (i != '\n') {
+            if (i == EOF)
+                return FALSE;
+            PerlIO_ungetc(fp,i);
+            return TRUE;
+        }
+    }
+}
+
 static char *
 S_sv_gets_read_record(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
 {
@@ -8852,17 +9581,8 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
 
     if (rspara) {        /* have to do this both before and after */
                          /* to make sure file boundaries work right */
-        while (1) {
-            if (PerlIO_eof(fp))
-                return 0;
-            i = PerlIO_getc(fp);
-            if (i != '\n') {
-                if (i == -1)
-                    return 0;
-                PerlIO_ungetc(fp,i);
-                break;
-            }
-        }
+        if (!S_sv_gets_skip_newlines(aTHX_ fp))
+            return 0;
     }
 
     /* See if we know enough about I/O mechanism to cheat it ! */
@@ -8891,11 +9611,6 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
     STDCHAR *ptr;       /* pointer into fp's read-ahead buffer */
     STRLEN bpx;         /* length of the data in the target sv
                            used to fix pointers after a SvGROW */
-    I32 shortbuffered;  /* If the pv buffer is shorter than the amount
-                           of data left in the read-ahead buffer.
-                           If 0 then the pv buffer can hold the full
-                           amount left, otherwise this is the amount it
-                           can hold. */
 
     /* Here is some breathtakingly efficient cheating */
 
@@ -8919,35 +9634,37 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
      * 1. When we first enter the loop we do some memory book keeping to see
      * how much free space there is in the target SV. (This sub assumes that
      * it is operating on the same SV most of the time via $_ and that it is
-     * going to be able to reuse the same pv buffer each call.) If there is
-     * "enough" room then we set "shortbuffered" to how much space there is
-     * and start reading forward.
+     * going to be able to reuse the same pv buffer each call.) Without a
+     * separator it must be able to hold the whole read-ahead buffer; with
+     * one, we only need to know it has a buffer at all.
      *
-     * 2. When we scan forward we copy from the read-ahead buffer to the target
-     * SV's pv buffer. While we go we watch for the end of the read-ahead buffer,
-     * and the end of the of pv, as well as for the "rslast", which is the last
-     * char of the separator.
+     * 2. When we scan forward we memchr() the read-ahead buffer for "rslast",
+     * which is the last char of the separator. For a longer separator, if
+     * the rest of it is in the read-ahead buffer as well we check it there,
+     * and keep looking if it doesn't match. Then the sv is grown to fit if
+     * need be, and the bytes up to and including rslast, or all of them if
+     * there wasn't one, are copied in one go.
      *
-     * 3. When scanning forward if we see rslast then we jump backwards in *pv*
-     * (which has a "complete" record up to the point we saw rslast) and check
-     * it to see if it matches the separator. If it does we are done. If it doesn't
-     * we continue on with the scan/copy.
+     * 3. If we saw rslast then we jump backwards in *pv* (which has a
+     * "complete" record up to the point we saw rslast) and check it to see
+     * if it matches the separator, which matters when it started in a
+     * previous read-ahead buffer. If it does we are done. If it doesn't we
+     * continue on with the scan/copy.
      *
      * 4. If we run out of read-ahead buffer (cnt goes to 0) then we have to get
      * the IO system to read the next buffer. We do this by doing a getc(), which
      * returns a single char read (or EOF), and prefills the buffer, and also
-     * allows us to find out how full the buffer is.  We use this information to
-     * SvGROW() the sv to the size remaining in the buffer, after which we copy
-     * the returned single char into the target sv, and then go back into scan
-     * forward mode.
-     *
-     * 5. If we run out of write-buffer then we SvGROW() it by the size of the
-     * remaining space in the read-buffer.
+     * allows us to find out how full the buffer is.  Without a separator we
+     * use this information to SvGROW() the sv to the size remaining in the
+     * buffer, after which we copy the returned single char into the target
+     * sv, and then go back into scan forward mode.
      *
      * Note that this code despite its twisty-turny nature is pretty darn slick.
      * It manages single byte separators, multi-byte cross boundary separators,
-     * and cross-read-buffer separators cleanly and efficiently at the cost
-     * of potentially greatly overallocating the target SV.
+     * and cross-read-buffer separators cleanly and efficiently. Since the sv
+     * is only grown once the length of the record is known, a short line
+     * from a handle with a large read-ahead buffer, such as an in-memory
+     * file, doesn't make it allocate the rest of that buffer.
      *
      * Yves
      */
@@ -8958,26 +9675,16 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
     cnt = PerlIO_get_cnt(fp);
 
     /* make sure we have the room */
-    if ((I32)(SvLEN(sv) - append) <= cnt + 1) {
-        /* Not room for all of it
-           if we are looking for a separator and room for some
-         */
-        if (rslen && cnt > 80 && (I32)SvLEN(sv) > append) {
-            /* just process what we have room for */
-            shortbuffered = cnt - SvLEN(sv) + append + 1;
-            cnt -= shortbuffered;
-        }
-        else {
-            /* ensure that the target sv has enough room to hold
-             * the rest of the read-ahead buffer */
-            shortbuffered = 0;
-            /* remember that cnt can be negative */
-            SvGROW(sv, (STRLEN)(append + (cnt <= 0 ? 2 : (cnt + 1))));
-        }
+    if (rslen) {
+        /* the sv is grown as needed once we know how long the record is */
+        if (SvLEN(sv) < (STRLEN)append + 2)
+            SvGROW(sv, (STRLEN)append + 2);
     }
-    else {
-        /* we have enough room to hold the full buffer, lets scream */
-        shortbuffered = 0;
+    else if ((I32)(SvLEN(sv) - append) <= cnt + 1) {
+        /* ensure that the target sv has enough room to hold
+         * the rest of the read-ahead buffer */
+        /* remember that cnt can be negative */
+        SvGROW(sv, (STRLEN)(append + (cnt <= 0 ? 2 : (cnt + 1))));
     }
 
     /* extract the pointer to sv's string buffer, offset by append as necessary */
@@ -9001,26 +9708,31 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
             /* if there is a separator */
             if (rslen) {
                 /* find next rslast */
-                STDCHAR *p;
-
-                /* shortcut common case of blank line */
-                cnt--;
-                if ((*bp++ = *ptr++) == rslast)
-                    goto thats_all_folks;
+                STDCHAR *p = (STDCHAR *)memchr(ptr, rslast, cnt);
+                SSize_t got;
+
+                /* check the rest of a longer separator where it is, unless
+                 * it may have started in what we already copied */
+                if (rslen > 1) {
+                    while (p && p - ptr >= (SSize_t)rslen - 1
+                             && memNE(p - (rslen - 1), rsptr, rslen - 1))
+                        p = (STDCHAR *)memchr(p + 1, rslast,
+                                              cnt - (p + 1 - ptr));
+                }
 
-                p = (STDCHAR *)memchr(ptr, rslast, cnt);
-                if (p) {
-                    SSize_t got = p - ptr + 1;
-                    Copy(ptr, bp, got, STDCHAR);
-                    ptr += got;
-                    bp  += got;
-                    cnt -= got;
-                    goto thats_all_folks;
+                got = p ? p - ptr + 1 : cnt;
+                bpx = bp - (STDCHAR*)SvPVX_const(sv);
+                if (bpx + got >= SvLEN(sv)) {
+                    SvCUR_set(sv, bpx);     /* box up before relocation */
+                    SvGROW(sv, bpx + got + 1);
+                    bp = (STDCHAR*)SvPVX_const(sv) + bpx;
                 }
-                Copy(ptr, bp, cnt, STDCHAR);
-                ptr += cnt;
-                bp  += cnt;
-                cnt = 0;
+                Copy(ptr, bp, got, STDCHAR);
+                ptr += got;
+                bp  += got;
+                cnt -= got;
+                if (p)
+                    goto thats_all_folks;
             }
             else {
                 /* no separator, slurp the full buffer */
@@ -9028,25 +9740,9 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
                 bp += cnt;			     /* screams  |  dust */
                 ptr += cnt;			     /* louder   |  sed :-) */
                 cnt = 0;
-                assert (!shortbuffered);
-                goto cannot_be_shortbuffered;
             }
         }
 
-        if (shortbuffered) {		/* oh well, must extend */
-            /* we didn't have enough room to fit the line into the target buffer
-             * so we must extend the target buffer and keep going */
-            cnt = shortbuffered;
-            shortbuffered = 0;
-            bpx = bp - (STDCHAR*)SvPVX_const(sv); /* box up before relocation */
-            SvCUR_set(sv, bpx);
-            /* extned the target sv's buffer so it can hold the full read-ahead buffer */
-            SvGROW(sv, SvLEN(sv) + append + cnt + 2);
-            bp = (STDCHAR*)SvPVX_const(sv) + bpx; /* unbox after relocation */
-            continue;
-        }
-
-    cannot_be_shortbuffered:
         /* we need to refill the read-ahead buffer if possible */
 
         DEBUG_P(PerlIO_printf(Perl_debug_log,
@@ -9091,7 +9787,7 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
         /* make sure we have enough space in the target sv */
         bpx = bp - (STDCHAR*)SvPVX_const(sv);	/* box up before relocation */
         SvCUR_set(sv, bpx);
-        SvGROW(sv, bpx + cnt + 2);
+        SvGROW(sv, bpx + (rslen ? 0 : cnt) + 2);
         bp = (STDCHAR*)SvPVX_const(sv) + bpx;	/* unbox after relocation */
 
         /* copy of the char we got from getc() */
@@ -9109,8 +9805,6 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
           memNE((char*)bp - rslen, rsptr, rslen))
         goto screamer;				/* go back to the fray */
   thats_really_all_folks:
-    if (shortbuffered)
-        cnt += shortbuffered;
     DEBUG_P(PerlIO_printf(Perl_debug_log,
          "Screamer: quitting, ptr=%" UVuf ", cnt=%" IVdf "\n",PTR2UV(ptr),(IV)cnt));
     PerlIO_set_ptrcnt(fp, (STDCHAR*)ptr, cnt);	/* put these back or we're in trouble */
@@ -9179,15 +9873,9 @@ Perl_sv_gets(pTHX_ SV *const sv, PerlIO *const fp, I32 append)
 
     }
 
-    if (rspara) {		/* have to do this both before and after */
-        while (i != EOF) {	/* to make sure file boundaries work right */
-            i = PerlIO_getc(fp);
-            if (i != '\n') {
-                PerlIO_ungetc(fp,i);
-                break;
-            }
-        }
-    }
+    if (rspara && i != EOF)	/* have to do this both before and after */
+        (void)S_sv_gets_skip_newlines(aTHX_ fp); /* to make sure file
+                                                  * boundaries work right */
 
     return (SvCUR(sv) - append) ? SvPVX(sv) : NULL;
 }
@@ -14436,6 +15124,8 @@ Perl_ptr_table_free(pTHX_ PTR_TBL_t *const tbl)
 void
 Perl_rvpv_dup(pTHX_ SV *const dsv, const SV *const ssv, CLONE_PARAMS *const param)
 {
+    const MAGIC *mg;
+
     PERL_ARGS_ASSERT_RVPV_DUP;
 
     assert(!isREGEXP(ssv));
@@ -14471,6 +15161,13 @@ Perl_rvpv_dup(pTHX_ SV *const dsv, const SV *const ssv, CLONE_PARAMS *const para
                          HEK_KEY(hek_dup(SvSHARED_HEK_FROM_PV(SvPVX_const(ssv)),
                                          param)));
             }
+            else if (SvTYPE(ssv) == SVt_PVMG && SvRMAGICAL(ssv)
+                     && (mg = mg_find(ssv, PERL_MAGIC_view))) {
+                /* A view - point into the clone of the buffer it shares */
+                const SV * const owner = mg->mg_obj;
+                SvPV_set(dsv, SvPVX(sv_dup(owner, param))
+                              + (SvPVX_const(ssv) - SvPVX_const(owner)));
+            }
             else {
                 /* Some other special case - random pointer */
                 SvPV_set(dsv, (char *) SvPVX_const(ssv));
@@ -14528,6 +15225,9 @@ S_sv_dup_hvaux(pTHX_ const SV *const ssv, SV *dsv, CLONE_PARAMS *const param)
     daux->xhv_name_count = saux->xhv_name_count;
 
     daux->xhv_aux_flags = saux->xhv_aux_flags;
+#ifdef PERL_HV_INCREMENTAL_SPLIT
+    daux->xhv_split_pending = saux->xhv_split_pending;
+#endif
 #ifdef PERL_HASH_RANDOMIZE_KEYS
     daux->xhv_rand = saux->xhv_rand;
     daux->xhv_last_rand = saux->xhv_last_rand;
@@ -15764,6 +16464,12 @@ perl_clone_using(PerlInterpreter *proto_perl, UV flags,
     PL_regmatch_slab	= NULL;
     PL_reg_curpm	= NULL;
 
+    /* each interpreter has its own cache of compiled patterns, of the
+     * same size as its parent's */
+    PL_re_cache = NULL;
+    if (proto_perl->Ire_cache)
+        re_cache_resize(proto_perl->Ire_cache->size);
+
     PL_sub_generation	= proto_perl->Isub_generation;
 
     /* funky return mechanisms */
@@ -15804,6 +16510,16 @@ perl_clone_using(PerlInterpreter *proto_perl, UV flags,
     PL_sighandler3p	= proto_perl->Isighandler3p;
 
     PL_runops		= proto_perl->Irunops;
+    /* the op profiler's results belong to the parent */
+    if (PL_runops == Perl_runops_profile)
+        PL_runops = RUNOPS_DEFAULT;
+    PL_op_profile_counts = NULL;
+    PL_op_profile_samples = NULL;
+    PL_op_profile_file = NULL;
+
+    /* hash split statistics are kept per interpreter */
+    PL_hv_split_count = 0;
+    PL_hv_split_worst = 0;
 
     PL_subline		= proto_perl->Isubline;
 
@@ -186,7 +186,7 @@ typedef enum {
  * use a body, so that arena root is re-used for HEs. SVt_IV also doesn't, so
  * that arena root is used for HVs with struct xpvhv_aux. */
 
-#if defined(PERL_IN_HV_C) || defined(PERL_IN_XS_APITEST)
+#if defined(PERL_IN_HV_C) || defined(PERL_IN_SV_C) || defined(PERL_IN_XS_APITEST)
 #  define HE_ARENA_ROOT_IX      SVt_NULL
 #endif
 #if defined(PERL_IN_HV_C) || defined(PERL_IN_SV_C)
@@ -1096,6 +1096,13 @@ Returns the vstring magic, or NULL if none
 #define SvVSTRING_mg(sv)	(SvMAGICAL(sv) \
                                  ? mg_find(sv,PERL_MAGIC_vstring) : NULL)
 
+#if defined(PERL_CORE) || defined(PERL_EXT)
+/* The string is the end of another SV's buffer; see sv_setpv_view() */
+#  define SvVIEW_mg(sv)		(SvTYPE(sv) == SVt_PVMG && !SvLEN(sv)	\
+                                 && SvRMAGICAL(sv) && SvPVX_const(sv)	\
+                                 ? mg_find(sv,PERL_MAGIC_view) : NULL)
+#endif
+
 #define SvOOK(sv)		(SvFLAGS(sv) & SVf_OOK)
 #define SvOOK_on(sv)		(SvFLAGS(sv) |= SVf_OOK)
 
@@ -0,0 +1,140 @@
+#!./perl
+
+BEGIN {
+    chdir 't' if -d 't';
+    require './test.pl';
+    set_up_inc('../lib');
+    skip_all_without_perlio();
+}
+
+use strict;
+use warnings;
+use Fcntl qw(SEEK_CUR);
+
+plan(tests => 28);
+
+my $file = tempfile();
+my $data = join "", map "line $_ " . ("x" x ($_ % 37)) . "\n", 1 .. 2000;
+{
+    open my $fh, ">:raw", $file or die "$file: $!";
+    print $fh $data;
+    close $fh or die "$file: $!";
+}
+
+sub slurp {
+    my ($fh) = @_;
+    local $/;
+    return scalar readline $fh;
+}
+
+{
+    open my $fh, "<:raw:bufsize(64)", $file or die "$file: $!";
+    my $line = <$fh>;
+    is(sysseek($fh, 0, SEEK_CUR), 64, "first fill reads :bufsize bytes");
+    is($line . slurp($fh), $data, "contents read through a small buffer");
+    is(join(" ", PerlIO::get_layers($fh)), "unix perlio",
+       ":bufsize does not show up as a layer");
+}
+
+{
+    open my $fh, "<:raw", $file or die "$file: $!";
+    my @lines = map scalar <$fh>, 1 .. 3;
+    ok(binmode($fh, ":bufsize(100)"), "binmode :bufsize");
+    my $pos = tell $fh;
+    my $line = <$fh>;
+    is(sysseek($fh, 0, SEEK_CUR), $pos + 100,
+       "read-ahead discarded and refilled with the new size");
+    is(join("", @lines, $line, slurp($fh)), $data,
+       "no data lost changing the size");
+}
+
+{
+    open my $fh, "<:raw:bufsize(32):bufsize(auto,256)", $file
+        or die "$file: $!";
+    my @seen;
+    for (1 .. 40) {
+        read($fh, my $buf, 16) == 16 or die "short read";
+        push @seen, sysseek($fh, 0, SEEK_CUR);
+    }
+    my %fills;
+    @fills{@seen} = ();
+    is(join(",", sort { $a <=> $b } keys %fills), "32,96,224,480,736",
+       "auto doubles the buffer on each drain, up to the limit");
+    seek($fh, 0, 0);
+    my $line = <$fh>;
+    is(sysseek($fh, 0, SEEK_CUR), 256, "a seek keeps the grown size");
+    is($line . slurp($fh), $data, "contents read through a growing buffer");
+}
+
+{
+    open my $fh, "<:raw:bufsize(auto)", $file or die "$file: $!";
+    is(slurp($fh), $data, "auto with the default limit");
+}
+
+{
+    # a read which stops short of draining the buffer does not grow it
+    open my $fh, "<:raw:bufsize(32):bufsize(auto,256)", $file
+        or die "$file: $!";
+    read($fh, my $buf, 16);
+    seek($fh, 100, 0);
+    read($fh, $buf, 16);
+    is(sysseek($fh, 0, SEEK_CUR), 132, "random access keeps the size");
+}
+
+{
+    # Both a CR held back at the end of the buffer and CRLF pairs
+    # split across it
+    (my $crlf = $data) =~ s/\n/\r\n/g;
+    my $crfile = tempfile();
+    open my $out, ">:raw", $crfile or die "$crfile: $!";
+    print $out $crlf;
+    close $out or die "$crfile: $!";
+    for my $spec ("bufsize(16)", "bufsize(17)", "bufsize(16):bufsize(auto)") {
+        open my $fh, "<:raw:crlf:$spec", $crfile or die "$crfile: $!";
+        my $got = "";
+        while (my $line = <$fh>) {
+            $got .= $line;
+        }
+        is($got, $data, ":crlf:$spec read");
+    }
+    open $out, ">:raw:crlf:bufsize(16)", $crfile or die "$crfile: $!";
+    print $out $data;
+    close $out or die "$crfile: $!";
+    open my $fh, "<:raw", $crfile or die "$crfile: $!";
+    ok(slurp($fh) eq $crlf, ":crlf:bufsize(16) write");
+}
+
+{
+    my $wfile = tempfile();
+    open my $out, ">:raw:bufsize(50)", $wfile or die "$wfile: $!";
+    print $out "a" x 49;
+    is(-s $wfile, 0, "output stays in the buffer until it is full");
+    print $out "bc";
+    is(-s $wfile, 50, "a full buffer is written out");
+    print $out $data;
+    close $out or die "$wfile: $!";
+    open my $fh, "<:raw", $wfile or die "$wfile: $!";
+    is(slurp($fh), "a" x 49 . "bc" . $data, "contents written");
+}
+
+{
+    open my $fh, "<:raw:bufsize(64)", $file or die "$file: $!";
+    my $line = <$fh>;
+    open my $dup, "<&", $fh or die "dup: $!";
+    seek($dup, 0, 0);
+    scalar <$dup>;
+    is(sysseek($dup, 0, SEEK_CUR), 64, "a dup keeps the size");
+}
+
+{
+    my @warnings;
+    local $SIG{__WARN__} = sub { push @warnings, $_[0] };
+    for my $arg ("", "(0)", "(15)", "(12k)", "(auto,)", "(auto,x)", "(x)") {
+        @warnings = ();
+        ok(!open(my $fh, "<:raw:bufsize$arg", $file),
+           ":bufsize$arg is rejected");
+        like($warnings[0], qr/^Invalid argument ".*" for PerlIO layer ":bufsize"/,
+             "... with a warning") if $arg eq "(x)";
+    }
+    ok(!binmode(STDIN, ":bufsize(-1)"), "binmode with a bad size fails");
+}
@@ -0,0 +1,173 @@
+#!./perl
+
+BEGIN {
+    chdir 't' if -d 't';
+    require './test.pl';
+    set_up_inc('../lib');
+    skip_all_without_perlio();
+}
+
+use strict;
+use warnings;
+use Config;
+
+plan(tests => 33);
+
+my $file = tempfile();
+my $data = join "", map "line $_ " . ("x" x ($_ % 53)) . "\n", 1 .. 20000;
+{
+    open my $fh, ">:raw", $file or die "$file: $!";
+    print $fh $data;
+    close $fh or die "$file: $!";
+}
+
+sub slurp {
+    my ($name, $layers) = @_;
+    open my $fh, "<" . ($layers // ":raw"), $name or die "$name: $!";
+    local $/;
+    return scalar readline $fh;
+}
+
+{
+    my $out = tempfile();
+    open my $in, "<", $file or die "$file: $!";
+    open my $fh, ">", $out or die "$out: $!";
+    is(PerlIO::copy($in, $fh), length $data, "copy a whole file");
+    is(tell($in), length $data, "input position");
+    is(tell($fh), length $data, "output position");
+    is(PerlIO::copy($in, $fh), 0, "nothing more to copy");
+    close $fh or die "$out: $!";
+    ok(slurp($out) eq $data, "contents");
+}
+
+{
+    my $out = tempfile();
+    open my $in, "<", $file or die "$file: $!";
+    open my $fh, ">", $out or die "$out: $!";
+    my $first = <$in>;
+    print $fh "header\n";
+    is(PerlIO::copy($in, $fh, 1000), 1000, "copy a length");
+    is(tell($in), length($first) + 1000, "input position after a length");
+    is(tell($fh), 1007, "output position after a length");
+    my $line = <$in>;
+    is($line, (split /^/, substr($data, length($first) + 1000))[0],
+       "reading carries on from there");
+    print $fh "|";
+    is(PerlIO::copy(*$in, *$fh), length($data) - 1000 - length($first)
+                                 - length($line), "copy the rest by glob");
+    close $fh or die "$out: $!";
+    ok(slurp($out) eq "header\n" . substr($data, length($first), 1000)
+                      . "|" . substr($data, 1000 + length($first) + length($line)),
+       "buffered data goes out in order");
+    is(PerlIO::copy($in, $fh, 0), 0, "a length of 0");
+}
+
+{
+    my $out = tempfile();
+    open my $in, "<", $file or die "$file: $!";
+    open my $fh, ">", $out or die "$out: $!";
+    # less than was read into the input buffer
+    read($in, my $buf, 10);
+    is(PerlIO::copy($in, $fh, 100), 100, "copy less than is buffered");
+    is(tell($in), 110, "input position within the buffer");
+    close $fh or die "$out: $!";
+    is(slurp($out), substr($data, 10, 100), "what was buffered");
+}
+
+{
+    my $out = tempfile();
+    open my $fh, ">", $out or die "$out: $!";
+    print $fh "start\n";
+    close $fh or die "$out: $!";
+    open $fh, ">>", $out or die "$out: $!";
+    open my $in, "<", $file or die "$file: $!";
+    is(PerlIO::copy($in, $fh), length $data, "copy to a file opened to append");
+    close $fh or die "$out: $!";
+    ok(slurp($out) eq "start\n" . $data, "appended");
+}
+
+SKIP: {
+    skip "no fork", 3 unless $Config{d_fork};
+    open my $in, "<", $file or die "$file: $!";
+    pipe my $r, my $w or die "pipe: $!";
+    my $pid = fork;
+    die "fork: $!" unless defined $pid;
+    unless ($pid) {
+        close $r;
+        PerlIO::copy($in, $w) == length $data or die "short copy";
+        exit 0;
+    }
+    close $w;
+    my $got = do { local $/; <$r> };
+    waitpid $pid, 0;
+    is($?, 0, "copy to a pipe");
+    ok($got eq $data, "what came through the pipe");
+
+    pipe $r, $w or die "pipe: $!";
+    $pid = fork;
+    die "fork: $!" unless defined $pid;
+    unless ($pid) {
+        close $r;
+        print $w $data;
+        exit 0;
+    }
+    close $w;
+    my $out = tempfile();
+    open my $fh, ">", $out or die "$out: $!";
+    PerlIO::copy($r, $fh);
+    close $fh or die "$out: $!";
+    waitpid $pid, 0;
+    ok(slurp($out) eq $data, "copy from a pipe");
+}
+
+{
+    # a character held back across the boundary of each block read
+    my $text = "a" . "\x{e9}" x 200_000;
+    my $in8 = tempfile();
+    open my $fh, ">:utf8", $in8 or die "$in8: $!";
+    print $fh $text;
+    close $fh or die "$in8: $!";
+
+    my $out = tempfile();
+    open my $in, "<:utf8", $in8 or die "$in8: $!";
+    open $fh, ">:raw", $out or die "$out: $!";
+    is(PerlIO::copy($in, $fh), 1 + 2 * 200_000, "copy from :utf8 to bytes");
+    close $fh or die "$out: $!";
+    ok(slurp($out) eq "a" . "\xe9" x 200_000, "characters as bytes");
+
+    open $in, "<:raw", $out or die "$out: $!";
+    open $fh, ">:utf8", $in8 or die "$in8: $!";
+    is(PerlIO::copy($in, $fh), 1 + 200_000, "copy from bytes to :utf8");
+    close $fh or die "$in8: $!";
+    ok(slurp($in8, ":utf8") eq $text, "bytes as characters");
+
+    my @warnings;
+    local $SIG{__WARN__} = sub { push @warnings, $_[0] };
+    open $in, "<:utf8", \"\x{263a}" or die;
+    my $wide = "";
+    open $fh, ">", \$wide or die;
+    is(PerlIO::copy($in, $fh), 3, "copy a wide character to bytes");
+    like($warnings[0], qr/^Wide character/, "... warns as print would");
+}
+
+{
+    my $src = "in memory\n" x 1000;
+    open my $in, "<", \$src or die;
+    my $dst = "";
+    open my $fh, ">", \$dst or die;
+    is(PerlIO::copy($in, $fh, 15), 15, "copy between in-memory handles");
+    is($dst, substr($src, 0, 15), "contents");
+}
+
+{
+    my @warnings;
+    local $SIG{__WARN__} = sub { push @warnings, $_[0] };
+    use warnings "io";
+    open my $in, "<", $file or die "$file: $!";
+    is(PerlIO::copy(\*NOSUCH, \*STDOUT), undef, "an unopened handle");
+    ok($!{EBADF}, "... sets EBADF");
+    is(PerlIO::copy($in, $in), undef, "a handle only open for reading");
+    like($warnings[-1], qr/opened only for input/, "... warns");
+    ok(!eval { PerlIO::copy($in, \*STDOUT, -1); 1 }, "a negative length");
+    like($@, qr/^Negative length/, "... dies");
+}
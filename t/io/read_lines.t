@@ -0,0 +1,77 @@
+#!./perl
+
+BEGIN {
+    chdir 't' if -d 't';
+    require './test.pl';
+    set_up_inc('../lib');
+    skip_all_without_perlio();
+}
+
+use strict;
+use warnings;
+
+plan(tests => 22);
+
+my $data = join "", map "line $_\n", 1 .. 25;
+open my $fh, "<", \$data or die;
+
+my @lines;
+is(PerlIO::read_lines($fh, @lines, 10), 10, "first batch");
+is("@lines[0,9]", "line 1\n line 10\n", "the first ten lines");
+is($., 10, '$. counts the lines');
+
+# the scalars in the array are read into again
+my $addr = \$lines[3] + 0;
+my $held = \$lines[5];
+is(PerlIO::read_lines($fh, @lines, 10), 10, "second batch");
+is(\$lines[3] + 0, $addr, "element scalar reused");
+is($$held, "line 6\n", "a line something refers to is left alone");
+is($lines[5], "line 16\n", "and replaced in the array");
+
+is(PerlIO::read_lines($fh, @lines, 10), 5, "short batch at the end");
+is(scalar(@lines), 5, "the array is trimmed to the lines read");
+is($lines[-1], "line 25\n", "last line");
+is(PerlIO::read_lines($fh, @lines, 10), 0, "nothing left");
+is(scalar(@lines), 0, "empty array at end of file");
+
+{
+    local $/ = "";
+    my $para = "a\nb\n\n\nc\n\n";
+    open my $pfh, "<", \$para or die;
+    is(&PerlIO::read_lines($pfh, \@lines, 5), 2, 'uses $/, and takes a ref');
+    is(join("|", @lines), "a\nb\n\n|c\n\n", "paragraphs");
+}
+
+{
+    my $utf8 = "\x{263a}\n\x{e9}\n";
+    utf8::encode($utf8);
+    open my $ufh, "<:utf8", \$utf8 or die;
+    PerlIO::read_lines($ufh, @lines, 5);
+    is(join("", @lines), "\x{263a}\n\x{e9}\n", "utf8 handle");
+}
+
+{
+    package Tied::Lines;
+    sub TIEHANDLE { my ($class, @l) = @_; bless [@l], $class }
+    sub READLINE { shift @{$_[0]} }
+    package main;
+    tie *TL, "Tied::Lines", "x\n", "y\n", "z\n";
+    is(PerlIO::read_lines(*TL, @lines, 2), 2, "tied handle");
+    is(join("", @lines), "x\ny\n", "tied handle lines");
+    is(PerlIO::read_lines(*TL, @lines, 2), 1, "tied handle to its end");
+}
+
+{
+    require Tie::Array;
+    tie my @tied, "Tie::StdArray";
+    open my $tfh, "<", \"p\nq\n" or die;
+    is(PerlIO::read_lines($tfh, @tied, 5), 2, "into a tied array");
+    is("@tied", "p\n q\n", "tied array contents");
+}
+
+{
+    close $fh;
+    local $!;
+    is(PerlIO::read_lines($fh, @lines, 1), undef, "closed handle");
+    ok($!{EBADF}, '$! set');
+}
@@ -6,7 +6,7 @@ BEGIN {
     set_up_inc('../lib');
 }
 
-plan tests => 36;
+plan tests => 39;
 
 # [perl #19566]: sv_gets writes directly to its argument via
 # TARG. Test that we respect SvREADONLY.
@@ -289,6 +289,37 @@ is ${^LAST_FH}, undef, '${^LAST_FH} after readline undef';
         '[perl #123790] *x=<y> used to fail an assertion';
 }
 
+SKIP:
+{
+    skip_if_miniperl("no dynamic loading on miniperl, so can't load B", 1);
+    require B;
+    # the line is copied once its length is known, rather than the
+    # line's sv being grown to hold all of the read-ahead buffer
+    my $s = ("x" x 99 . "\n") x 1000;
+    open my $fh, "<", \$s or die;
+    my $line = <$fh>;
+    cmp_ok(B::svref_2object(\$line)->LEN, '<', 1000,
+           'short line from an in-memory file');
+}
+
+{
+    # separators and runs of newlines across the read-ahead buffer
+    my $tmpfile = tempfile();
+    open my $fh, ">", $tmpfile or die "Cannot open $tmpfile: $!";
+    binmode $fh;
+    print $fh "x" x 8190, "abc", "yabyaabc", "z" x 8190, "\n" x 9, "end\n";
+    close $fh;
+    open $fh, "<", $tmpfile or die "Cannot open $tmpfile: $!";
+    my @recs = do { local $/ = "abc"; <$fh> };
+    is(join("|", map length, @recs), "8193|8|8203",
+       'multi-byte separator across the read-ahead buffer');
+    open $fh, "<", $tmpfile or die "Cannot open $tmpfile: $!";
+    @recs = do { local $/ = ""; <$fh> };
+    is(join("|", map length, @recs), "16393|4",
+       'paragraph mode across the read-ahead buffer');
+    close $fh;
+}
+
 SKIP:
 {
     skip_without_dynamic_extension("IO", 4);
@@ -7,7 +7,7 @@ BEGIN {
     set_up_inc('../lib');
 }
 use warnings;
-plan(tests => 205);
+plan(tests => 215);
 use Tie::Array; # we need to test sorting tied arrays
 
 # these shouldn't hang
@@ -1232,3 +1232,55 @@ SKIP:
 
 my sub lexcmp { $a <=> $b }
 is join('', sort lexcmp 3,4,1,2), "1234", "lexical sort sub" ;
+
+# Big enough arrays of plain numbers or strings are radix sorted, which
+# must give exactly the same order, stability included, as sorting with
+# an equivalent sort sub (which never takes that path).  The string
+# forms of the numbers make the order of equal values visible.
+{
+    my @int = map { my $n = int(rand 2000) - 1000; ($n, sprintf "%05d", $n) }
+        1 .. 1000;
+    push @int, 0, "00";
+    my @big = map { (int(rand 2**31) << 32) - (1 << 62) + int rand 99 }
+        1 .. 1000;
+    push @big, ~0 >> 1, -(~0 >> 1) - 1, 0;
+    my @num = map { my $n = (int(rand 2000) - 1000) / 8;
+                    ($n, sprintf "%.4f", $n) } 1 .. 1000;
+    push @num, 9**9**9, -9**9**9, 0.5, -0.0, "-0.0", 1e300, -1e-300;
+    my @str = map { my $s = join "", map { chr(rand 4) } 0 .. rand 12;
+                    ($s, "$s") } 1 .. 1000;
+    my @utf = map { "\x{100}" . chr(0x7f + rand 10) x rand 10 } 1 .. 2000;
+
+    my $got = join ",", sort { $a <=> $b } @int;
+    is($got, join(",", sort { $a <=> $b or 0 } @int), "radix sort of IVs");
+    $got = join ",", sort { $b <=> $a } @int;
+    is($got, join(",", sort { $b <=> $a or 0 } @int),
+       "descending radix sort of IVs");
+    $got = join ",", sort { $a <=> $b } @big;
+    is($got, join(",", sort { $a <=> $b or 0 } @big),
+       "radix sort of big IVs");
+    {
+        use integer;
+        $got = join ",", sort { $b <=> $a } @int;
+        is($got, join(",", sort { $b <=> $a or 0 } @int),
+           "radix sort of integers under 'use integer'");
+    }
+    $got = join ",", sort { $a <=> $b } @num;
+    is($got, join(",", sort { $a <=> $b or 0 } @num), "radix sort of NVs");
+    $got = join ",", sort { $b <=> $a } @num;
+    is($got, join(",", sort { $b <=> $a or 0 } @num),
+       "descending radix sort of NVs");
+    $got = join ",", map { unpack "H*", $_ } sort @str;
+    is($got, join(",", map { unpack "H*", $_ } sort { $a cmp $b or 0 } @str),
+       "radix sort of strings");
+    $got = join ",", map { unpack "H*", $_ } sort { $b cmp $a } @str;
+    is($got, join(",", map { unpack "H*", $_ } sort { $b cmp $a or 0 } @str),
+       "descending radix sort of strings");
+    $got = join ",", sort @utf;
+    is($got, join(",", sort { $a cmp $b or 0 } @utf),
+       "radix sort of UTF-8 strings");
+    my @inplace = @num;
+    @inplace = sort { $a <=> $b } @inplace;
+    is("@inplace", join(" ", sort { $a <=> $b or 0 } @num),
+       "in-place radix sort");
+}
@@ -7,7 +7,7 @@ BEGIN {
     require './charset_tools.pl';
 }
 
-plan tests => 219;
+plan tests => 260;
 
 $FS = ':';
 
@@ -763,3 +763,76 @@ SKIP: {
             "$prog matches expected under `use re qw(/$modifiers)`");
     }
 }
+
+# use re 'split_parallel' has to give exactly the same fields as splitting
+# serially.  Force it on for short strings, and with more threads than
+# there are likely to be CPUs; on perls without threads it does nothing.
+SKIP: {
+    skip_if_miniperl("split_parallel needs re.pm", 30);
+
+    my $tsv = join "", map { join("\t", $_, "x" x ($_ % 7), "", $_ * 3) . "\n" }
+        1 .. 2000;
+    my $utf = join ", ", map { "\x{100}" x ($_ % 5) . "\x{e9}$_" } 1 .. 2000;
+    my $splits = <<'EOS';
+        my %got;
+        $got{tab}      = [ split /\t/, $tsv ];
+        $got{newline}  = [ split /\n/, $tsv ];
+        $got{keep}     = [ split /\t/, $tsv, -1 ];
+        $got{limit}    = [ split /\t/, $tsv, 100 ];
+        $got{multi}    = [ split /\n1/, $tsv ];
+        $got{overlap}  = [ split /xx/, $tsv ];
+        $got{utf8}     = [ split /, /, $utf ];
+        $got{count}    = [ scalar(my @x = split /\t/, $tsv) ];
+        $got{scalar}   = [ scalar split /\n/, "$tsv\n\n" ];
+        my @ary = split /\t/, "\t$tsv\t\t";
+        $got{ary}      = \@ary;
+        \%got;
+EOS
+    my $serial = eval $splits or die $@;
+    for my $threads (2, 3, 8) {
+        my $got = eval "use re split_parallel => 0, split_threads => $threads;"
+                     . $splits
+            or die $@;
+        for my $kind (sort keys %$serial) {
+            is(join("|", @{$got->{$kind}}), join("|", @{$serial->{$kind}}),
+               "parallel split $kind with $threads threads");
+        }
+    }
+}
+
+# A constant fixed string separator makes the fields straight into an
+# empty array being assigned to, growing it as it goes
+{
+    my $str = join ",", 1 .. 5000;
+    my @a = split /,/, $str;
+    is(scalar(@a), 5000, "fixed split into an empty array");
+    is("$a[0] $a[4999]", "1 5000", "first and last fields");
+    @a = split /,/, "$str,,,";
+    is(scalar(@a), 5000, "trailing empty fields removed from the array");
+    @a = split /,/, "a,b,,", -1;
+    is(join("|", @a), "a|b||", "negative limit keeps them");
+    @a = ("old");
+    @a = split /::/, "x::y::z", 2;
+    is(join("|", @a), "x|y::z", "limit into an array that wasn't empty");
+    my @b = (my @c = split /\x{263a}/, "\x{263a}a\x{263a}\x{e9}\x{263a}");
+    is(join("|", @b), "|a|\x{e9}", "utf8 fields returned from the assignment");
+    my $n = (@c = split /, /, "a, b, c, ");
+    is($n, 3, "count of the fields in the array");
+    {
+        package Split::ISA::Base; sub m { "found" }
+    }
+    our @ISA;
+    @ISA = split / /, "Split::ISA::Base";
+    is(main->m, "found", "fields straight into \@ISA update the method cache");
+}
+
+# a long last field may share the buffer of the string being split
+{
+    my $str = "head:" . ("x" x 10000) . "y";
+    my ($h, $t) = split /:/, $str;
+    is(length($t) . substr($t, -2), "10001xy", "long last field");
+    $str =~ s/y\z/z/;
+    is(substr($t, -1), "y", "last field not changed with the string");
+    $t .= "!";
+    is(substr($t, -2) . substr($str, -1), "y!z", "or the string with it");
+}
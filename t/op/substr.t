@@ -22,7 +22,7 @@ $SIG{__WARN__} = sub {
      }
 };
 
-plan(400);
+plan(414);
 
 run_tests() unless caller;
 
@@ -918,4 +918,41 @@ fresh_perl_is('$0 = "/usr/bin/perl"; substr($0, 0, 0, $0)', '', {}, "(perl #1293
     is $bar, boz => 'first arg to 4-arg substr is loose lvalue context';
 }
 
+{ # the tail of a long string may share the buffer of the original
+    my $long = "abc" . ("x" x 10000) . "yz";
+    my $t = substr($long, 3);
+    is length $t, 10002, 'long substr tail: length';
+    is substr($t, -3), "xyz", 'long substr tail: content';
+    $t .= "!";
+    is substr($t, -4), "xyz!", 'long substr tail: append';
+    is substr($long, -3), "xyz", 'long substr tail: original unchanged';
+    $t = substr($long, 3);
+    chop $t;
+    is substr($t, -2), "xy", 'long substr tail: chop';
+    is substr($long, -2), "yz", 'long substr tail: chop leaves original';
+    $t = substr($long, 3);
+    $t =~ s/z\z/Z/;
+    is substr($t, -2), "yZ", 'long substr tail: s///';
+    is substr($long, -2), "yz", 'long substr tail: s/// leaves original';
+    $t = substr($long, 3);
+    $t =~ tr/y/Y/;
+    is substr($t, -2), "Yz", 'long substr tail: tr///';
+    is substr($long, -2), "yz", 'long substr tail: tr/// leaves original';
+    $t = substr($long, 3);
+    my $copy = $t;
+    substr($long, -1, 1, "Q");
+    undef $long;
+    is substr($t, -2), "yz", 'long substr tail outlives its original';
+    is $copy, $t, 'long substr tail: copy';
+    my $u = "\x{100}" . ("\xe9" x 10000);
+    my $v = substr($u, 1);
+    utf8::downgrade($v);
+    is $v, "\xe9" x 10000, 'long substr tail: utf8 downgrade';
+    my $w = "abc" . ("x" x 10000) . "yz";
+    my $m = substr($w, 1);
+    $m =~ /x(y.)\z/;
+    $w = $m = "";
+    is $1, "yz", 'captures from a long substr tail';
+}
+
 1;
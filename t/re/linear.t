@@ -0,0 +1,159 @@
+#!./perl
+#
+# Tests for the linear-time matcher, and "use re 'linear'", which makes
+# patterns always use it.  re/regexp_linear.t runs the tests in re/re_tests
+# that way too.
+
+BEGIN {
+    chdir 't' if -d 't';
+    require './test.pl';
+    set_up_inc('../lib','.','../ext/re');
+}
+
+skip_all('no re module') unless defined &DynaLoader::boot_DynaLoader;
+
+use strict;
+use warnings;
+
+# Describe the result of matching $str against $re the way regexec.c would
+# leave it
+sub result {
+    my ($str, $re) = @_;
+    return "no match" unless $str =~ $re;
+    no warnings 'uninitialized';
+    return join ",", "<$&>", "@-", "@+", "<$+>", "<$^N>",
+                     map { defined $_ ? "<$_>" : "undef" } @{^CAPTURE};
+}
+
+# Each pattern is compiled as usual and under "use re 'linear'", and
+# matched against each string; the results must be the same.
+my @same = (
+    [ 'ab(x)|ab(y)',                'aby', 'abx', 'ab' ],
+    [ '(?:(a)|b)+',                 'ab', 'ba', 'bab' ],
+    [ '(foo|bar)+',                 'xfoobarbaz', 'barfoo' ],
+    [ '(a*?)(a+)b',                 'aaab', 'ab', 'b' ],
+    [ '^(a|aa)+$',                  'aaa', 'aaaa!' ],
+    [ '(aa|a)(a*)',                 'aaaaaa' ],
+    [ '(?:a|ab)(c|bcd)(d*)',        'abcd' ],
+    [ '\b(\w+)\s+(\w+)\b',          'ab cd', ' ab  cd ' ],
+    [ '\B\w\B',                     'abc', 'ab' ],
+    [ '(?:([a-z])(\d))+',           'a1b2c3', 'a1b' ],
+    [ 'a{2,3}',                     'xxaaaayy', 'a' ],
+    [ '(abc){2}',                   'abcabc', 'abcab' ],
+    [ '(a|b){1,3}?b',               'abab', 'b' ],
+    [ '(a|b){2,}?(b)',              'ababb' ],
+    [ '^bar$',                      "foo\nbar", "bar\n", "bar\n\n" ],
+    [ '(?m)^bar$',                  "foo\nbar\nbaz" ],
+    [ '\Ab|c\z',                    'abc', 'bcd' ],
+    [ '(\d+)(\d+)(\d+)',            '12345' ],
+    [ '(?i)WORLD',                  'hello World' ],
+    [ '(?i:ab|cd)+e',               'ABcDaBe' ],
+    [ '(x)(?:(y)|(z))*',            'xyzy', 'xzy' ],
+    [ '(?:(a)|(b)|(c))+',           'abcb' ],
+    [ '[ab]+c|[ab]+d',              'abababd' ],
+    [ '(?s).+',                     "a\nb" ],
+    [ '.+',                         "a\nb" ],
+    [ '\x{100}+(\x{101})',          "\x{100}\x{100}\x{101}" ],
+    [ '[\x{100}-\x{200}]+',         "a\x{150}\x{250}" ],
+    [ '(\w)+',                      "\x{e9}t\x{e9}" ],
+);
+
+for my $test (@same) {
+    my ($pat, @strs) = @$test;
+    my $re = qr/$pat/;
+    my $linear = do { use re 'linear'; qr/$pat/ };
+    for my $str (@strs) {
+        (my $name = $str) =~ s/([^ -~])/sprintf "\\x{%x}", ord $1/ge;
+        is(result($str, $linear), result($str, $re),
+           "/$pat/ against '$name' matches the same in linear time");
+        my $up = $str;
+        utf8::upgrade($up);
+        is(result($up, $linear), result($up, $re),
+           "/$pat/ against upgraded '$name' matches the same in linear time");
+    }
+}
+
+{
+    # Case-insensitive matching of non-ASCII targets is left to
+    # backtracking
+    use re 'linear';
+    like("\x{17F}", qr/(?i)s/, "LATIN SMALL LETTER LONG S matches /s/i");
+    like("\x{212A}", qr/(?i)k/, "KELVIN SIGN matches /k/i");
+    like("\x{DF}", qr/(?iu)ss/, "LATIN SMALL LETTER SHARP S matches /ss/iu");
+    unlike("\x{DF}", qr/(?i)ss/, "... but not /ss/id");
+    unlike("\x{212A}", qr/(?iaa)k/, "KELVIN SIGN doesn't match /k/iaa");
+}
+
+{
+    # The same match is found from every starting point
+    use re 'linear';
+    my $str = "ab1 cd22 ef333";
+    my @words = $str =~ /([a-z]+)(\d+)/g;
+    is("@words", "ab 1 cd 22 ef 333", "list //g");
+    my $count = () = $str =~ /\d*/g;
+    is($count, 12, "empty matches under //g");
+    (my $copy = $str) =~ s/(\w)(\d+)/$2$1/g;
+    is($copy, "a1b c22d e333f", "s///g");
+    is(join("|", split /\s*(\d)\s*/, $str), "ab|1|cd|2||2|ef|3||3||3",
+       "split");
+}
+
+{
+    # A pattern compiled under "use re 'linear'" stays that way
+    my $re = do { use re 'linear'; qr/^(a|aa)+$/ };
+    ok(("a" x 50) . "!" !~ $re, "qr// from 'linear' scope");
+    ok(("a" x 50) . "!" !~ /x|$re/, "... interpolated elsewhere");
+    no re 'linear';
+    eval q{ qr/(a)\1/ };
+    is($@, "", "no re 'linear' allows backreferences again");
+}
+
+# Patterns which can't be matched in linear time
+my @cannot = (
+    [ '(\w+)\1',                'backreferences' ],
+    [ '(?<w>\w)\k<w>',          'backreferences' ],
+    [ 'a(?=b)',                 'lookaround assertions' ],
+    [ '(?<!a)b',                'lookaround assertions' ],
+    [ '(?>a+)b',                'atomic subpatterns' ],
+    [ 'a++b',                   'atomic subpatterns' ],
+    [ '(a)?(?(1)b|c)',          'conditionals' ],
+    [ '\Ga',                    '\G' ],
+    [ 'a\Kb',                   '\K' ],
+    [ '(a|b(?1))',              'recursion' ],
+    [ 'a(*PRUNE)b',             'backtracking control verbs' ],
+    [ '\b{wb}',                 '\b{...}' ],
+    [ '\R',                     '\R' ],
+    [ '\X',                     '\X' ],
+    [ '(a*)*',                  'a quantified subpattern which can match the empty string' ],
+    [ '(?:a|b?)+',              'a quantified subpattern which can match the empty string' ],
+    [ '(?i)\x{e9}',             'case-insensitive non-ASCII characters' ],
+    [ '(?:abcdefgh){1000}',     'too many states' ],
+);
+
+for my $test (@cannot) {
+    my ($pat, $why) = @$test;
+    eval { use re 'linear'; qr/$pat/ };
+    like($@, qr/^\QPattern cannot be matched in linear time ($why) in regex m\/$pat\//,
+         "/$pat/ can't be matched in linear time");
+    eval { qr/$pat/ };
+    is($@, "", "... but can be compiled without 'linear'");
+}
+
+{
+    eval q{ use re 'linear'; use locale; qr/a+/ };
+    like($@, qr/^\QPattern cannot be matched in linear time (locale rules)/,
+         "Patterns under 'use locale' can't be matched in linear time");
+    eval q{ use re 'linear'; my $x = 1; qr/a(?{ $x })/ };
+    like($@, qr/^\QPattern cannot be matched in linear time (code blocks)/,
+         "Nor ones with code blocks");
+}
+
+{
+    # A large trie
+    my $alts = join "|", map { "w${_}x" } 1 .. 200;
+    my $re = do { use re 'linear'; qr/^(?:$alts)+$/ };
+    like("w1xw199xw200x", $re, "large pattern");
+    unlike("w1xw199xw201x", $re, "large pattern doesn't match");
+}
+
+done_testing();
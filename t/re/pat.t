@@ -28,7 +28,7 @@ skip_all_without_unicode_tables();
 my $has_locales = locales_enabled('LC_CTYPE');
 my $utf8_locale = find_utf8_ctype_locale();
 
-plan tests => 1265;  # Update this when adding/deleting tests.
+plan tests => 1267;  # Update this when adding/deleting tests.
 
 run_tests() unless caller;
 
@@ -1995,7 +1995,7 @@ EOP
                 $SIG{ALRM} = sub {print "'.$expected.'\n"; exit(1)};
                 alarm 1;
                 $_ = "a" x 1000 . "b" x 1000 . "c" x 1000;
-                /.*a.*b.*c.*[de]/;
+                /(.*)a.*b.*c.*[de]\1/; # backref keeps it off the linear matcher
                 print "increase the multipliers in the regex above to run the regex longer";
             ';
             # this flaps on github cygwin vm, but not on cygwin iron #18129
@@ -2512,6 +2512,70 @@ SKIP:
         ok($str =~ s/$copy/PQR/, 'replaced $copy with PQR');
         is($str, "PQR", 'final string should be PQR');
     }
+    {
+        # Start classes that find_byclass() scans for many bytes at a time.
+        # Put the first match at each offset into a block, and compare with
+        # matching one position at a time.
+        my @classes = ('\d', '\D', '\w+', '(?a)\W', '[^\s,]+', '[aeiou]',
+                       '\s', '(?u)\s', '[[:punct:]]', '[^\x{80}-\x{ff}]',
+                       '[\x{e0}-\x{ff}]');
+        my @fill = ("q", " ", "\x{e9}", "\x{263a}");
+        my @needle = ("7", "q", ",", "!", "\x{e9}", "\x{a0}", "\x{263a}",
+                      " ");
+        my $bad = 0;
+        for my $class (@classes) {
+            my $re = qr/$class/;
+            for my $fill (@fill) {
+                for my $needle (@needle) {
+                    for my $at (0 .. 17, 31, 32, 33) {
+                        my $str = $fill x $at . $needle . $fill x 20;
+                        my $want;
+                        for my $i (0 .. length($str) - 1) {
+                            if (substr($str, $i) =~ /\A$class/) {
+                                $want = $i;
+                                last;
+                            }
+                        }
+                        my $got = $str =~ $re ? $-[0] : undef;
+                        $bad++ unless ($got // -1) == ($want // -1);
+                    }
+                }
+            }
+        }
+        is($bad, 0, "start classes are found at any offset");
+    }
+    {
+        # Patterns without alternation are run by the straight-line matcher
+        # rather than regmatch(), which a code block makes them go back to.
+        my @pats = ('^(\S+) (\S+) "(\w+)" (\d+)', 'a+?b', '(a*)(a+)b',
+                    '(\w{2,3}?)(\d*)\b', '(x?)(.+?)(\s+)$', '\[(.*?)\]',
+                    '(\w+)\s+(\w+)\z', '(?m)^(.*)$', 'a{2}(b{0,2}?)c+',
+                    "(\x{e9}+)(\\w*)", "\x{100}(.)", '[^\]]*\]');
+        my @strs = ("foo bar \"baz\" 123", "aaab ab b", "[x] [y]z]",
+                    "ab12 cd3 e", " x  \n y\n", "aabbbc aac",
+                    "\x{e9}\x{e9}t\x{e9}", "\x{100}\x{e9}\x{100}z");
+        my $bad = 0;
+        for my $pat (@pats) {
+            my $re = qr/$pat/;
+            my $slow = qr/$pat(?{})/;
+            for my $str (@strs, map { my $u = $_; utf8::upgrade($u); $u }
+                                    @strs)
+            {
+                my @got = map { $_ // 'u' }
+                          $str =~ $re ? ($&, @-, @+, $+, $^N) : ();
+                my @want = map { $_ // 'u' }
+                           $str =~ $slow ? ($&, @-, @+, $+, $^N) : ();
+                $bad++ unless "@got" eq "@want";
+                @got = map { $_ // 'u' } $str =~ /$re/g;
+                @want = map { $_ // 'u' } $str =~ /$slow/g;
+                $bad++ unless "@got" eq "@want";
+                (my $got = $str) =~ s/$re/<$&>/g;
+                (my $want = $str) =~ s/$slow/<$&>/g;
+                $bad++ unless $got eq $want;
+            }
+        }
+        is($bad, 0, "the straight-line matcher agrees with regmatch()");
+    }
 } # End of sub run_tests
 
 1;
@@ -1,7 +1,8 @@
 #!./perl
 
 # Check that we don't recompile runtime patterns when the pattern hasn't
-# changed
+# changed, or when an earlier compilation of it is in the cache of compiled
+# patterns
 #
 # Works by checking the debugging output of 'use re debug' and, if
 # available, -Dr. We use both to check that the different code paths
@@ -20,7 +21,7 @@ BEGIN {
 use strict;
 use warnings;
 
-plan tests => 48;
+plan tests => 55;
 
 my $results = runperl(
 			switches => [ '-Dr' ],
@@ -139,11 +140,13 @@ my $x = chr(0x80);
 "a" =~ qr/$x$_/ for '\x{100}', '\x{100}', '\x{100}';
 CODE
 
-comp_n(3, <<'CODE', 'mixed utf8');
+# the third pattern is found in the cache
+
+comp_n(2, <<'CODE', 'mixed utf8');
 "a" =~ /$_/ for "\x{c4}\x{80}",  "\x{100}", "\x{c4}\x{80}";
 CODE
 
-comp_n(3, <<'CODE', 'mixed utf8 qr');
+comp_n(2, <<'CODE', 'mixed utf8 qr');
 "a" =~ qr/$_/ for "\x{c4}\x{80}",  "\x{100}", "\x{c4}\x{80}";
 CODE
 
@@ -186,12 +189,32 @@ BEGIN { $^H |= 0x00200000 } # lightweight "use re 'eval'"
 "a" =~ qr/a$x$_/ for $y, $y, $y;
 CODE
 
-comp_n(6, <<'CODE', 'embedded code qr');
+comp_n(4, <<'CODE', 'embedded code qr');
 my $x = qr/a/i;
 my $y = qr/a/;
 "a" =~ qr/a$_/ for $x, $y, $x, $y;
 CODE
 
+comp_n(2, <<'CODE', 'alternating patterns');
+"a" =~ /$_/ for qw(a b a b a b);
+CODE
+
+comp_n(2, <<'CODE', 'same patterns at different ops');
+"a" =~ /$_/ for qw(a b);
+"b" =~ /$_/ for qw(b a);
+CODE
+
+comp_n(2, <<'CODE', 'same pattern with different flags');
+"a" =~ /$_/i for qw(a a);
+"a" =~ /$_/ for qw(a a);
+CODE
+
+# not under -Dr, which would see the patterns re.pm compiles when loaded
+_comp_n(0, 6, <<'CODE', 'alternating patterns, cache disabled');
+re::regcache_size(0);
+"a" =~ /$_/ for qw(a b a b a b);
+CODE
+
 comp_n(2, <<'CODE', '(??{"constant"})');
 "bb" =~ /(??{"abc"})/;
 CODE
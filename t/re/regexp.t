@@ -89,7 +89,7 @@ use strict;
 use warnings FATAL=>"all";
 no warnings 'experimental::vlb';
 our ($bang, $ffff, $nulnul); # used by the tests
-our ($qr, $skip_amp, $qr_embed, $qr_embed_thr, $regex_sets, $alpha_assertions, $no_null); # set by our callers
+our ($qr, $skip_amp, $qr_embed, $qr_embed_thr, $regex_sets, $alpha_assertions, $no_null, $linear); # set by our callers
 
 if ($no_null && ! eval { require XS::APItest }) {
     print("1..0 # Skip XS::APItest not available\n"), exit
@@ -511,6 +511,7 @@ EOFCODE
 EOFCODE
         }
         $code = "$code" if $regex_sets;
+        $code = "use re 'linear'; $code" if $linear;
         #$code.=qq[\n\$expect="$expect";\n];
         #use Devel::Peek;
         #die Dump($code) if $pat=~/\\h/ and $subject=~/\x{A0}/;
@@ -522,6 +523,10 @@ EOFCODE
 	    eval $code;
 	}
 	chomp( my $err = $@ );
+	if ($linear && $err =~ /^Pattern cannot be matched in linear time/) {
+	    print "ok $testname # skipped.  Not matchable in linear time\n";
+	    next TEST;
+	}
 	if ($result eq 'c') {
 	    if ($err !~ m!^\Q$expect!) { print "not ok $testname$todo (compile) $input => '$err'\n"; next TEST }
 	    last;  # no need to study a syntax error
@@ -24,7 +24,7 @@ BEGIN {
 skip_all('no re module') unless defined &DynaLoader::boot_DynaLoader;
 skip_all_without_unicode_tables();
 
-plan tests => 59;  #** update watchdog timeouts proportionally when adding tests
+plan tests => 62;  #** update watchdog timeouts proportionally when adding tests
 
 use strict;
 use warnings;
@@ -157,6 +157,21 @@ PROG
             or diag "elapsed=$elapsed";
     }
 
+    {
+        # These take time polynomial in the length of the string to fail
+        # by backtracking alone, but are switched to the linear-time
+        # matcher once it has taken too long.
+        my $digits = ("1" x 100) . "!";
+        ok($digits !~ /^(\d+)(\d+)(\d+)(\d+)(\d+)(\d+)$/,
+           "adjacent quantified groups mustn't run slowly");
+        ok($digits !~ /^\d*\d*\d*\d*\d*\d*$/,
+           "adjacent quantifiers mustn't run slowly");
+        my $later = ("1" x 100) . "?1234567!";
+        ok($later =~ /(\d+)(\d+)(\d+)(\d+)(\d+)(\d+)!/
+           && "$&:$1:$6" eq "1234567!:12:7",
+           "the linear-time matcher finds the same match");
+    }
+
     # [perl #133185] Infinite loop
     like("!\xdf", eval 'qr/\pp(?aai)\xdf/',
          'Compiling qr/\pp(?aai)\xdf/ doesn\'t loop');
@@ -12,7 +12,7 @@ BEGIN {
     skip_all_without_config('d_fork');
 }
 
-plan tests => 106;
+plan tests => 110;
 
 my $STDOUT = tempfile();
 my $STDERR = tempfile();
@@ -319,4 +319,28 @@ foreach (['nothing', ''],
   is ("@inc", "@expect", "expected elements in \@INC for $name");
 }
 
+{
+    my $prof = tempfile();
+    my $code = <<'CODE';
+sub busy { my $t = (times)[0]; my $i = 0; $i++ while (times)[0] - $t < 0.2; $i }
+busy();
+CODE
+    ($out, $err) = runperl_and_capture({PERL_OP_PROFILE => $prof},
+                                       ['-e', $code]);
+    is ($err, '', 'No errors running under PERL_OP_PROFILE');
+
+    my $ops = do { local (@ARGV, $/) = "$prof.ops"; <> } // '';
+    like ($ops, qr/^tms \d+$/m, 'PERL_OP_PROFILE counts ops by type');
+    unlink "$prof.ops";
+
+  SKIP: {
+    skip 'no setitimer', 2 unless $Config{d_setitimer};
+    my $stacks = do { local (@ARGV, $/) = $prof; <> } // '';
+    like ($stacks, qr/^main::busy;-e:1;\w+ \d+$/m,
+          'PERL_OP_PROFILE samples are collapsed stacks');
+    unlike ($stacks, qr/^(?!\S.* \d+$)/m,
+            'PERL_OP_PROFILE sample lines are well formed');
+  }
+}
+
 # PERL5LIB tests with included arch directories still missing
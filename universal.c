@@ -34,6 +34,10 @@
 #include "perliol.h" /* For the PERLIO_F_XXX */
 #endif
 
+#ifdef I_SYS_SYSCALL
+#include <sys/syscall.h> /* For the system calls of PerlIO::copy() */
+#endif
+
 /*
  * Contributed by Graham Barr  <Graham.Barr@tiuk.ti.com>
  * The main guts of traverse_isa was actually copied from gv_fetchmeth
@@ -925,6 +929,402 @@ XS(XS_PerlIO_get_layers)
     XSRETURN(0);
 }
 
+XS(XS_PerlIO_read_lines); /* prototype to pass -Wmissing-prototypes */
+XS(XS_PerlIO_read_lines)
+{
+    dXSARGS;
+    SV *	sv;
+    GV *	gv;
+    IO *	io = NULL;
+    AV *	av;
+    PerlIO *	fp;
+    const MAGIC *mg;
+    IV		max;
+    SSize_t	n = 0;
+    bool	reuse;
+
+    if (items != 3)
+        croak_xs_usage(cv, "filehandle, array, count");
+
+    sv = ST(0);
+    /* MAYBE_DEREF_GV will call get magic */
+    if ((gv = MAYBE_DEREF_GV(sv)))
+        io = GvIO(gv);
+    else if (SvROK(sv) && SvTYPE(SvRV(sv)) == SVt_PVIO)
+        io = (IO*)SvRV(sv);
+    else if (!SvROK(sv) && (gv = gv_fetchsv_nomg(sv, 0, SVt_PVIO)))
+        io = GvIO(gv);
+
+    sv = ST(1);
+    SvGETMAGIC(sv);
+    if (!SvROK(sv) || SvTYPE(SvRV(sv)) != SVt_PVAV)
+        Perl_croak(aTHX_ "Not an ARRAY reference");
+    av = MUTABLE_AV(SvRV(sv));
+    if (SvREADONLY(av))
+        Perl_croak_no_modify();
+    max = SvIV(ST(2));
+
+    mg = io ? SvTIED_mg((const SV *)io, PERL_MAGIC_tiedscalar) : NULL;
+    fp = io ? IoIFP(io) : NULL;
+    if (!mg && !fp) {
+        SETERRNO(EBADF,RMS_IFI);
+        XSRETURN_UNDEF;
+    }
+    if (!mg) {
+        if (IoTYPE(io) == IoTYPE_WRONLY)
+            report_wrongway_fh(gv, '>');
+        if (gv)
+            PL_last_in_gv = gv;     /* for $. */
+    }
+
+    /* A plain array keeps the scalars it had, when nothing else refers
+     * to them, and the lines are read into their buffers */
+    reuse = !SvMAGICAL(av) && AvREAL(av);
+    if (!reuse)
+        av_clear(av);
+
+    while (n < max) {
+        SV *line = NULL;
+        bool fresh;
+
+        if (reuse && n <= AvFILLp(av)) {
+            SV * const old = AvARRAY(av)[n];
+            if (old && SvREFCNT(old) == 1 && SvTYPE(old) <= SVt_PVMG
+                && !SvMAGICAL(old) && !SvREADONLY(old) && !SvOBJECT(old))
+                line = old;
+        }
+        fresh = !line;
+        if (fresh)
+            line = newSV(80);
+
+        if (mg) {
+            SV *ret;
+            bool got;
+
+            ENTER;
+            SAVETMPS;
+            PUSHMARK(SP);
+            XPUSHs(SvTIED_obj(MUTABLE_SV(io), mg));
+            PUTBACK;
+            call_method("READLINE", G_SCALAR);
+            SPAGAIN;
+            ret = POPs;
+            PUTBACK;
+            got = SvOK(ret);
+            if (got)
+                sv_setsv(line, ret);
+            FREETMPS;
+            LEAVE;
+            if (!got) {
+                if (fresh)
+                    SvREFCNT_dec_NN(line);
+                break;
+            }
+        }
+        else {
+            if (!sv_gets(line, fp, 0)) {
+                if (fresh)
+                    SvREFCNT_dec_NN(line);
+                break;
+            }
+            /* as do_readline() does for each line */
+            if (!(IoFLAGS(io) & IOf_UNTAINT)) {
+                TAINT;
+                SvTAINTED_on(line);
+            }
+            IoLINES(io)++;
+            IoFLAGS(io) |= IOf_NOLINE;
+            if (SvUTF8(line) && ckWARN(WARN_UTF8)) {
+                const U8 *f;
+                if (!is_utf8_string_loc((const U8*)SvPVX_const(line),
+                                        SvCUR(line), &f))
+                    Perl_warner(aTHX_ packWARN(WARN_UTF8),
+                                "utf8 \"\\x%02X\" does not map to Unicode",
+                                f < (U8*)SvEND(line) ? *f : 0);
+            }
+        }
+
+        if (fresh) {
+            /* as pp_aassign() does for a magical array */
+            const bool stored = cBOOL(av_store(av, n, line));
+            if (SvSMAGICAL(line))
+                mg_set(line);
+            if (!stored)
+                SvREFCNT_dec_NN(line);
+        }
+        n++;
+    }
+
+    if (reuse && AvFILLp(av) >= n)
+        av_fill(av, n - 1);
+    else if (!reuse)
+        SvSETMAGIC(MUTABLE_SV(av));
+
+    XSRETURN_IV(n);
+}
+
+/* The buffer PerlIO::copy() reads into when the kernel can't do the copy,
+ * and the most it asks the kernel to move in one call */
+#define PERLIO_COPY_BUFSIZ	(128*1024)
+#define PERLIO_COPY_CHUNK	((Size_t)1 << 30)
+
+/* Finds the IO of a filehandle argument, as get_layers() does */
+STATIC IO *
+S_copy_io(pTHX_ SV *sv, GV **gvp)
+{
+    GV *gv;
+    IO *io = NULL;
+
+    PERL_ARGS_ASSERT_COPY_IO;
+
+    /* MAYBE_DEREF_GV will call get magic */
+    if ((gv = MAYBE_DEREF_GV(sv)))
+        io = GvIO(gv);
+    else if (SvROK(sv) && SvTYPE(SvRV(sv)) == SVt_PVIO)
+        io = (IO*)SvRV(sv);
+    else if (!SvROK(sv) && (gv = gv_fetchsv_nomg(sv, 0, SVt_PVIO)))
+        io = GvIO(gv);
+    *gvp = gv;
+    return io;
+}
+
+/* Whether the bytes of f are those of its file descriptor, give or take
+ * what is in a :perlio buffer */
+STATIC bool
+S_copy_direct(pTHX_ PerlIO *f)
+{
+    PerlIO *l;
+
+    PERL_ARGS_ASSERT_COPY_DIRECT;
+
+    for (l = f; PerlIOValid(l); l = PerlIONext(l)) {
+        const PerlIO_funcs * const tab = PerlIOBase(l)->tab;
+        if (tab != &PerlIO_unix && tab != &PerlIO_perlio)
+            return FALSE;
+    }
+    return PerlIO_fileno(f) >= 0;
+}
+
+/* Has the kernel move max bytes, or up to the end of the file if max is
+ * negative, from infd to outfd, with the first of copy_file_range(),
+ * sendfile() and splice() that accepts the two descriptors.  Adds the
+ * bytes moved to *copied.  Returns 0 when done, 1 if none of them could
+ * be used, and -1 with errno set on an error. */
+STATIC int
+S_copy_kernel(pTHX_ int infd, int outfd, Off_t max, Off_t *copied)
+{
+    int how = 0;
+    bool moved = FALSE;
+
+    PERL_ARGS_ASSERT_COPY_KERNEL;
+
+    while (max != 0) {
+        const Size_t want = max < 0 || (Off_t)PERLIO_COPY_CHUNK < max
+                          ? PERLIO_COPY_CHUNK : (Size_t)max;
+        long n;
+
+        switch (how) {
+#if defined(HAS_SYSCALL) && defined(SYS_copy_file_range)
+        case 0:
+            n = syscall(SYS_copy_file_range, infd, NULL, outfd, NULL, want, 0);
+            break;
+#endif
+#if defined(HAS_SYSCALL) && defined(SYS_sendfile)
+        case 1:
+            n = syscall(SYS_sendfile, outfd, infd, NULL, want);
+            break;
+#endif
+#if defined(HAS_SYSCALL) && defined(SYS_splice)
+        case 2:
+            n = syscall(SYS_splice, infd, NULL, outfd, NULL, want, 0);
+            break;
+#endif
+        default:
+            if (++how > 2)
+                return 1;
+            continue;
+        }
+
+        if (n > 0) {
+            *copied += n;
+            if (max > 0)
+                max -= n;
+            moved = TRUE;
+        }
+        else if (n == 0) {
+            /* copy_file_range() gives 0 for the files of /proc and
+             * the like, so only the others are trusted to see the end */
+            if (moved || how > 0)
+                break;
+            how++;
+        }
+        else if (errno == EINTR)
+            PERL_ASYNC_CHECK();
+        else if (!moved && (errno == EINVAL || errno == ENOSYS
+                            || errno == EXDEV || errno == EBADF
+#ifdef EOPNOTSUPP
+                            || errno == EOPNOTSUPP
+#endif
+                            || errno == ESPIPE))
+            how++;
+        else
+            return -1;
+    }
+    return 0;
+}
+
+/* Copies max bytes, or up to the end of the file if max is negative, by
+ * reading into a buffer and printing it, which converts between :utf8
+ * and bytes as print would.  Adds the bytes read to *copied. */
+STATIC bool
+S_copy_loop(pTHX_ PerlIO *in, PerlIO *out, Off_t max, Off_t *copied)
+{
+    SV * const buf = sv_2mortal(newSV(PERLIO_COPY_BUFSIZ + UTF8_MAXBYTES));
+    STRLEN keep = 0;
+
+    PERL_ARGS_ASSERT_COPY_LOOP;
+
+    SvPOK_on(buf);
+    if (PerlIO_isutf8(in))
+        SvUTF8_on(buf);
+    while (max != 0) {
+        char * const p = SvPVX(buf);
+        const Size_t want = max < 0 || PERLIO_COPY_BUFSIZ < max
+                          ? PERLIO_COPY_BUFSIZ : (Size_t)max;
+        const SSize_t n = PerlIO_read(in, p + keep, want);
+        STRLEN len;
+
+        if (n < 0 || (n == 0 && PerlIO_error(in)))
+            return FALSE;
+        if (n == 0)
+            break;
+        *copied += n;
+        if (max > 0)
+            max -= n;
+        len = keep + n;
+        keep = 0;
+        if (SvUTF8(buf) && max != 0) {
+            /* hold back a character which the read has split */
+            const U8 * const e = (U8 *)p + len;
+            const U8 *s = e;
+            while (s > (U8 *)p && e - s < UTF8_MAXBYTES
+                   && UTF8_IS_CONTINUATION(s[-1]))
+                s--;
+            if (s > (U8 *)p && UTF8_IS_START(s[-1])
+                && (STRLEN)(e - s + 1) < UTF8SKIP(s - 1))
+                keep = e - s + 1;
+        }
+        SvCUR_set(buf, len - keep);
+        if (!do_print(buf, out))
+            return FALSE;
+        if (keep)
+            Move(p + len - keep, p, keep, char);
+    }
+    if (keep) {
+        SvCUR_set(buf, keep);
+        return do_print(buf, out);
+    }
+    return TRUE;
+}
+
+XS(XS_PerlIO_copy); /* prototype to pass -Wmissing-prototypes */
+XS(XS_PerlIO_copy)
+{
+    dXSARGS;
+    GV *	ingv;
+    GV *	outgv;
+    IO *	inio;
+    IO *	outio;
+    PerlIO *	in;
+    PerlIO *	out;
+    Off_t	max = -1;
+    Off_t	copied = 0;
+    bool	ok = TRUE;
+
+    if (items < 2 || items > 3)
+        croak_xs_usage(cv, "from, to, length=undef");
+
+    inio = copy_io(ST(0), &ingv);
+    outio = copy_io(ST(1), &outgv);
+    if (items > 2) {
+        SV * const sv = ST(2);
+        SvGETMAGIC(sv);
+        if (SvOK(sv)) {
+            const IV len = SvIV_nomg(sv);
+            if (len < 0)
+                Perl_croak(aTHX_ "Negative length");
+            max = (Off_t)len;
+        }
+    }
+
+    in = inio ? IoIFP(inio) : NULL;
+    out = outio ? IoOFP(outio) : NULL;
+    if (!in || IoTYPE(inio) == IoTYPE_WRONLY) {
+        if (in)
+            report_wrongway_fh(ingv, '>');
+        else
+            report_evil_fh(ingv);
+        SETERRNO(EBADF,RMS_IFI);
+        XSRETURN_UNDEF;
+    }
+    if (!out) {
+        if (outio && IoIFP(outio))
+            report_wrongway_fh(outgv, '<');
+        else
+            report_evil_fh(outgv);
+        SETERRNO(EBADF,RMS_IFI);
+        XSRETURN_UNDEF;
+    }
+
+    if (in != out && copy_direct(in) && copy_direct(out)
+        && cBOOL(PerlIO_isutf8(in)) == cBOOL(PerlIO_isutf8(out)))
+    {
+        /* Pass on what is already in the input buffer, empty both
+         * buffers, and the descriptors are where the handles are */
+        if (PerlIOBase(in)->tab == &PerlIO_perlio) {
+            SSize_t cnt = PerlIO_get_cnt(in);
+            if (max >= 0 && cnt > max)
+                cnt = (SSize_t)max;
+            if (cnt > 0) {
+                STDCHAR * const ptr = PerlIO_get_ptr(in);
+                const SSize_t w = PerlIO_write(out, ptr, cnt);
+                if (w > 0) {
+                    PerlIO_set_ptrcnt(in, ptr + w, PerlIO_get_cnt(in) - w);
+                    copied += w;
+                }
+                ok = w == cnt;
+            }
+        }
+        if (ok && PerlIO_flush(out) != 0)
+            ok = FALSE;
+        if (ok && copied != max && PerlIO_flush(in) == 0) {
+            Off_t moved = 0;
+            const int code = copy_kernel(PerlIO_fileno(in), PerlIO_fileno(out),
+                                         max < 0 ? -1 : max - copied, &moved);
+            /* a :perlio buffer counts the position of the file itself */
+            if (PerlIOBase(in)->tab == &PerlIO_perlio)
+                PerlIOSelf(in, PerlIOBuf)->posn += moved;
+            if (PerlIOBase(out)->tab == &PerlIO_perlio)
+                PerlIOSelf(out, PerlIOBuf)->posn += moved;
+            copied += moved;
+            if (code < 0)
+                ok = FALSE;
+            else if (code == 0)
+                max = copied;
+        }
+    }
+
+    if (ok && copied != max)
+        ok = copy_loop(in, out, max < 0 ? -1 : max - copied, &copied);
+
+    /* Like syswrite(), report what was done before an error */
+    if (!ok && !copied)
+        XSRETURN_UNDEF;
+    ST(0) = sv_2mortal(copied <= IV_MAX ? newSViv((IV)copied)
+                                        : newSVnv((NV)copied));
+    XSRETURN(1);
+}
+
 XS(XS_re_is_regexp); /* prototype to pass -Wmissing-prototypes */
 XS(XS_re_is_regexp)
 {
@@ -1350,6 +1750,8 @@ static const struct xsub_details these_details[] = {
     {"Internals::stack_refcounted", XS_Internals_stack_refcounted, NULL, 0 },
     {"constant::_make_const", XS_constant__make_const, "\\[$@]", 0 },
     {"PerlIO::get_layers", XS_PerlIO_get_layers, "*;@", 0 },
+    {"PerlIO::read_lines", XS_PerlIO_read_lines, "*\\@$", 0 },
+    {"PerlIO::copy", XS_PerlIO_copy, "**;$", 0 },
     {"re::is_regexp", XS_re_is_regexp, "$", 0 },
     {"re::regname", XS_re_regname, ";$$", 0 },
     {"re::regnames", XS_re_regnames, ";$", 0 },
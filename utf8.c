@@ -2256,7 +2256,34 @@ Perl_utf8_length(pTHX_ const U8 * const s0, const U8 * const e)
     continuations -= s - partial_word_end;
     s = partial_word_end;
 
-    do { /* Process per-word */
+#  ifdef PERL_USE_SSE2
+
+    /* Process 16 bytes at a time.  Viewed as signed, the continuation bytes
+     * 0x80..0xBF are the ones less than -64.  Each matching byte of the
+     * comparison is -1, which is subtracted from the running count in its
+     * column; the columns can count up to 255 before _mm_sad_epu8() must add
+     * them up.  This leaves 's' on a word boundary for the loop below. */
+    while (s + 16 <= e_limit) {
+        const U8 * const chunk_end
+                        = s + 16 * MIN(255, (STRLEN) (e_limit - s) / 16);
+        __m128i counts = _mm_setzero_si128();
+        __m128i sums;
+
+        do {
+            counts = _mm_sub_epi8(counts,
+                        _mm_cmplt_epi8(_mm_loadu_si128((const __m128i *) s),
+                                       _mm_set1_epi8(-64)));
+            s += 16;
+        } while (s < chunk_end);
+
+        sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+        continuations += (STRLEN) _mm_cvtsi128_si32(sums)
+                       + (STRLEN) _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+    }
+
+#  endif
+
+    while (s + PERL_WORDSIZE <= e_limit) { /* Process per-word */
 
         /* The idea for counting continuation bytes came from
          * https://www.daemonology.net/blog/2008-06-05-faster-utf8-strlen.html
@@ -2279,7 +2306,7 @@ Perl_utf8_length(pTHX_ const U8 * const s0, const U8 * const e)
                   * PERL_COUNT_MULTIPLIER)
                 >> ((PERL_WORDSIZE - 1) * CHARBITS);
         s += PERL_WORDSIZE;
-    } while (s + PERL_WORDSIZE <= e_limit);
+    }
 
     /* Process remainder per-byte */
     while (s < e) {
@@ -2455,8 +2482,35 @@ Perl_utf8_to_bytes(pTHX_ U8 *s, STRLEN *lenp)
         /* Adjust back down any overshoot */
         s = partial_word_end;
 
+#  ifdef PERL_USE_SSE2
+
+        /* Process 16 bytes at a time, using the same masks as the per-word
+         * loop below.  This leaves 's' on a word boundary for that loop. */
+        while (s + 16 <= send) {
+            const __m128i bytes = _mm_loadu_si128((const __m128i *) s);
+            const __m128i start_bytes
+                = _mm_cmpeq_epi8(_mm_and_si128(bytes,
+                                               _mm_set1_epi8((char) 0xC0)),
+                                 _mm_set1_epi8((char) 0xC0));
+            const __m128i C2_C3_start_bytes
+                = _mm_cmpeq_epi8(_mm_and_si128(bytes,
+                                               _mm_set1_epi8((char) 0xFE)),
+                                 _mm_set1_epi8((char) 0xC2));
+
+            if (_mm_movemask_epi8(_mm_andnot_si128(C2_C3_start_bytes,
+                                                   start_bytes)))
+            {
+                *lenp = ((STRLEN) -1);
+                return NULL;
+            }
+
+            s += 16;
+        }
+
+#  endif
+
         /* Process per-word */
-        do {
+        while (s + PERL_WORDSIZE <= send) {
 
             PERL_UINTMAX_T C2_C3_start_bytes;
 
@@ -2500,7 +2554,7 @@ Perl_utf8_to_bytes(pTHX_ U8 *s, STRLEN *lenp)
             }
 
             s += PERL_WORDSIZE;
-        } while (s + PERL_WORDSIZE <= send);
+        }
 
         /* If the final byte was a start byte, it means that the character
          * straddles two words, so back off one to start looking below at the
@@ -2538,10 +2592,34 @@ Perl_utf8_to_bytes(pTHX_ U8 *s, STRLEN *lenp)
 
     d = s = first_variant;
 
+#ifdef PERL_USE_SSE2
+    const U8 * next_block = s;
+#endif
+
     while (s < send) {
         U8 * s1;
 
         if (UVCHR_IS_INVARIANT(*s)) {
+
+#ifdef PERL_USE_SSE2
+
+            /* Move a whole block of 16 invariants at once.  'd' trails 's',
+             * and the block is loaded before it is stored, so the overlap is
+             * harmless.  A block found to have variants isn't looked at
+             * again, so that text dense with them isn't slowed down */
+            if (s >= next_block && send - s >= 16) {
+                const __m128i bytes = _mm_loadu_si128((const __m128i *) s);
+                if (! _mm_movemask_epi8(bytes)) {
+                    _mm_storeu_si128((__m128i *) d, bytes);
+                    d += 16;
+                    s += 16;
+                    continue;
+                }
+                next_block = s + 16;
+            }
+
+#endif
+
             *d++ = *s++;
             continue;
         }
@@ -2791,6 +2869,27 @@ Perl_bytes_to_utf8(pTHX_ const U8 *s, STRLEN *lenp)
     Newx(d, (*lenp) + variant_under_utf8_count(s, send) + 1, U8);
     dst = d;
 
+#ifdef PERL_USE_SSE2
+
+    /* Copy each block of 16 invariants as it is */
+    while (send - s >= 16) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i *) s);
+        if (! _mm_movemask_epi8(bytes)) {
+            _mm_storeu_si128((__m128i *) d, bytes);
+            d += 16;
+            s += 16;
+        }
+        else {
+            const U8 * const block_end = s + 16;
+            do {
+                append_utf8_from_native_byte(*s, &d);
+                s++;
+            } while (s < block_end);
+        }
+    }
+
+#endif
+
     while (s < send) {
         append_utf8_from_native_byte(*s, &d);
         s++;
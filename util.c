@@ -970,9 +970,72 @@ Perl_rninstr(const char *big, const char *bigend, const char *little, const char
     }
 }
 
+#ifdef PERL_USE_SSE2
+
+/* The longest string fbm_instr() looks for with first_last_instr() rather
+ * than a Boyer-Moore table */
+#  define FBM_SHORT_MAX 32
+
+/* Find the first occurrence of the 'littlelen' bytes at 'little' in 'big'
+ * up to 'bigend', or return NULL.  16 positions at a time are tested for
+ * whether they have the needle's first and last bytes where it would, and
+ * the rest of the needle is only compared at those which do.  This is
+ * quicker than Boyer-Moore for short needles, whose skips are short too,
+ * and needs no table. */
+
+STATIC char *
+S_first_last_instr(const U8 *big, const U8 *bigend, const U8 *little,
+                   const STRLEN littlelen)
+{
+    const U8 * const last = bigend - littlelen; /* last possible start */
+    const U8 first_byte = little[0];
+    const U8 last_byte = little[littlelen - 1];
+
+    PERL_ARGS_ASSERT_FIRST_LAST_INSTR;
+
+    assert(littlelen >= 2);
+    assert(bigend - big >= (SSize_t) littlelen);
+
+    if (last - big >= 15) {
+        const __m128i firsts = _mm_set1_epi8((char) first_byte);
+        const __m128i lasts = _mm_set1_epi8((char) last_byte);
+
+        do {
+            const __m128i at_first = _mm_cmpeq_epi8(firsts,
+                            _mm_loadu_si128((const __m128i *) big));
+            const __m128i at_last = _mm_cmpeq_epi8(lasts,
+                            _mm_loadu_si128((const __m128i *)
+                                                (big + littlelen - 1)));
+            U32 hits = (U32) _mm_movemask_epi8(_mm_and_si128(at_first,
+                                                             at_last));
+            while (hits) {
+                const U8 * const s = big + lsbit_pos32(hits);
+                if (memEQ(s + 1, little + 1, littlelen - 2))
+                    return (char *) s;
+                hits &= hits - 1;
+            }
+            big += 16;
+        } while (last - big >= 15);
+    }
+
+    for (; big <= last; big++) {
+        if (   big[0] == first_byte
+            && big[littlelen - 1] == last_byte
+            && memEQ(big + 1, little + 1, littlelen - 2))
+        {
+            return (char *) big;
+        }
+    }
+
+    return NULL;
+}
+
+#endif
+
 /* As a space optimization, we do not compile tables for strings of length
    0 and 1, and for strings of length 2 unless FBMcf_TAIL.  These are
-   special-cased in fbm_instr().
+   special-cased in fbm_instr().  Where SSE2 is available, nor do we for
+   strings of up to FBM_SHORT_MAX bytes, which it searches for without.
 
    If FBMcf_TAIL, the table is created as if the string has a trailing \n. */
 
@@ -1023,7 +1086,12 @@ Perl_fbm_compile(pTHX_ SV *sv, U32 flags)
     mg = sv_magicext(sv, NULL, PERL_MAGIC_bm, &PL_vtbl_bm, NULL, 0);
     assert(mg);
 
-    if (len > 2) {
+#ifdef PERL_USE_SSE2
+    if (len > FBM_SHORT_MAX)
+#else
+    if (len > 2)
+#endif
+    {
         /* Shorter strings are special-cased in Perl_fbm_instr(), and don't use
            the BM table.  */
         const U8 mlen = (len>255) ? 255 : (U8)len;
@@ -1224,6 +1292,24 @@ Perl_fbm_instr(pTHX_ unsigned char *big, unsigned char *bigend, SV *littlestr, U
         return NULL;
     }
 
+#ifdef PERL_USE_SSE2
+    if (littlelen <= FBM_SHORT_MAX) {
+        s = (unsigned char *) first_last_instr(big, bigend, little,
+                                                 littlelen);
+        if (s)
+            return (char *) s;
+
+        /* with a trailing \n which could also be the end of the string */
+        if (   tail
+            && memEQ((char *)(bigend - littlelen + 1), (char *) little,
+                     littlelen - 1))
+        {
+            return (char *) bigend - littlelen + 1;
+        }
+        return NULL;
+    }
+#endif
+
     if (!valid) {
         /* not compiled; use Perl_ninstr() instead */
         char * const b = ninstr((char*)big,(char*)bigend,